@@ -55,40 +55,48 @@ const EventsList* LinkEvent::GetLinkedEvents(const gd::Project& project) const {
   return events;
 }
 
+const EventsList* LinkEvent::GetLinkedEventsRange(
+    const gd::Project& project,
+    std::size_t& firstEvent,
+    std::size_t& lastEvent) const {
+  // Finding what to link to.
+  const EventsList* eventsToInclude = GetLinkedEvents(project);
+  if (eventsToInclude == NULL) return NULL;
+
+  firstEvent = includeConfig == INCLUDE_BY_INDEX ? GetIncludeStart() : 0;
+  lastEvent = includeConfig == INCLUDE_BY_INDEX ? GetIncludeEnd()
+                                                : eventsToInclude->size() - 1;
+
+  // Check bounds
+  if (firstEvent >= eventsToInclude->size()) {
+    std::cout << "Unable to get events from a link ( Invalid start )"
+              << std::endl;
+    return NULL;
+  }
+  if (lastEvent >= eventsToInclude->size()) {
+    std::cout << "Unable to get events from a link ( Invalid end )"
+              << std::endl;
+    return NULL;
+  }
+  if (firstEvent > lastEvent) {
+    std::cout << "Unable to get events from a link ( End is before start )"
+              << std::endl;
+    return NULL;
+  }
+
+  return eventsToInclude;
+}
+
 void LinkEvent::ReplaceLinkByLinkedEvents(
     const gd::Project& project,
     EventsList& eventList,
     std::size_t indexOfTheEventInThisList) {
   linkWasInvalid = false;
-  // Finding what to link to.
-  const EventsList* eventsToInclude = GetLinkedEvents(project);
+  std::size_t firstEvent = 0;
+  std::size_t lastEvent = 0;
+  const EventsList* eventsToInclude =
+      GetLinkedEventsRange(project, firstEvent, lastEvent);
   if (eventsToInclude != NULL) {
-    std::size_t firstEvent =
-        includeConfig == INCLUDE_BY_INDEX ? GetIncludeStart() : 0;
-    std::size_t lastEvent = includeConfig == INCLUDE_BY_INDEX
-                                ? GetIncludeEnd()
-                                : eventsToInclude->size() - 1;
-
-    // Check bounds
-    if (firstEvent >= eventsToInclude->size()) {
-      std::cout << "Unable to get events from a link ( Invalid start )"
-                << std::endl;
-      linkWasInvalid = true;
-      return;
-    }
-    if (lastEvent >= eventsToInclude->size()) {
-      std::cout << "Unable to get events from a link ( Invalid end )"
-                << std::endl;
-      linkWasInvalid = true;
-      return;
-    }
-    if (firstEvent > lastEvent) {
-      std::cout << "Unable to get events from a link ( End is before start )"
-                << std::endl;
-      linkWasInvalid = true;
-      return;
-    }
-
     // Insert an empty event to replace the link event ( we'll delete the link
     // event at the end ) ( If we just erase the link event without adding a
     // blank event to replace it, the first event inserted by the link will not
@@ -103,6 +111,9 @@ void LinkEvent::ReplaceLinkByLinkedEvents(
     // we've just inserted )
     eventList.RemoveEvent(indexOfTheEventInThisList + 1 +
                           static_cast<unsigned>(lastEvent - firstEvent) + 1);
+  } else if (GetLinkedEvents(project) != NULL) {
+    // The range of the events to include is invalid.
+    linkWasInvalid = true;
   } else {
     std::cout << "Unable to get events from a link." << std::endl;
     linkWasInvalid = true;
@@ -86,7 +86,7 @@ class GD_CORE_API LinkEvent : public gd::BaseEvent {
   /**
    * The link event must always be preprocessed.
    */
-  virtual bool MustBePreprocessed() override { return true; }
+  virtual bool MustBePreprocessed() const override { return true; }
 
   /**
    * \brief Get a pointer to the list of events that are targeted by the link.
@@ -97,6 +97,20 @@ class GD_CORE_API LinkEvent : public gd::BaseEvent {
    */
   const EventsList* GetLinkedEvents(const gd::Project& project) const;
 
+  /**
+   * \brief Get a pointer to the list of events that are targeted by the link,
+   * and the range of the events to be included.
+   *
+   * @param project The project containing the link.
+   * @param firstEvent Set to the index of the first event to be included.
+   * @param lastEvent Set to the index of the last event to be included.
+   * @return NULL if nothing is found or if the range is invalid, or a pointer
+   * to the list of events being linked.
+   */
+  const EventsList* GetLinkedEventsRange(const gd::Project& project,
+                                         std::size_t& firstEvent,
+                                         std::size_t& lastEvent) const;
+
   /**
    * \brief Replace the link in the events list by the linked events.
    * When implementing a platform with a link event, you should call this
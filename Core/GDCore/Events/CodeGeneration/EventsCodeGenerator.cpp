@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
@@ -972,7 +973,8 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
  * Generate events list code.
  */
 gd::String EventsCodeGenerator::GenerateEventsListCode(
-    gd::EventsList& events, EventsCodeGenerationContext& parentContext) {
+    gd::EventsList& originalEvents, EventsCodeGenerationContext& parentContext) {
+  gd::EventsList& events = GetPreprocessedEventList(originalEvents);
   gd::String output;
   for (std::size_t eId = 0; eId < events.size(); ++eId) {
     auto& event = events[eId];
@@ -1058,6 +1060,138 @@ void EventsCodeGenerator::PreprocessEventList(gd::EventsList& listEvent) {
   }
 }
 
+void EventsCodeGenerator::PreprocessEventListWithoutCopy(
+    const gd::EventsList& events) {
+  // Lists can be preprocessed more than once when they are linked.
+  if (preprocessedEventsLists.find(&events) != preprocessedEventsLists.end())
+    return;
+
+  auto mustBePreprocessed = [this](const gd::BaseEvent& event) {
+    return !event.IsDisabled() &&
+           (event.MustBePreprocessed() || event.HasAsyncActions(GetPlatform()));
+  };
+
+  // Sub-events of the events that are kept are preprocessed without copy too.
+  bool hasEventsToPreprocess = false;
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent& event = events[i];
+    if (mustBePreprocessed(event))
+      hasEventsToPreprocess = true;
+    else if (!event.IsDisabled() && event.CanHaveSubEvents())
+      PreprocessEventListWithoutCopy(event.GetSubEvents());
+  }
+  if (!hasEventsToPreprocess) return;
+
+  // Only events to be preprocessed are copied. Other events are shared: code
+  // generation doesn't modify events.
+  auto preprocessedEvents = std::make_shared<gd::EventsList>();
+  std::set<const gd::BaseEvent*> sharedEvents;
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    std::shared_ptr<gd::BaseEvent> event =
+        std::const_pointer_cast<gd::BaseEvent>(events.GetEventSmartPtr(i));
+    if (mustBePreprocessed(*event)) {
+      preprocessedEvents->InsertEvent(*event);
+    } else {
+      preprocessedEvents->InsertEvent(event);
+      sharedEvents.insert(event.get());
+    }
+  }
+
+  // Preprocess the copied events, and the events they insert (like the events
+  // inserted by a link).
+  for (std::size_t i = 0; i < preprocessedEvents->GetEventsCount(); ++i) {
+    gd::BaseEvent& event = (*preprocessedEvents)[i];
+    if (sharedEvents.find(&event) != sharedEvents.end()) continue;
+    if (event.IsDisabled()) continue;
+
+    event.Preprocess(*this, *preprocessedEvents, i);
+    if (i < preprocessedEvents->GetEventsCount()) {
+      gd::BaseEvent& preprocessedEvent = (*preprocessedEvents)[i];
+      if (preprocessedEvent.CanHaveSubEvents())
+        PreprocessEventList(preprocessedEvent.GetSubEvents());
+    }
+  }
+
+  preprocessedEventsLists[&events] = preprocessedEvents;
+}
+
+gd::EventsList& EventsCodeGenerator::GetPreprocessedEventList(
+    gd::EventsList& events) {
+  auto it = preprocessedEventsLists.find(&events);
+  return it != preprocessedEventsLists.end() ? *it->second : events;
+}
+
+gd::String EventsCodeGenerator::GenerateLinkedEventsCode(
+    const gd::LinkEvent& linkEvent, EventsCodeGenerationContext& context) {
+  if (!HasProjectAndLayout()) return "";
+
+  std::size_t firstEvent = 0;
+  std::size_t lastEvent = 0;
+  const gd::EventsList* linkedEvents =
+      linkEvent.GetLinkedEventsRange(GetProject(), firstEvent, lastEvent);
+  if (!linkedEvents) return "";
+
+  gd::String key = gd::String::From(static_cast<const void*>(linkedEvents)) +
+                   ":" + gd::String::From(firstEvent) + ":" +
+                   gd::String::From(lastEvent) + ":" +
+                   GetObjectsScopeKey(context);
+  bool canBeShared = !context.IsInsideAsync();
+  if (canBeShared) {
+    auto it = linkedEventsCode.find(key);
+    if (it != linkedEventsCode.end()) return it->second;
+  }
+
+  // Linked events are not copied: the list only shares them.
+  auto events = std::make_shared<gd::EventsList>();
+  for (std::size_t i = firstEvent; i <= lastEvent; ++i) {
+    events->InsertEvent(std::const_pointer_cast<gd::BaseEvent>(
+        linkedEvents->GetEventSmartPtr(i)));
+  }
+  linkedEventsLists.push_back(events);
+
+  PreprocessEventListWithoutCopy(*events);
+  gd::String code = GenerateEventsListCode(*events, context);
+  if (canBeShared) linkedEventsCode[key] = code;
+
+  return code;
+}
+
+gd::String EventsCodeGenerator::GetObjectsScopeKey(
+    const EventsCodeGenerationContext& context) {
+  auto addObjectsLists = [](gd::String& key,
+                            const std::set<gd::String>& objectsLists) {
+    for (const auto& objectName : objectsLists) key += objectName + ",";
+    key += ";";
+  };
+
+  gd::String key = gd::String::From(context.GetContextDepth()) + ";" +
+                   gd::String::From(context.GetCurrentConditionDepth()) + ";" +
+                   (context.CanReuse() ? "1" : "0") + ";" +
+                   context.GetCurrentObject() + ";";
+  addObjectsLists(key, context.GetObjectsListsAlreadyDeclaredByParents());
+  addObjectsLists(key, context.GetObjectsListsToBeDeclared());
+  addObjectsLists(key, context.GetObjectsListsToBeEmptyIfJustDeclared());
+  addObjectsLists(key, context.GetObjectsListsToBeDeclaredEmpty());
+  for (const auto& depthOfLastUse : context.depthOfLastUse) {
+    key += depthOfLastUse.first + "=" +
+           gd::String::From(depthOfLastUse.second) + ",";
+  }
+  key += ";";
+
+  // Local variables are accessed by their position in the stack.
+  const auto& variablesContainersList =
+      GetProjectScopedContainers().GetVariablesContainersList();
+  for (std::size_t i = 0;
+       i < variablesContainersList.GetVariablesContainersCount();
+       ++i) {
+    key += gd::String::From(static_cast<const void*>(
+               &variablesContainersList.GetVariablesContainer(i))) +
+           ",";
+  }
+
+  return key;
+}
+
 void EventsCodeGenerator::ReportError() { errorOccurred = true; }
 
 gd::String EventsCodeGenerator::GenerateObjectFunctionCall(
@@ -1377,6 +1511,7 @@ EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project_,
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0),
+      linkedEventsSharing(false),
       diagnosticReport(nullptr){};
 
 EventsCodeGenerator::EventsCodeGenerator(
@@ -1392,6 +1527,7 @@ EventsCodeGenerator::EventsCodeGenerator(
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0),
+      linkedEventsSharing(false),
       diagnosticReport(nullptr){};
 
 }  // namespace gd
@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <map>
+#include <memory>
 #include <set>
 #include <utility>
 #include <vector>
@@ -17,6 +19,7 @@
 
 namespace gd {
 class EventsList;
+class LinkEvent;
 class Expression;
 class Project;
 class Layout;
@@ -72,6 +75,43 @@ class GD_CORE_API EventsCodeGenerator {
    */
   void PreprocessEventList(gd::EventsList& listEvent);
 
+  /**
+   * \brief Preprocess an events list without copying or modifying it.
+   *
+   * Only the lists containing events that must be preprocessed (links, events
+   * with async actions...) are copied: these events are copied and
+   * preprocessed, while the other events of the list are shared with the
+   * original list. The copies are stored by the code generator and used by
+   * GenerateEventsListCode instead of the original lists, so code generation
+   * reads the original events everywhere else.
+   *
+   * This should be called before any code generation, instead of
+   * PreprocessEventList on a copy of the events.
+   */
+  void PreprocessEventListWithoutCopy(const gd::EventsList& events);
+
+  /**
+   * \brief Return the preprocessed version of an events list, if it was
+   * changed by PreprocessEventListWithoutCopy, or the list itself.
+   */
+  gd::EventsList& GetPreprocessedEventList(gd::EventsList& events);
+
+  /**
+   * \brief Generate the code of the events included by a link, when linked
+   * events sharing is enabled (see SetLinkedEventsSharing).
+   *
+   * The linked events are generated once for each objects scope (the objects
+   * lists and the local variables available where the link is) and this code
+   * is reused by the other links including the same events in the same scope.
+   * For platforms generating a function for each events list (see
+   * GenerateEventsListCode), the other links only call this function.
+   *
+   * Links inside asynchronous callbacks are always generated again, as the
+   * objects lists used by the linked events must be known by the callbacks.
+   */
+  gd::String GenerateLinkedEventsCode(const gd::LinkEvent& linkEvent,
+                                      EventsCodeGenerationContext& context);
+
   /**
    * \brief Generate code for executing an event list
    *
@@ -314,6 +354,19 @@ class GD_CORE_API EventsCodeGenerator {
     compilationForRuntime = compilationForRuntime_;
   }
 
+  /**
+   * \brief Return true if the events included by links must be generated by
+   * the links themselves, with GenerateLinkedEventsCode.
+   */
+  bool IsLinkedEventsSharingEnabled() const { return linkedEventsSharing; }
+
+  /**
+   * \brief Set if the events included by links must be generated by the links
+   * themselves, with GenerateLinkedEventsCode, instead of being copied in
+   * place of the links by the preprocessing.
+   */
+  void SetLinkedEventsSharing(bool enable) { linkedEventsSharing = enable; }
+
   /**
    * \brief Report that an error occurred during code generation ( Event code
    * won't be generated )
@@ -849,8 +902,27 @@ protected:
       instructionUniqueIds;  ///< The unique ids generated for instructions.
   size_t eventsListNextUniqueId;  ///< The next identifier to use for an events
                                   ///< list function name.
+  std::map<const gd::EventsList*, std::shared_ptr<gd::EventsList>>
+      preprocessedEventsLists;  ///< The lists changed by the preprocessing,
+                                ///< by the original list they replace.
+  bool linkedEventsSharing;  ///< True if links generate the events they
+                             ///< include with GenerateLinkedEventsCode.
+  std::map<gd::String, gd::String>
+      linkedEventsCode;  ///< The code generated for linked events, by linked
+                         ///< events and objects scope.
+  std::vector<std::shared_ptr<gd::EventsList>>
+      linkedEventsLists;  ///< The lists of linked events generated by
+                          ///< GenerateLinkedEventsCode, kept alive as events
+                          ///< lists are identified by their address.
 
   gd::DiagnosticReport* diagnosticReport;
+
+ private:
+  /**
+   * \brief Return a key identifying the objects lists and the local variables
+   * available to events generated in the given context.
+   */
+  gd::String GetObjectsScopeKey(const EventsCodeGenerationContext& context);
 };
 
 }  // namespace gd
@@ -72,15 +72,34 @@ gd::String BaseEvent::GenerateEventCode(
   return "";
 }
 
+namespace {
+
+bool IsAwaitedAction(const gd::Platform& platform,
+                     const gd::Instruction& action) {
+  const gd::InstructionMetadata& actionMetadata =
+      gd::MetadataProvider::GetActionMetadata(platform, action.GetType());
+  return actionMetadata.IsAsync() &&
+         (!actionMetadata.IsOptionallyAsync() || action.IsAwaited());
+}
+
+}  // namespace
+
+bool BaseEvent::HasAsyncActions(const gd::Platform& platform) const {
+  if (!CanHaveSubEvents()) return false;
+  for (const auto& actionsList : GetAllActionsVectors())
+    for (std::size_t aId = 0; aId < actionsList->size(); ++aId) {
+      if (IsAwaitedAction(platform, actionsList->at(aId))) return true;
+    }
+
+  return false;
+}
+
 void BaseEvent::PreprocessAsyncActions(const gd::Platform& platform) {
   if (!CanHaveSubEvents()) return;
   for (const auto& actionsList : GetAllActionsVectors())
     for (std::size_t aId = 0; aId < actionsList->size(); ++aId) {
       const auto& action = actionsList->at(aId);
-      const gd::InstructionMetadata& actionMetadata =
-          gd::MetadataProvider::GetActionMetadata(platform, action.GetType());
-      if (actionMetadata.IsAsync() &&
-          (!actionMetadata.IsOptionallyAsync() || action.IsAwaited())) {
+      if (IsAwaitedAction(platform, action)) {
         gd::InstructionsList remainingActions;
         remainingActions.InsertInstructions(
             *actionsList, aId + 1, actionsList->size() - 1);
@@ -241,6 +241,12 @@ class GD_CORE_API BaseEvent {
    */
   void PreprocessAsyncActions(const gd::Platform& platform);
 
+  /**
+   * \brief Return true if the event has an async action that will be turned
+   * into an Async subevent by PreprocessAsyncActions.
+   */
+  bool HasAsyncActions(const gd::Platform& platform) const;
+
   /**
    * \brief If MustBePreprocessed is redefined to return true, the
    * gd::EventMetadata::preprocessing associated to the event will be called to
@@ -249,7 +255,7 @@ class GD_CORE_API BaseEvent {
    * \see gd::BaseEvent::Preprocess
    * \see gd::EventMetadata
    */
-  virtual bool MustBePreprocessed() { return false; }
+  virtual bool MustBePreprocessed() const { return false; }
   ///@}
 
   /** \name Serialization
@@ -8,6 +8,8 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/ContentHash.h"
 #include "GDCore/Tools/Log.h"
 #include "Serialization.h"
 
@@ -23,6 +25,7 @@ void EventsList::InsertEvents(const EventsList& otherEvents,
   if (end < begin) return;
   if (end >= otherEvents.size()) end = otherEvents.size() - 1;
 
+  MarkAsModified();
   for (std::size_t insertPos = 0; insertPos <= (end - begin); insertPos++) {
     if (position != (size_t)-1 && position + insertPos < events.size())
       events.insert(
@@ -36,6 +39,7 @@ void EventsList::InsertEvents(const EventsList& otherEvents,
 
 gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
                                        size_t position) {
+  MarkAsModified();
   std::shared_ptr<gd::BaseEvent> event(evt.Clone());
   if (position < events.size())
     events.insert(events.begin() + position, event);
@@ -47,6 +51,7 @@ gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
 
 void EventsList::InsertEvent(std::shared_ptr<gd::BaseEvent> event,
                              size_t position) {
+  MarkAsModified();
   if (position < events.size())
     events.insert(events.begin() + position, event);
   else
@@ -67,12 +72,14 @@ gd::BaseEvent& EventsList::InsertNewEvent(gd::Project& project,
 }
 
 void EventsList::RemoveEvent(size_t index) {
+  MarkAsModified();
   events.erase(events.begin() + index);
 }
 
 void EventsList::RemoveEvent(const gd::BaseEvent& event) {
   for (size_t i = 0; i < events.size(); ++i) {
     if (events[i].get() == &event) {
+      MarkAsModified();
       events.erase(events.begin() + i);
       return;
     }
@@ -88,6 +95,17 @@ void EventsList::UnserializeFrom(gd::Project& project,
   EventsListSerialization::UnserializeEventsFrom(project, *this, element);
 }
 
+std::uint64_t EventsList::GetContentHash() const {
+  if (isContentHashOutdated) {
+    gd::SerializerElement element;
+    SerializeTo(element);
+    contentHash = gd::ContentHash::Of(element);
+    isContentHashOutdated = false;
+  }
+
+  return contentHash;
+}
+
 bool EventsList::Contains(const gd::BaseEvent& eventToSearch,
                           bool recursive) const {
   for (std::size_t i = 0; i < GetEventsCount(); ++i) {
@@ -106,6 +124,7 @@ bool EventsList::MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
   for (std::size_t i = 0; i < GetEventsCount(); ++i) {
     if (events[i].get() == &eventToMove) {
       std::shared_ptr<BaseEvent> event = events[i];
+      MarkAsModified();
       events.erase(events.begin() + i);
 
       newEventsList.InsertEvent(event, newPosition);
@@ -125,6 +144,8 @@ EventsList& EventsList::operator=(const EventsList& other) {
 }
 
 void EventsList::Init(const gd::EventsList& other) {
+  contentHash = other.contentHash;
+  isContentHashOutdated = other.isContentHashOutdated;
   events.clear();
   for (size_t i = 0; i < other.events.size(); ++i)
     events.push_back(CloneRememberingOriginalEvent(other.events[i]));
@@ -6,6 +6,7 @@
 #if defined(GD_IDE_ONLY)
 #ifndef GDCORE_EVENTSLIST_H
 #define GDCORE_EVENTSLIST_H
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
@@ -88,6 +89,7 @@ class GD_CORE_API EventsList {
    * events list.
    */
   std::shared_ptr<BaseEvent> GetEventSmartPtr(size_t index) {
+    MarkAsModified();
     return events[index];
   };
 
@@ -103,7 +105,10 @@ class GD_CORE_API EventsList {
    * \brief Return a reference to the event at position \a index in the events
    * list.
    */
-  gd::BaseEvent& GetEvent(size_t index) { return *events[index]; };
+  gd::BaseEvent& GetEvent(size_t index) {
+    MarkAsModified();
+    return *events[index];
+  };
 
   /**
    * \brief Return a reference to the event at position \a index in the events
@@ -129,7 +134,10 @@ class GD_CORE_API EventsList {
   /**
    * \brief Clear the list of events.
    */
-  void Clear() { return events.clear(); };
+  void Clear() {
+    events.clear();
+    MarkAsModified();
+  };
 
   /** \name Utilities
    * Utility methods
@@ -206,8 +214,28 @@ class GD_CORE_API EventsList {
   void UnserializeFrom(gd::Project& project, const SerializerElement& element);
   ///@}
 
+  /**
+   * \brief Return a hash of the events, with their sub-events.
+   *
+   * The hash is only computed again after the list was modified through its
+   * methods. Getting an event with a non-const accessor counts as a
+   * modification, as it can be modified through the reference.
+   *
+   * \see gd::ContentHash
+   */
+  std::uint64_t GetContentHash() const;
+
+  /**
+   * \brief Mark the list as modified, so that its hash is computed again. To
+   * be called after modifying events through references obtained before the
+   * last call to GetContentHash.
+   */
+  void MarkAsModified() { isContentHashOutdated = true; }
+
  private:
   std::vector<std::shared_ptr<BaseEvent> > events;
+  mutable std::uint64_t contentHash = 0;      ///< \see GetContentHash
+  mutable bool isContentHashOutdated = true;  ///< \see GetContentHash
 
   /**
    * Initialize from another list of events, copying events. Used by copy-ctor
@@ -13,6 +13,7 @@
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/PoolAllocator.h"
 
 namespace gd {
 
@@ -29,6 +30,11 @@ Instruction::Instruction(gd::String type_,
   parameters.reserve(8);
 }
 
+Instruction::Instruction(gd::String type_,
+                         std::vector<gd::Expression>&& parameters_,
+                         bool inverted_)
+    : type(type_), inverted(inverted_), parameters(std::move(parameters_)) {}
+
 const gd::Expression& Instruction::GetParameter(std::size_t index) const {
   if (index >= parameters.size()) return badExpression;
 
@@ -61,8 +67,8 @@ void Instruction::AddParameter(const gd::Expression& val) {
 
 std::shared_ptr<Instruction> GD_CORE_API
 CloneRememberingOriginalElement(std::shared_ptr<Instruction> instruction) {
-  std::shared_ptr<Instruction> copy =
-      std::make_shared<Instruction>(*instruction);
+  std::shared_ptr<Instruction> copy = std::allocate_shared<Instruction>(
+      gd::PoolAllocator<Instruction>(), *instruction);
   // Original instruction is either the original instruction of the copied
   // instruction, or the instruction copied.
   copy->originalInstruction = instruction->originalInstruction.expired()
@@ -11,6 +11,7 @@
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/StringAtom.h"
 
 namespace gd {
 
@@ -46,19 +47,42 @@ class GD_CORE_API Instruction {
               const std::vector<gd::Expression>& parameters_,
               bool inverted = false);
 
+  /**
+   * \brief Constructor taking ownership of the parameters, which are kept
+   * without extra capacity (useful when loading many instructions).
+   * \param type The type of the instruction
+   * \param parameters A vector containing the parameters of the instruction
+   * \param inverted true to set the instruction as inverted (used for condition
+   * instructions).
+   */
+  Instruction(gd::String type_,
+              std::vector<gd::Expression>&& parameters_,
+              bool inverted = false);
+
+  Instruction(const Instruction&) = default;
+  Instruction(Instruction&&) = default;
+  Instruction& operator=(const Instruction&) = default;
+  Instruction& operator=(Instruction&&) = default;
+
   virtual ~Instruction(){};
 
   /**
    * \brief Return the type of the instruction.
    * \return The type of the instruction
    */
-  const gd::String& GetType() const { return type; }
+  const gd::String& GetType() const { return type.GetString(); }
+
+  /**
+   * \brief Return the type of the instruction, as an interned string which
+   * can be compared in constant time.
+   */
+  const gd::StringAtom& GetTypeAtom() const { return type; }
 
   /**
    * \brief Change the instruction type
    * \param val The new type of the instruction
    */
-  void SetType(const gd::String& newType) { type = newType; }
+  void SetType(const gd::String& newType) { type = gd::StringAtom(newType); }
 
   /**
    * \brief Return true if the condition is inverted
@@ -168,7 +192,7 @@ class GD_CORE_API Instruction {
       std::shared_ptr<Instruction> instruction);
 
  private:
-  gd::String type;  ///< Instruction type
+  gd::StringAtom type;  ///< Instruction type
   bool inverted;  ///< True if the instruction if inverted. Only applicable for
                   ///< instruction used as conditions by events
   bool awaitAsync =
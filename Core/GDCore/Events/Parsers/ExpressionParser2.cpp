@@ -6,7 +6,9 @@
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
@@ -26,11 +28,274 @@ using namespace gd::GrammarTerminals;
 
 namespace gd {
 
+namespace {
+
+/**
+ * \brief A place of a tree where the node was parsed by
+ * ExpressionParser2::Expression, and so can be replaced by a node parsed
+ * again in the same way.
+ */
+struct ReparsableSlot {
+  std::unique_ptr<gd::ExpressionNode> *node;
+  gd::ExpressionNode *parent;
+  size_t ruleStartPosition;  ///< Where the parsing of the node started.
+  size_t ruleEndPosition;  ///< Where the parsing of the node ended (including
+                           /// the whitespaces after it).
+};
+
+/**
+ * \brief Find the parameters of functions, the sub-expressions and the
+ * expressions between brackets that contain an edit, from the outermost to
+ * the innermost.
+ */
+class ReparsableSlotsFinder : public gd::ExpressionParser2NodeWorker {
+ public:
+  ReparsableSlotsFinder(const std::u32string &expression_,
+                        size_t editStartPosition_,
+                        size_t editEndPosition_)
+      : expression(expression_),
+        editStartPosition(editStartPosition_),
+        editEndPosition(editEndPosition_){};
+  virtual ~ReparsableSlotsFinder(){};
+
+  const std::vector<ReparsableSlot> &GetSlots() const { return slots; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    AddSlotIfContainingEdit(node.expression, node);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode &node) override {}
+  void OnVisitTextNode(TextNode &node) override {}
+  void OnVisitVariableNode(VariableNode &node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    AddSlotIfContainingEdit(node.expression, node);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    for (auto &parameter : node.parameters) {
+      AddSlotIfContainingEdit(parameter, node);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override {}
+
+ private:
+  void AddSlotIfContainingEdit(std::unique_ptr<ExpressionNode> &node,
+                               ExpressionNode &parent) {
+    // Empty parameters have no location and can't be parsed alone.
+    if (!node || !node->location.IsValid()) return;
+
+    // A sub-expression is parsed from its opening parenthesis to its closing
+    // one (if any), which are not part of its location.
+    bool isSubExpression = dynamic_cast<SubExpressionNode *>(node.get());
+    size_t ruleStartPosition = node->location.GetStartPosition();
+    size_t ruleEndPosition = node->location.GetEndPosition();
+    if (isSubExpression) {
+      if (ruleStartPosition == 0) return;
+      ruleStartPosition--;
+      if (ruleEndPosition < expression.size() &&
+          IsClosingParenthesis(expression[ruleEndPosition]))
+        ruleEndPosition++;
+    }
+    while (ruleEndPosition < expression.size() &&
+           IsWhitespace(expression[ruleEndPosition]))
+      ruleEndPosition++;
+
+    // The first character must be kept so that the node is still parsed by
+    // the same rule.
+    if (ruleStartPosition >= editStartPosition ||
+        editEndPosition > ruleEndPosition)
+      return;
+
+    slots.push_back(
+        ReparsableSlot{&node, &parent, ruleStartPosition, ruleEndPosition});
+    node->Visit(*this);
+  }
+
+  const std::u32string &expression;
+  size_t editStartPosition;
+  size_t editEndPosition;
+  std::vector<ReparsableSlot> slots;
+};
+
+/**
+ * \brief Shift the locations of the nodes (and of their diagnostics) starting
+ * at or after a position, except in a given node (which was just parsed).
+ */
+class LocationsShifter : public gd::ExpressionParser2NodeWorker {
+ public:
+  LocationsShifter(size_t fromPosition_,
+                   std::ptrdiff_t delta_,
+                   const ExpressionNode *ignoredNode_)
+      : fromPosition(fromPosition_), delta(delta_), ignoredNode(ignoredNode_){};
+  virtual ~LocationsShifter(){};
+
+  void Shift(ExpressionNode &node) {
+    if (&node == ignoredNode) return;
+    node.Visit(*this);
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    ShiftNode(node);
+    Shift(*node.expression);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    ShiftNode(node);
+    Shift(*node.leftHandSide);
+    Shift(*node.rightHandSide);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    ShiftNode(node);
+    Shift(*node.factor);
+  }
+  void OnVisitNumberNode(NumberNode &node) override { ShiftNode(node); }
+  void OnVisitTextNode(TextNode &node) override { ShiftNode(node); }
+  void OnVisitVariableNode(VariableNode &node) override {
+    ShiftNode(node);
+    ShiftLocation(node.nameLocation);
+    if (node.child) Shift(*node.child);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    ShiftNode(node);
+    ShiftLocation(node.nameLocation);
+    ShiftLocation(node.dotLocation);
+    if (node.child) Shift(*node.child);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    ShiftNode(node);
+    Shift(*node.expression);
+    if (node.child) Shift(*node.child);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {
+    ShiftNode(node);
+    ShiftLocation(node.identifierNameLocation);
+    ShiftLocation(node.identifierNameDotLocation);
+    ShiftLocation(node.childIdentifierNameLocation);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {
+    ShiftNode(node);
+    ShiftLocation(node.objectNameLocation);
+    ShiftLocation(node.objectNameDotLocation);
+    ShiftLocation(node.objectFunctionOrBehaviorNameLocation);
+    ShiftLocation(node.behaviorNameNamespaceSeparatorLocation);
+    ShiftLocation(node.behaviorFunctionNameLocation);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    ShiftNode(node);
+    for (auto &parameter : node.parameters) Shift(*parameter);
+    ShiftLocation(node.functionNameLocation);
+    ShiftLocation(node.objectNameLocation);
+    ShiftLocation(node.objectNameDotLocation);
+    ShiftLocation(node.behaviorNameLocation);
+    ShiftLocation(node.behaviorNameNamespaceSeparatorLocation);
+    ShiftLocation(node.openingParenthesisLocation);
+    ShiftLocation(node.closingParenthesisLocation);
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override { ShiftNode(node); }
+
+ private:
+  size_t ShiftPosition(size_t position) {
+    return position >= fromPosition ? position + delta : position;
+  }
+
+  void ShiftLocation(ExpressionParserLocation &location) {
+    if (!location.IsValid()) return;
+    location = ExpressionParserLocation(
+        ShiftPosition(location.GetStartPosition()),
+        ShiftPosition(location.GetEndPosition()));
+  }
+
+  void ShiftNode(ExpressionNode &node) {
+    ShiftLocation(node.location);
+    if (!node.diagnostic) return;
+
+    ExpressionParserError &diagnostic = *node.diagnostic;
+    if (diagnostic.GetStartPosition() < fromPosition &&
+        diagnostic.GetEndPosition() < fromPosition)
+      return;
+
+    node.diagnostic = gd::make_unique<ExpressionParserError>(
+        diagnostic.GetType(),
+        diagnostic.GetMessage(),
+        ExpressionParserLocation(ShiftPosition(diagnostic.GetStartPosition()),
+                                 ShiftPosition(diagnostic.GetEndPosition())),
+        diagnostic.GetActualValue(),
+        diagnostic.GetObjectName());
+  }
+
+  size_t fromPosition;
+  std::ptrdiff_t delta;
+  const ExpressionNode *ignoredNode;
+};
+
+}  // namespace
+
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
-      currentPosition(0) {}
+    : currentPosition(0) {}
+
+std::unique_ptr<ExpressionNode> ExpressionParser2::ReparseExpression(
+    std::unique_ptr<ExpressionNode> previousNode,
+    const gd::String &previousExpression,
+    size_t editPosition,
+    size_t removedLength,
+    const gd::String &insertedText) {
+  std::u32string previousExpressionUTF32 = previousExpression.ToUTF32();
+  editPosition = std::min(editPosition, previousExpressionUTF32.size());
+  removedLength =
+      std::min(removedLength, previousExpressionUTF32.size() - editPosition);
+  std::u32string insertedTextUTF32 = insertedText.ToUTF32();
+
+  expression = previousExpressionUTF32;
+  expression.replace(editPosition, removedLength, insertedTextUTF32);
+  if (!previousNode) {
+    currentPosition = 0;
+    return Start();
+  }
+
+  ReparsableSlotsFinder slotsFinder(
+      previousExpressionUTF32, editPosition, editPosition + removedLength);
+  previousNode->Visit(slotsFinder);
+
+  // Parse again the innermost node containing the edit, and check that the
+  // parsing ends at the same place (otherwise, the edit changed more than this
+  // node, so try with the enclosing one).
+  std::ptrdiff_t delta = static_cast<std::ptrdiff_t>(insertedTextUTF32.size()) -
+                         static_cast<std::ptrdiff_t>(removedLength);
+  const auto &slots = slotsFinder.GetSlots();
+  for (auto it = slots.rbegin(); it != slots.rend(); ++it) {
+    currentPosition = it->ruleStartPosition;
+    auto node = Expression();
+    if (currentPosition != it->ruleEndPosition + delta) continue;
+
+    node->parent = it->parent;
+    *it->node = std::move(node);
+
+    LocationsShifter shifter(it->ruleEndPosition, delta, it->node->get());
+    shifter.Shift(*previousNode);
+    return previousNode;
+  }
+
+  currentPosition = 0;
+  return Start();
+}
 
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
   size_t textStartPosition = GetCurrentPosition();
@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -55,12 +56,38 @@ class GD_CORE_API ExpressionParser2 {
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
     return Start();
   }
 
+  /**
+   * Parse the expression obtained by editing a previously parsed expression,
+   * reusing the tree of the previous expression.
+   *
+   * Only the innermost function parameter, sub-expression (between
+   * parenthesis) or expression between brackets containing the edit is parsed
+   * again (if it still ends at the same place), and the locations of the nodes
+   * after it are shifted. Otherwise, the whole expression is parsed again.
+   * In both cases, the tree is the same as the one given by ParseExpression.
+   *
+   * \param previousNode The tree of the previous expression. It is modified
+   * and returned, unless the whole expression is parsed again.
+   * \param previousExpression The previous expression.
+   * \param editPosition The position (in characters) of the edit.
+   * \param removedLength The number of characters removed at this position.
+   * \param insertedText The text inserted at this position.
+   *
+   * \return The node representing the edited expression as a parsed tree.
+   */
+  std::unique_ptr<ExpressionNode> ReparseExpression(
+      std::unique_ptr<ExpressionNode> previousNode,
+      const gd::String &previousExpression,
+      size_t editPosition,
+      size_t removedLength,
+      const gd::String &insertedText);
+
   /**
    * Given an object name (or empty if none) and a behavior name (or empty if
    * none), return the index of the first parameter that is inside the
@@ -90,6 +117,7 @@ class GD_CORE_API ExpressionParser2 {
     if (!IsEndReached()) {
       auto op = gd::make_unique<OperatorNode>(' ');
       op->leftHandSide = std::move(expression);
+      op->leftHandSide->parent = op.get();
       op->rightHandSide = ReadUntilEnd();
       op->rightHandSide->parent = op.get();
 
@@ -224,6 +252,7 @@ class GD_CORE_API ExpressionParser2 {
 
     auto subExpression =
         gd::make_unique<SubExpressionNode>(std::move(expression));
+    subExpression->expression->parent = subExpression.get();
     subExpression->location =
         ExpressionParserLocation(expressionStartPosition, GetCurrentPosition());
 
@@ -622,8 +651,9 @@ class GD_CORE_API ExpressionParser2 {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
     return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+            expression.compare(currentPosition,
+                               NAMESPACE_SEPARATOR.size(),
+                               NAMESPACE_SEPARATOR.ToUTF32()) == 0);
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -731,7 +761,8 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
+  std::u32string expression;  ///< The expression being parsed, with a
+                              /// character at each index.
   std::size_t currentPosition;
 
   static gd::String NAMESPACE_SEPARATOR;
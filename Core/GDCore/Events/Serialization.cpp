@@ -230,16 +230,18 @@ void EventsListSerialization::SerializeEventsTo(const EventsList& list,
                                                 SerializerElement& events) {
   events.ConsiderAsArrayOf("event");
   for (std::size_t j = 0; j < list.size(); j++) {
-    const gd::BaseEvent& event = list.GetEvent(j);
-    SerializerElement& eventElem = events.AddChild("event");
+    SerializeEventTo(list.GetEvent(j), events.AddChild("event"));
+  }
+}
 
-    if (event.IsDisabled())
-      eventElem.SetAttribute("disabled", event.IsDisabled());
-    if (event.IsFolded()) eventElem.SetAttribute("folded", event.IsFolded());
-    eventElem.AddChild("type").SetValue(event.GetType());
+void EventsListSerialization::SerializeEventTo(const gd::BaseEvent& event,
+                                               SerializerElement& eventElem) {
+  if (event.IsDisabled())
+    eventElem.SetAttribute("disabled", event.IsDisabled());
+  if (event.IsFolded()) eventElem.SetAttribute("folded", event.IsFolded());
+  eventElem.AddChild("type").SetValue(event.GetType());
 
-    event.SerializeTo(eventElem);
-  }
+  event.SerializeTo(eventElem);
 }
 
 using namespace std;
@@ -257,26 +259,16 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
   // end of compatibility code
 
   for (std::size_t i = 0; i < elem.GetChildrenCount(); ++i) {
-    gd::Instruction instruction;
     const SerializerElement& instrElement = elem.GetChild(i);
-
-    instruction.SetType(
-        instrElement.GetChild("type", 0, "Type")
-            .GetStringAttribute("value")
-            .FindAndReplace("Automatism",
-                            "Behavior"));  // Compatibility with GD <= 4
-    instruction.SetInverted(
-        instrElement.GetChild("type", 0, "Type")
-            .GetBoolAttribute("inverted", false, "Contraire"));
-
-    instruction.SetAwaited(
-        instrElement.GetChild("type", 0, "Type").GetBoolAttribute("await"));
+    const SerializerElement& typeElement =
+        instrElement.GetChild("type", 0, "Type");
 
     // Read parameters
     vector<gd::Expression> parameters;
 
     // Compatibility with GD <= 3.3
     if (instrElement.HasChild("Parametre")) {
+      parameters.reserve(instrElement.GetChildrenCount("Parametre"));
       for (std::size_t j = 0; j < instrElement.GetChildrenCount("Parametre");
            ++j)
         parameters.push_back(gd::Expression(
@@ -288,12 +280,20 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
       const SerializerElement& parametersElem =
           instrElement.GetChild("parameters");
       parametersElem.ConsiderAsArrayOf("parameter");
+      parameters.reserve(parametersElem.GetChildrenCount());
       for (std::size_t j = 0; j < parametersElem.GetChildrenCount(); ++j)
         parameters.push_back(
             gd::Expression(parametersElem.GetChild(j).GetValue().GetString()));
     }
 
-    instruction.SetParameters(parameters);
+    // Parameters are moved, so that they are stored contiguously and without
+    // extra capacity.
+    gd::Instruction instruction(
+        typeElement.GetStringAttribute("value").FindAndReplace(
+            "Automatism", "Behavior"),  // Compatibility with GD <= 4
+        std::move(parameters),
+        typeElement.GetBoolAttribute("inverted", false, "Contraire"));
+    instruction.SetAwaited(typeElement.GetBoolAttribute("await"));
 
     // Read sub instructions
     if (instrElement.HasChild("subInstructions"))
@@ -313,7 +313,7 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
           instrElement.GetChild("subActions", 0, "SubActions"));
     // end of compatibility code
 
-    instructions.Insert(instruction);
+    instructions.Insert(std::move(instruction));
   }
 
   // Compatibility with GD <= 3.1
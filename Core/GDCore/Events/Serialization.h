@@ -15,6 +15,7 @@ class Project;
 }
 namespace gd {
 class EventsList;
+class BaseEvent;
 }
 
 namespace gd {
@@ -42,6 +43,15 @@ class GD_CORE_API EventsListSerialization {
   static void SerializeEventsTo(const gd::EventsList& list,
                                 SerializerElement& events);
 
+  /**
+   * \brief Save an event to a SerializerElement
+   * \param event The event to be saved.
+   * \param eventElement The SerializerElement in which the event must be
+   * serialized.
+   */
+  static void SerializeEventTo(const gd::BaseEvent& event,
+                               SerializerElement& eventElement);
+
   /**
    * \brief Unserialize a list of instructions
    */
@@ -32,7 +32,8 @@ gd::PlatformExtension MetadataProvider::badExtension;
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
+  platform.DeclareExtensionsForType(behaviorType);
+  for (auto& extension : platform.GetDeclaredPlatformExtensions()) {
     if (extension->HasBehavior(behaviorType))
       return ExtensionAndMetadata<BehaviorMetadata>(
           *extension, extension->GetBehaviorMetadata(behaviorType));
@@ -49,7 +50,8 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
+  platform.DeclareExtensionsForType(objectType);
+  for (auto& extension : platform.GetDeclaredPlatformExtensions()) {
     auto objectsTypes = extension->GetExtensionObjectsTypes();
     for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
       if (objectsTypes[j] == objectType)
@@ -69,7 +71,8 @@ const ObjectMetadata& MetadataProvider::GetObjectMetadata(
 ExtensionAndMetadata<EffectMetadata>
 MetadataProvider::GetExtensionAndEffectMetadata(const gd::Platform& platform,
                                                 gd::String type) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
+  platform.DeclareExtensionsForType(type);
+  for (auto& extension : platform.GetDeclaredPlatformExtensions()) {
     auto objectsTypes = extension->GetExtensionEffectTypes();
     for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
       if (objectsTypes[j] == type)
@@ -89,7 +92,8 @@ const EffectMetadata& MetadataProvider::GetEffectMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(actionType);
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allActions = extension->GetAllActions();
     if (allActions.find(actionType) != allActions.end())
@@ -127,7 +131,8 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(conditionType);
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allConditions = extension->GetAllConditions();
     if (allConditions.find(conditionType) != allConditions.end())
@@ -166,7 +171,9 @@ const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(objectType);
+  platform.DeclareExtensionsForType("");
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& objects = extension->GetExtensionObjectsTypes();
     if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
@@ -200,7 +207,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(autoType);
+  platform.DeclareExtensionsForType("");
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     if (extension->HasBehavior(autoType)) {
       const auto& allAutoExpressions =
@@ -233,7 +242,8 @@ const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(exprType);
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allExpr = extension->GetAllExpressions();
     if (allExpr.find(exprType) != allExpr.end())
@@ -253,7 +263,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(objectType);
+  platform.DeclareExtensionsForType("");
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& objects = extension->GetExtensionObjectsTypes();
     if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
@@ -289,7 +301,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(autoType);
+  platform.DeclareExtensionsForType("");
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     if (extension->HasBehavior(autoType)) {
       const auto& allBehaviorStrExpressions =
@@ -327,7 +341,8 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+  platform.DeclareExtensionsForType(exprType);
+  auto& extensions = platform.GetDeclaredPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allExpr = extension->GetAllStrExpressions();
     if (allExpr.find(exprType) != allExpr.end())
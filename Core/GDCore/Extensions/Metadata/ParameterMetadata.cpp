@@ -29,7 +29,7 @@ void ParameterMetadata::UnserializeFrom(const SerializerElement& element) {
   description = element.GetStringAttribute("description");
   longDescription = element.GetStringAttribute("longDescription");
   codeOnly = element.GetBoolAttribute("codeOnly");
-  name = element.GetStringAttribute("name");
+  SetName(element.GetStringAttribute("name"));
 }
 
 }  // namespace gd
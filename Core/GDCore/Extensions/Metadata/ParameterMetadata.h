@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 #include "GDCore/Extensions/Metadata/ValueTypeMetadata.h"
 
 namespace gd {
@@ -86,6 +87,7 @@ class GD_CORE_API ParameterMetadata {
    * be named.
    */
   ParameterMetadata &SetName(const gd::String &name_) {
+    if (name_ != name) nameIndexLink.NotifyRenamed();
     name = name_;
     return *this;
   }
@@ -247,10 +249,15 @@ class GD_CORE_API ParameterMetadata {
   bool codeOnly;  ///< True if parameter is relative to code generation only,
                   ///< i.e. must not be shown in editor
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   gd::ValueTypeMetadata valueTypeMetadata; ///< Parameter type
   gd::String longDescription;  ///< Long description shown in the editor.
   gd::String name;             ///< The name of the parameter to be used in code
                                ///< generation. Optional.
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
 };
 
 }  // namespace gd
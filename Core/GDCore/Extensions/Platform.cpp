@@ -5,6 +5,8 @@
  */
 #include "Platform.h"
 
+#include <algorithm>
+
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
@@ -54,7 +56,69 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   return true;
 }
 
+void Platform::AddDeferredExtension(
+    const gd::String& name,
+    const std::vector<gd::String>& typesNamespaces,
+    std::function<std::shared_ptr<PlatformExtension>()> createExtension) {
+  if (IsExtensionLoaded(name)) RemoveExtension(name);
+
+  DeferredExtension deferredExtension;
+  deferredExtension.name = name;
+  deferredExtension.typesNamespaces = typesNamespaces;
+  deferredExtension.createExtension = createExtension;
+  deferredExtensions.push_back(std::move(deferredExtension));
+}
+
+void Platform::DeclareDeferredExtensions(
+    std::function<bool(const DeferredExtension&)> predicate) const {
+  std::vector<DeferredExtension> extensionsToDeclare;
+  // Platform is never const itself, only the methods searching in
+  // its extensions are.
+  auto& mutableThis = const_cast<Platform&>(*this);
+  auto& remainingExtensions = mutableThis.deferredExtensions;
+  for (std::size_t i = 0; i < remainingExtensions.size();) {
+    if (predicate(remainingExtensions[i])) {
+      extensionsToDeclare.push_back(std::move(remainingExtensions[i]));
+      remainingExtensions.erase(remainingExtensions.begin() + i);
+    } else {
+      ++i;
+    }
+  }
+
+  for (auto& deferredExtension : extensionsToDeclare) {
+    mutableThis.AddExtension(deferredExtension.createExtension());
+  }
+}
+
+void Platform::DeclareExtensionsForType(const gd::String& type) const {
+  if (deferredExtensions.empty()) return;
+
+  const gd::String typeNamespace =
+      PlatformExtension::GetExtensionFromFullObjectType(type);
+  DeclareDeferredExtensions(
+      [&typeNamespace](const DeferredExtension& deferredExtension) {
+        const auto& namespaces = deferredExtension.typesNamespaces;
+        return std::find(namespaces.begin(), namespaces.end(),
+                         typeNamespace) != namespaces.end();
+      });
+}
+
+void Platform::DeclareAllExtensions() const {
+  if (deferredExtensions.empty()) return;
+
+  DeclareDeferredExtensions(
+      [](const DeferredExtension& deferredExtension) { return true; });
+}
+
 void Platform::RemoveExtension(const gd::String& name) {
+  deferredExtensions.erase(
+      remove_if(deferredExtensions.begin(),
+                deferredExtensions.end(),
+                [&name](const DeferredExtension& deferredExtension) {
+                  return deferredExtension.name == name;
+                }),
+      deferredExtensions.end());
+
   // Unload all creation/destruction functions for objects provided by the
   // extension
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
@@ -80,12 +144,22 @@ bool Platform::IsExtensionLoaded(const gd::String& name) const {
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return true;
   }
+  for (const auto& deferredExtension : deferredExtensions) {
+    if (deferredExtension.name == name) return true;
+  }
 
   return false;
 }
 
 std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
     const gd::String& name) const {
+  if (!deferredExtensions.empty()) {
+    DeclareDeferredExtensions(
+        [&name](const DeferredExtension& deferredExtension) {
+          return deferredExtension.name == name;
+        });
+  }
+
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return extensionsLoaded[i];
   }
@@ -95,7 +169,9 @@ std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
 
 std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
     gd::String type) const {
+  DeclareExtensionsForType(type);
   if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
+    DeclareExtensionsForType("");
     gd::LogWarning("Tried to create an object configuration with an unknown type: " + type
               + " for platform " + GetName() + "!");
     type = "";
@@ -114,6 +190,7 @@ std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
 #if defined(GD_IDE_ONLY)
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
+  DeclareExtensionsForType(eventType);
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     std::shared_ptr<gd::BaseEvent> event =
         extensionsLoaded[i]->CreateEvent(eventType);
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_PLATFORM_H
 #define GDCORE_PLATFORM_H
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -96,8 +97,38 @@ class GD_CORE_API Platform {
    */
   virtual bool AddExtension(std::shared_ptr<PlatformExtension> extension);
 
+  /**
+   * \brief Add an extension to the platform, without creating it: it will be
+   * created and added (see AddExtension) the first time it's needed.
+   *
+   * \param name The name of the extension.
+   * \param typesNamespaces The namespaces of the types (objects, behaviors,
+   * instructions, expressions, events...) declared by the extension, i.e: the
+   * part before "::" (for example "TextObject") or an empty string for types
+   * without a namespace.
+   * \param createExtension The function creating the extension.
+   *
+   * \see DeclareExtensionsForType
+   */
+  void AddDeferredExtension(
+      const gd::String& name,
+      const std::vector<gd::String>& typesNamespaces,
+      std::function<std::shared_ptr<PlatformExtension>()> createExtension);
+
+  /**
+   * \brief Create and add the deferred extensions declaring types in the same
+   * namespace as the given type.
+   */
+  void DeclareExtensionsForType(const gd::String& type) const;
+
+  /**
+   * \brief Create and add all the deferred extensions.
+   */
+  void DeclareAllExtensions() const;
+
   /**
    * \brief Return true if an extension with the specified name is loaded
+   * (or deferred).
    */
   bool IsExtensionLoaded(const gd::String& name) const;
 
@@ -109,10 +140,24 @@ class GD_CORE_API Platform {
 
   /**
    * \brief Get all extensions loaded for the platform.
+   *
+   * \note Deferred extensions are all created first.
    * @return Vector of Shared pointer containing all extensions
    */
   const std::vector<std::shared_ptr<gd::PlatformExtension>>&
   GetAllPlatformExtensions() const {
+    DeclareAllExtensions();
+    return extensionsLoaded;
+  };
+
+  /**
+   * \brief Get the extensions loaded for the platform, without the deferred
+   * extensions that were not created yet.
+   *
+   * \see DeclareExtensionsForType
+   */
+  const std::vector<std::shared_ptr<gd::PlatformExtension>>&
+  GetDeclaredPlatformExtensions() const {
     return extensionsLoaded;
   };
 
@@ -130,6 +175,7 @@ class GD_CORE_API Platform {
    */
   const InstructionOrExpressionGroupMetadata& GetInstructionOrExpressionGroupMetadata(
       const gd::String& name) const {
+    DeclareAllExtensions();
     auto it = instructionOrExpressionGroupMetadata.find(name);
     if (it == instructionOrExpressionGroupMetadata.end())
       return badInstructionOrExpressionGroupMetadata;
@@ -166,8 +212,23 @@ class GD_CORE_API Platform {
   };
 
  private:
+  struct DeferredExtension {
+    gd::String name;
+    std::vector<gd::String> typesNamespaces;
+    std::function<std::shared_ptr<PlatformExtension>()> createExtension;
+  };
+
+  /**
+   * \brief Create and add the deferred extensions matching the predicate, in
+   * the order they were added.
+   */
+  void DeclareDeferredExtensions(
+      std::function<bool(const DeferredExtension&)> predicate) const;
+
   std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
+  std::vector<DeferredExtension>
+      deferredExtensions;  ///< Extensions of the platform not created yet
   std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
   std::map<gd::String, InstructionOrExpressionGroupMetadata>
@@ -5,6 +5,9 @@
  */
 
 #include "AbstractFileSystem.h"
+
+#include <cstdio>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/String.h"
 
@@ -18,4 +21,25 @@ gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   return filename.FindAndReplace("\\", "/");
 }
 
+gd::String AbstractFileSystem::GetFileContentHash(const gd::String& file) {
+  if (!FileExists(file)) return "";
+
+  // 64 bits FNV-1a hash of the content, with the size appended to make
+  // collisions even less likely.
+  const gd::String content = ReadFile(file);
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char byte : content.Raw()) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+
+  char hashString[40];
+  std::snprintf(hashString,
+                sizeof(hashString),
+                "%016llx-%llx",
+                static_cast<unsigned long long>(hash),
+                static_cast<unsigned long long>(content.Raw().size()));
+  return hashString;
+}
+
 }  // namespace gd
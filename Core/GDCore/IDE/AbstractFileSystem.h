@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <cstdint>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -123,6 +124,35 @@ class GD_CORE_API AbstractFileSystem {
   virtual std::vector<gd::String> ReadDir(const gd::String& path,
                                           const gd::String& extension = "") = 0;
 
+  /**
+   * \brief Get the size and the last modification time of a file.
+   *
+   * This is used to know if a file changed since the last time it was read
+   * (for example to cache the hash of its content).
+   *
+   * \return true if the information could be read, false otherwise (this
+   * is the case for file systems not supporting it).
+   */
+  virtual bool GetFileStats(const gd::String& file,
+                            std::size_t& size,
+                            std::int64_t& lastModificationTime) {
+    return false;
+  };
+
+  /**
+   * \brief Return a hash of the content of a file, used to detect identical
+   * files.
+   *
+   * The default implementation hashes the content returned by ReadFile. File
+   * systems not able to read binary files without altering them must override
+   * this method.
+   *
+   * \return The hash as an hexadecimal string, or an empty string if the file
+   * could not be read (so that it's never considered as identical to another
+   * file).
+   */
+  virtual gd::String GetFileContentHash(const gd::String& file);
+
  protected:
   AbstractFileSystem(){};
 };
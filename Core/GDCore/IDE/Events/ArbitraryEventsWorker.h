@@ -21,6 +21,7 @@ class EventsList;
 class ObjectsContainer;
 class Expression;
 class ParameterMetadata;
+class FusedEventsWorker;
 }  // namespace gd
 
 namespace gd {
@@ -50,6 +51,8 @@ protected:
   bool VisitInstruction(gd::Instruction& instruction, bool isCondition);
   bool VisitEventExpression(gd::Expression& expression, const gd::ParameterMetadata& metadata);
 
+  friend class gd::FusedEventsWorker;
+
   /**
    * Called to do some work on an event list.
    */
@@ -164,6 +167,8 @@ protected:
  private:
   bool VisitEvent(gd::BaseEvent& event) override;
 
+  friend class gd::FusedEventsWorker;
+
   const gd::ProjectScopedContainers* currentProjectScopedContainers;
 };
 
@@ -254,6 +259,28 @@ public:
     AbstractReadOnlyArbitraryEventsWorker::VisitEventList(events);
   };
 
+  /**
+   * \brief Create a new worker, without any result, that can browse a part
+   * of the events on another thread.
+   *
+   * Return nullptr by default, for workers that can't be used on several
+   * threads: all the events are then browsed by this worker.
+   *
+   * \see gd::ProjectBrowserHelper::ExposeProjectEventsInParallel
+   */
+  virtual std::unique_ptr<ReadOnlyArbitraryEventsWorker>
+  CloneForParallelBrowsing() const {
+    return nullptr;
+  };
+
+  /**
+   * \brief Add to this worker the results of a worker created by
+   * CloneForParallelBrowsing.
+   *
+   * Workers are merged in the order of the events they browsed.
+   */
+  virtual void MergeParallelResults(ReadOnlyArbitraryEventsWorker &worker){};
+
 private:
   void VisitEvent(const gd::BaseEvent &event) override;
 };
@@ -0,0 +1,56 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Expression;
+class Instruction;
+class ObjectsContainer;
+class ParameterMetadata;
+class Platform;
+class ValueTypeMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Replace in expressions and in parameters of actions or conditions,
+ * references to the name of an object by another.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsObjectReplacer
+    : public ArbitraryEventsWorkerWithContext {
+public:
+  EventsObjectReplacer(const gd::Platform &platform_,
+                       const gd::ObjectsContainer &targetedObjectsContainer_,
+                       const gd::String &oldObjectName_,
+                       const gd::String &newObjectName_)
+      : platform(platform_),
+        targetedObjectsContainer(targetedObjectsContainer_),
+        oldObjectName(oldObjectName_), newObjectName(newObjectName_){};
+
+  virtual ~EventsObjectReplacer();
+
+private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override;
+
+  bool DoVisitEventExpression(gd::Expression &expression,
+                              const gd::ParameterMetadata &metadata) override;
+
+  bool CanContainObject(const gd::ValueTypeMetadata &valueTypeMetadata);
+
+  const gd::Platform &platform;
+  const gd::ObjectsContainer &targetedObjectsContainer;
+  const gd::String &oldObjectName;
+  const gd::String &newObjectName;
+};
+
+}  // namespace gd
@@ -16,6 +16,8 @@
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/EventsObjectReplacer.h"
+#include "GDCore/IDE/Events/EventsSearchIndex.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
 #include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
 #include "GDCore/Project/ObjectsContainer.h"
@@ -296,105 +298,82 @@ class GD_CORE_API ExpressionObjectFinder : public ExpressionParser2NodeWorker {
   const gd::String rootType;
 };
 
-/**
- * \brief Replace in expressions and in parameters of actions or conditions,
- * references to the name of an object by another.
- *
- * \ingroup IDE
- */
-class GD_CORE_API EventsObjectReplacer
-    : public ArbitraryEventsWorkerWithContext {
-public:
-  EventsObjectReplacer(const gd::Platform &platform_,
-                       const gd::ObjectsContainer &targetedObjectsContainer_,
-                       const gd::String &oldObjectName_,
-                       const gd::String &newObjectName_)
-      : platform(platform_),
-        targetedObjectsContainer(targetedObjectsContainer_),
-        oldObjectName(oldObjectName_), newObjectName(newObjectName_){};
-
-  virtual ~EventsObjectReplacer() {}
-
-private:
-  bool DoVisitInstruction(gd::Instruction &instruction,
-                          bool isCondition) override {
-    if (&targetedObjectsContainer !=
-        GetProjectScopedContainers()
-            .GetObjectsContainersList()
-            .GetObjectsContainerFromObjectName(oldObjectName)) {
-      return false;
-    }
-    const auto &metadata = isCondition
-                               ? gd::MetadataProvider::GetConditionMetadata(
-                                     platform, instruction.GetType())
-                               : gd::MetadataProvider::GetActionMetadata(
-                                     platform, instruction.GetType());
-
-    gd::ParameterMetadataTools::IterateOverParametersWithIndex(
-        instruction.GetParameters(), metadata.GetParameters(),
-        [&](const gd::ParameterMetadata &parameterMetadata,
-            const gd::Expression &parameterValue, size_t parameterIndex,
-            const gd::String &lastObjectName) {
-          if (!gd::EventsObjectReplacer::CanContainObject(
-                  parameterMetadata.GetValueTypeMetadata())) {
-            return;
-          }
-          auto node = parameterValue.GetRootNode();
-          if (node) {
-            ExpressionObjectRenamer renamer(
-                platform, GetProjectScopedContainers(),
-                parameterMetadata.GetValueTypeMetadata().GetName(),
-                oldObjectName, newObjectName);
-            node->Visit(renamer);
-
-            if (renamer.HasDoneRenaming()) {
-              instruction.SetParameter(
-                  parameterIndex,
-                  ExpressionParser2NodePrinter::PrintNode(*node));
-            }
-          }
-        });
+EventsObjectReplacer::~EventsObjectReplacer() {}
 
+bool EventsObjectReplacer::DoVisitInstruction(gd::Instruction &instruction,
+                                              bool isCondition) {
+  if (&targetedObjectsContainer !=
+      GetProjectScopedContainers()
+          .GetObjectsContainersList()
+          .GetObjectsContainerFromObjectName(oldObjectName)) {
     return false;
   }
+  const auto &metadata = isCondition
+                             ? gd::MetadataProvider::GetConditionMetadata(
+                                   platform, instruction.GetType())
+                             : gd::MetadataProvider::GetActionMetadata(
+                                   platform, instruction.GetType());
 
-  bool DoVisitEventExpression(gd::Expression &expression,
-                              const gd::ParameterMetadata &metadata) override {
-    if (&targetedObjectsContainer !=
-        GetProjectScopedContainers()
-            .GetObjectsContainersList()
-            .GetObjectsContainerFromObjectName(oldObjectName)) {
-      return false;
-    }
-    if (!gd::EventsObjectReplacer::CanContainObject(
-            metadata.GetValueTypeMetadata())) {
-      return false;
-    }
-    auto node = expression.GetRootNode();
-    if (node) {
-      ExpressionObjectRenamer renamer(platform, GetProjectScopedContainers(),
-                                      metadata.GetValueTypeMetadata().GetName(),
-                                      oldObjectName, newObjectName);
-      node->Visit(renamer);
-
-      if (renamer.HasDoneRenaming()) {
-        expression = ExpressionParser2NodePrinter::PrintNode(*node);
-      }
-    }
+  gd::ParameterMetadataTools::IterateOverParametersWithIndex(
+      instruction.GetParameters(), metadata.GetParameters(),
+      [&](const gd::ParameterMetadata &parameterMetadata,
+          const gd::Expression &parameterValue, size_t parameterIndex,
+          const gd::String &lastObjectName) {
+        if (!gd::EventsObjectReplacer::CanContainObject(
+                parameterMetadata.GetValueTypeMetadata())) {
+          return;
+        }
+        auto node = parameterValue.GetRootNode();
+        if (node) {
+          ExpressionObjectRenamer renamer(
+              platform, GetProjectScopedContainers(),
+              parameterMetadata.GetValueTypeMetadata().GetName(),
+              oldObjectName, newObjectName);
+          node->Visit(renamer);
+
+          if (renamer.HasDoneRenaming()) {
+            instruction.SetParameter(
+                parameterIndex,
+                ExpressionParser2NodePrinter::PrintNode(*node));
+          }
+        }
+      });
+
+  return false;
+}
 
+bool EventsObjectReplacer::DoVisitEventExpression(
+    gd::Expression &expression, const gd::ParameterMetadata &metadata) {
+  if (&targetedObjectsContainer !=
+      GetProjectScopedContainers()
+          .GetObjectsContainersList()
+          .GetObjectsContainerFromObjectName(oldObjectName)) {
     return false;
   }
-
-  bool CanContainObject(const gd::ValueTypeMetadata &valueTypeMetadata) {
-    return valueTypeMetadata.IsObject() || valueTypeMetadata.IsVariable() ||
-           valueTypeMetadata.IsNumber() || valueTypeMetadata.IsString();
+  if (!gd::EventsObjectReplacer::CanContainObject(
+          metadata.GetValueTypeMetadata())) {
+    return false;
+  }
+  auto node = expression.GetRootNode();
+  if (node) {
+    ExpressionObjectRenamer renamer(platform, GetProjectScopedContainers(),
+                                    metadata.GetValueTypeMetadata().GetName(),
+                                    oldObjectName, newObjectName);
+    node->Visit(renamer);
+
+    if (renamer.HasDoneRenaming()) {
+      expression = ExpressionParser2NodePrinter::PrintNode(*node);
+    }
   }
 
-  const gd::Platform &platform;
-  const gd::ObjectsContainer &targetedObjectsContainer;
-  const gd::String &oldObjectName;
-  const gd::String &newObjectName;
-};
+  return false;
+}
+
+bool EventsObjectReplacer::CanContainObject(
+    const gd::ValueTypeMetadata &valueTypeMetadata) {
+  return valueTypeMetadata.IsObject() || valueTypeMetadata.IsVariable() ||
+         valueTypeMetadata.IsNumber() || valueTypeMetadata.IsString();
+}
 
 void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                             const gd::ProjectScopedContainers& projectScopedContainers,
@@ -549,90 +528,88 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
   vector<EventsSearchResult> modifiedEvents;
   if (toReplace.empty()) return modifiedEvents;
 
-  for (std::size_t i = 0; i < events.size(); ++i) {
-    bool eventModified = false;
-
-    auto allExpressionsWithMetadata = events[i].GetAllExpressionsWithMetadata();
-    for (auto& expressionAndMetadata : allExpressionsWithMetadata) {
-      gd::Expression* expression = expressionAndMetadata.first;
-
-      gd::String newExpressionPlainString =
-          matchCase ? expression->GetPlainString().FindAndReplace(
-                          toReplace, newString, true)
-                    : ReplaceAllOccurrencesCaseInsensitive(
-                          expression->GetPlainString(),
-                          toReplace,
-                          newString);
-
-      if (newExpressionPlainString != expression->GetPlainString()) {
-        *expression = gd::Expression(newExpressionPlainString);
+  ReplaceStringInEventsList(project,
+                            layout,
+                            events,
+                            toReplace,
+                            newString,
+                            matchCase,
+                            inConditions,
+                            inActions,
+                            inEventStrings,
+                            nullptr,
+                            modifiedEvents);
+  return modifiedEvents;
+}
 
-        if (!eventModified) {
-          modifiedEvents.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-          eventModified = true;
-        }
-      }
-    }
+std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
+    gd::ObjectsContainer& project,
+    gd::ObjectsContainer& layout,
+    gd::EventsList& events,
+    gd::EventsSearchIndex& index,
+    gd::String toReplace,
+    gd::String newString,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings) {
+  vector<EventsSearchResult> modifiedEvents;
+  if (toReplace.empty()) return modifiedEvents;
 
-    if (inConditions) {
-      vector<gd::InstructionsList*> conditionsVectors =
-          events[i].GetAllConditionsVectors();
-      for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
-        bool conditionsModified =
-            ReplaceStringInConditions(project,
-                                      layout,
-                                      *conditionsVectors[j],
-                                      toReplace,
-                                      newString,
-                                      matchCase);
-        if (conditionsModified && !eventModified) {
-          modifiedEvents.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-          eventModified = true;
-        }
-      }
-    }
+  gd::EventsSearchCandidates candidates =
+      index.GetCandidates(toReplace, matchCase);
+  ReplaceStringInEventsList(project,
+                            layout,
+                            events,
+                            toReplace,
+                            newString,
+                            matchCase,
+                            inConditions,
+                            inActions,
+                            inEventStrings,
+                            &candidates,
+                            modifiedEvents);
+
+  // The index is updated once all the events were browsed, as candidates
+  // are only valid until then.
+  for (const auto& modifiedEvent : modifiedEvents)
+    index.UpdateEvent(modifiedEvent.GetEventsList(),
+                      modifiedEvent.GetPositionInList());
 
-    if (inActions) {
-      vector<gd::InstructionsList*> actionsVectors =
-          events[i].GetAllActionsVectors();
-      for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
-        bool actionsModified = ReplaceStringInActions(project,
-                                                      layout,
-                                                      *actionsVectors[j],
-                                                      toReplace,
-                                                      newString,
-                                                      matchCase);
-        if (actionsModified && !eventModified) {
-          modifiedEvents.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-          eventModified = true;
-        }
-      }
-    }
+  return modifiedEvents;
+}
 
-    if (inEventStrings) {
-      bool eventStringModified = ReplaceStringInEventSearchableStrings(
-          project, layout, events[i], toReplace, newString, matchCase);
-      if (eventStringModified && !eventModified) {
-        modifiedEvents.push_back(EventsSearchResult(
-            std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-            &events,
-            i));
-        eventModified = true;
-      }
+void EventsRefactorer::ReplaceStringInEventsList(
+    gd::ObjectsContainer& project,
+    gd::ObjectsContainer& layout,
+    gd::EventsList& events,
+    const gd::String& toReplace,
+    const gd::String& newString,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    const gd::EventsSearchCandidates* candidates,
+    std::vector<EventsSearchResult>& modifiedEvents) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    if ((!candidates || candidates->MayMatch(events[i])) &&
+        ReplaceStringInEvent(project,
+                             layout,
+                             events[i],
+                             toReplace,
+                             newString,
+                             matchCase,
+                             inConditions,
+                             inActions,
+                             inEventStrings)) {
+      modifiedEvents.push_back(EventsSearchResult(
+          std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
+          &events,
+          i));
     }
 
     if (events[i].CanHaveSubEvents()) {
-      std::vector<EventsSearchResult> modifiedSubEvent =
-          ReplaceStringInEvents(project,
+      ReplaceStringInEventsList(project,
                                 layout,
                                 events[i].GetSubEvents(),
                                 toReplace,
@@ -640,13 +617,74 @@ std::vector<EventsSearchResult> EventsRefactorer::ReplaceStringInEvents(
                                 matchCase,
                                 inConditions,
                                 inActions,
-                                inEventStrings);
-      std::copy(modifiedSubEvent.begin(),
-                modifiedSubEvent.end(),
-                std::back_inserter(modifiedEvents));
+                                inEventStrings,
+                                candidates,
+                                modifiedEvents);
     }
   }
-  return modifiedEvents;
+}
+
+bool EventsRefactorer::ReplaceStringInEvent(gd::ObjectsContainer& project,
+                                            gd::ObjectsContainer& layout,
+                                            gd::BaseEvent& event,
+                                            const gd::String& toReplace,
+                                            const gd::String& newString,
+                                            bool matchCase,
+                                            bool inConditions,
+                                            bool inActions,
+                                            bool inEventStrings) {
+  bool eventModified = false;
+
+  auto allExpressionsWithMetadata = event.GetAllExpressionsWithMetadata();
+  for (auto& expressionAndMetadata : allExpressionsWithMetadata) {
+    gd::Expression* expression = expressionAndMetadata.first;
+
+    gd::String newExpressionPlainString =
+        matchCase ? expression->GetPlainString().FindAndReplace(
+                        toReplace, newString, true)
+                  : ReplaceAllOccurrencesCaseInsensitive(
+                        expression->GetPlainString(), toReplace, newString);
+
+    if (newExpressionPlainString != expression->GetPlainString()) {
+      *expression = gd::Expression(newExpressionPlainString);
+      eventModified = true;
+    }
+  }
+
+  if (inConditions) {
+    vector<gd::InstructionsList*> conditionsVectors =
+        event.GetAllConditionsVectors();
+    for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
+      bool conditionsModified = ReplaceStringInConditions(project,
+                                                          layout,
+                                                          *conditionsVectors[j],
+                                                          toReplace,
+                                                          newString,
+                                                          matchCase);
+      if (conditionsModified) eventModified = true;
+    }
+  }
+
+  if (inActions) {
+    vector<gd::InstructionsList*> actionsVectors = event.GetAllActionsVectors();
+    for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
+      bool actionsModified = ReplaceStringInActions(project,
+                                                    layout,
+                                                    *actionsVectors[j],
+                                                    toReplace,
+                                                    newString,
+                                                    matchCase);
+      if (actionsModified) eventModified = true;
+    }
+  }
+
+  if (inEventStrings) {
+    bool eventStringModified = ReplaceStringInEventSearchableStrings(
+        project, layout, event, toReplace, newString, matchCase);
+    if (eventStringModified) eventModified = true;
+  }
+
+  return eventModified;
 }
 
 bool EventsRefactorer::ReplaceStringInActions(gd::ObjectsContainer& project,
@@ -760,11 +798,52 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     bool inEventStrings,
     bool inEventSentences) {
   vector<EventsSearchResult> results;
+  SearchInEventsList(platform,
+                     events,
+                     GetSearchedString(search, inEventSentences),
+                     matchCase,
+                     inConditions,
+                     inActions,
+                     inEventStrings,
+                     inEventSentences,
+                     nullptr,
+                     results);
+  return results;
+}
 
-  const gd::String& ignored_characters =
-      EventsRefactorer::searchIgnoredCharacters;
+vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
+    const gd::Platform& platform,
+    gd::EventsList& events,
+    const gd::EventsSearchIndex& index,
+    gd::String search,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences) {
+  vector<EventsSearchResult> results;
+  search = GetSearchedString(search, inEventSentences);
+  gd::EventsSearchCandidates candidates =
+      index.GetCandidates(search, matchCase);
+  SearchInEventsList(platform,
+                     events,
+                     search,
+                     matchCase,
+                     inConditions,
+                     inActions,
+                     inEventStrings,
+                     inEventSentences,
+                     &candidates,
+                     results);
+  return results;
+}
 
+gd::String EventsRefactorer::GetSearchedString(gd::String search,
+                                               bool inEventSentences) {
   if (inEventSentences) {
+    const gd::String& ignored_characters =
+        EventsRefactorer::searchIgnoredCharacters;
+
     // Remove ignored characters only when searching in event sentences.
     search.replace_if(
         search.begin(),
@@ -777,90 +856,100 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     search.RemoveConsecutiveOccurrences(search.begin(), search.end(), ' ');
   }
 
-  for (std::size_t i = 0; i < events.size(); ++i) {
-    bool eventAddedInResults = false;
-
-    auto allExpressionsWithMetadata = events[i].GetAllExpressionsWithMetadata();
-    for (auto& expressionAndMetadata : allExpressionsWithMetadata) {
-      gd::Expression* expression = expressionAndMetadata.first;
-
-      size_t foundPosition =
-          matchCase
-              ? expression->GetPlainString().find(search)
-              : expression->GetPlainString().FindCaseInsensitive(search);
-
-      if (foundPosition != gd::String::npos && !eventAddedInResults) {
-        results.push_back(EventsSearchResult(
-            std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-            &events,
-            i));
-        eventAddedInResults = true;
-      }
-    }
-
-    if (inConditions) {
-      vector<gd::InstructionsList*> conditionsVectors =
-          events[i].GetAllConditionsVectors();
-      for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
-        if (!eventAddedInResults &&
-            SearchStringInConditions(platform,
-                                     *conditionsVectors[j],
-                                     search,
-                                     matchCase,
-                                     inEventSentences)) {
-          results.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-          eventAddedInResults = true;
-        }
-      }
-    }
-
-    if (inActions) {
-      vector<gd::InstructionsList*> actionsVectors =
-          events[i].GetAllActionsVectors();
-      for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
-        if (!eventAddedInResults && SearchStringInActions(platform,
-                                                          *actionsVectors[j],
-                                                          search,
-                                                          matchCase,
-                                                          inEventSentences)) {
-          results.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-          eventAddedInResults = true;
-        }
-      }
-    }
+  return search;
+}
 
-    if (inEventStrings) {
-      if (!eventAddedInResults &&
-          SearchStringInEvent(events[i], search, matchCase)) {
-        results.push_back(EventsSearchResult(
-            std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-            &events,
-            i));
-      }
+void EventsRefactorer::SearchInEventsList(
+    const gd::Platform& platform,
+    gd::EventsList& events,
+    const gd::String& search,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences,
+    const gd::EventsSearchCandidates* candidates,
+    std::vector<EventsSearchResult>& results) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    if ((!candidates || candidates->MayMatch(events[i])) &&
+        SearchStringInEventAndInstructions(platform,
+                                           events[i],
+                                           search,
+                                           matchCase,
+                                           inConditions,
+                                           inActions,
+                                           inEventStrings,
+                                           inEventSentences)) {
+      results.push_back(EventsSearchResult(
+          std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
+          &events,
+          i));
     }
 
     if (events[i].CanHaveSubEvents()) {
-      vector<EventsSearchResult> subResults =
-          SearchInEvents(platform,
+      SearchInEventsList(platform,
                          events[i].GetSubEvents(),
                          search,
                          matchCase,
                          inConditions,
                          inActions,
                          inEventStrings,
-                         inEventSentences);
-      std::copy(
-          subResults.begin(), subResults.end(), std::back_inserter(results));
+                         inEventSentences,
+                         candidates,
+                         results);
     }
   }
+}
 
-  return results;
+bool EventsRefactorer::SearchStringInEventAndInstructions(
+    const gd::Platform& platform,
+    gd::BaseEvent& event,
+    const gd::String& search,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences) {
+  auto allExpressionsWithMetadata = event.GetAllExpressionsWithMetadata();
+  for (auto& expressionAndMetadata : allExpressionsWithMetadata) {
+    gd::Expression* expression = expressionAndMetadata.first;
+
+    size_t foundPosition =
+        matchCase ? expression->GetPlainString().find(search)
+                  : expression->GetPlainString().FindCaseInsensitive(search);
+
+    if (foundPosition != gd::String::npos) return true;
+  }
+
+  if (inConditions) {
+    vector<gd::InstructionsList*> conditionsVectors =
+        event.GetAllConditionsVectors();
+    for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
+      if (SearchStringInConditions(platform,
+                                   *conditionsVectors[j],
+                                   search,
+                                   matchCase,
+                                   inEventSentences))
+        return true;
+    }
+  }
+
+  if (inActions) {
+    vector<gd::InstructionsList*> actionsVectors = event.GetAllActionsVectors();
+    for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
+      if (SearchStringInActions(platform,
+                                *actionsVectors[j],
+                                search,
+                                matchCase,
+                                inEventSentences))
+        return true;
+    }
+  }
+
+  if (inEventStrings && SearchStringInEvent(event, search, matchCase))
+    return true;
+
+  return false;
 }
 
 bool EventsRefactorer::SearchStringInActions(const gd::Platform& platform,
@@ -898,11 +987,10 @@ bool EventsRefactorer::SearchStringInActions(const gd::Platform& platform,
   return false;
 }
 
-bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
-                                                   gd::Instruction& instruction,
-                                                   gd::String search,
-                                                   bool matchCase,
-                                                   bool isCondition) {
+gd::String EventsRefactorer::GetSearchableSentence(
+    const gd::Platform& platform,
+    const gd::Instruction& instruction,
+    bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
                                    platform, instruction.GetType())
@@ -926,6 +1014,17 @@ bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
   completeSentence.RemoveConsecutiveOccurrences(
       completeSentence.begin(), completeSentence.end(), ' ');
 
+  return completeSentence;
+}
+
+bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
+                                                   gd::Instruction& instruction,
+                                                   gd::String search,
+                                                   bool matchCase,
+                                                   bool isCondition) {
+  gd::String completeSentence =
+      GetSearchableSentence(platform, instruction, isCondition);
+
   size_t foundPosition = matchCase
                              ? completeSentence.find(search)
                              : completeSentence.FindCaseInsensitive(search);
@@ -13,6 +13,8 @@
 #include "GDCore/String.h"
 namespace gd {
 class EventsList;
+class EventsSearchCandidates;
+class EventsSearchIndex;
 class ObjectsContainer;
 class ObjectsContainersList;
 class ProjectScopedContainers;
@@ -103,6 +105,26 @@ class GD_CORE_API EventsRefactorer {
       bool inEventStrings,
       bool inEventSentences);
 
+  /**
+   * Search for a gd::String in events, only looking in the events that the
+   * index can't exclude.
+   *
+   * \note Events that are not indexed (because they were inserted or modified
+   * after being indexed) are always searched, but the index must be updated
+   * to exclude them again.
+   * \see gd::EventsSearchIndex
+   */
+  static std::vector<EventsSearchResult> SearchInEvents(
+      const gd::Platform& platform,
+      gd::EventsList& events,
+      const gd::EventsSearchIndex& index,
+      gd::String search,
+      bool matchCase,
+      bool inConditions,
+      bool inActions,
+      bool inEventStrings,
+      bool inEventSentences);
+
   /**
    * Replace all occurrences of a gd::String in events
    *
@@ -119,6 +141,33 @@ class GD_CORE_API EventsRefactorer {
       bool inActions,
       bool inEventString);
 
+  /**
+   * Replace all occurrences of a gd::String in events, only looking in the
+   * events that the index can't exclude. The modified events are then updated
+   * in the index.
+   *
+   * \return A vector of all modified events.
+   */
+  static std::vector<EventsSearchResult> ReplaceStringInEvents(
+      gd::ObjectsContainer& project,
+      gd::ObjectsContainer& layout,
+      gd::EventsList& events,
+      gd::EventsSearchIndex& index,
+      gd::String toReplace,
+      gd::String newString,
+      bool matchCase,
+      bool inConditions,
+      bool inActions,
+      bool inEventString);
+
+  /**
+   * Return the sentence of an instruction, as searched when searching in
+   * event sentences.
+   */
+  static gd::String GetSearchableSentence(const gd::Platform& platform,
+                                          const gd::Instruction& instruction,
+                                          bool isCondition);
+
   virtual ~EventsRefactorer(){};
 
  private:
@@ -180,6 +229,73 @@ class GD_CORE_API EventsRefactorer {
       gd::String newString,
       bool matchCase);
 
+  /**
+   * Replace the string in the events (and their sub-events) that are
+   * candidates, if any candidates are given.
+   */
+  static void ReplaceStringInEventsList(
+      gd::ObjectsContainer& project,
+      gd::ObjectsContainer& layout,
+      gd::EventsList& events,
+      const gd::String& toReplace,
+      const gd::String& newString,
+      bool matchCase,
+      bool inConditions,
+      bool inActions,
+      bool inEventStrings,
+      const gd::EventsSearchCandidates* candidates,
+      std::vector<EventsSearchResult>& modifiedEvents);
+
+  /**
+   * Replace the string in an event (without its sub-events).
+   *
+   * \return true if something was modified.
+   */
+  static bool ReplaceStringInEvent(gd::ObjectsContainer& project,
+                                   gd::ObjectsContainer& layout,
+                                   gd::BaseEvent& event,
+                                   const gd::String& toReplace,
+                                   const gd::String& newString,
+                                   bool matchCase,
+                                   bool inConditions,
+                                   bool inActions,
+                                   bool inEventStrings);
+
+  /**
+   * Return the string to search, without the characters ignored when
+   * searching in event sentences.
+   */
+  static gd::String GetSearchedString(gd::String search,
+                                      bool inEventSentences);
+
+  /**
+   * Search the string in the events (and their sub-events) that are
+   * candidates, if any candidates are given.
+   */
+  static void SearchInEventsList(
+      const gd::Platform& platform,
+      gd::EventsList& events,
+      const gd::String& search,
+      bool matchCase,
+      bool inConditions,
+      bool inActions,
+      bool inEventStrings,
+      bool inEventSentences,
+      const gd::EventsSearchCandidates* candidates,
+      std::vector<EventsSearchResult>& results);
+
+  /**
+   * Search the string in an event (without its sub-events).
+   */
+  static bool SearchStringInEventAndInstructions(const gd::Platform& platform,
+                                                 gd::BaseEvent& event,
+                                                 const gd::String& search,
+                                                 bool matchCase,
+                                                 bool inConditions,
+                                                 bool inActions,
+                                                 bool inEventStrings,
+                                                 bool inEventSentences);
+
   static bool SearchStringInFormattedText(const gd::Platform& platform,
                                           gd::Instruction& instruction,
                                           gd::String search,
@@ -0,0 +1,231 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsSearchIndex.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+
+namespace {
+
+bool IsAscii(const std::string& text) {
+  return std::all_of(text.begin(), text.end(), [](char c) {
+    return static_cast<unsigned char>(c) < 0x80;
+  });
+}
+
+std::string AsciiLowerCase(std::string text) {
+  std::transform(text.begin(), text.end(), text.begin(), [](char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+  });
+  return text;
+}
+
+void AddTrigrams(const std::string& text,
+                 std::vector<std::uint32_t>& trigrams) {
+  for (std::size_t i = 0; i + 2 < text.size(); ++i) {
+    trigrams.push_back(static_cast<unsigned char>(text[i]) << 16 |
+                       static_cast<unsigned char>(text[i + 1]) << 8 |
+                       static_cast<unsigned char>(text[i + 2]));
+  }
+}
+
+/**
+ * Add the trigrams of the text in the forms compared by the searches: lower
+ * cased (for searches matching the case) and case folded (for the others).
+ * Both are the same for ASCII texts.
+ */
+void AddTextTrigrams(const gd::String& text,
+                     std::vector<std::uint32_t>& trigrams) {
+  if (text.Raw().size() < 3) return;
+
+  if (IsAscii(text.Raw())) {
+    AddTrigrams(AsciiLowerCase(text.Raw()), trigrams);
+  } else {
+    AddTrigrams(text.LowerCase().Raw(), trigrams);
+    AddTrigrams(text.CaseFold().Raw(), trigrams);
+  }
+}
+
+void AddInstructionsTrigrams(const gd::Platform& platform,
+                             const gd::InstructionsList& instructions,
+                             bool areConditions,
+                             std::vector<std::uint32_t>& trigrams) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction& instruction = instructions[i];
+    for (const auto& parameter : instruction.GetParameters())
+      AddTextTrigrams(parameter.GetPlainString(), trigrams);
+
+    AddTextTrigrams(gd::EventsRefactorer::GetSearchableSentence(
+                        platform, instruction, areConditions),
+                    trigrams);
+    AddInstructionsTrigrams(
+        platform, instruction.GetSubInstructions(), areConditions, trigrams);
+  }
+}
+
+}  // namespace
+
+namespace gd {
+
+bool EventsSearchCandidates::MayMatch(const gd::BaseEvent& event) const {
+  if (allEvents) return true;
+
+  std::size_t id = 0;
+  if (!index.GetEntry(event, id)) return true;
+
+  // Events indexed after the candidates were found are not known.
+  return id >= matchingEntries.size() || matchingEntries[id];
+}
+
+void EventsSearchIndex::IndexEvents(const gd::EventsList& events) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    IndexEvent(events.GetEventSmartPtr(i));
+
+    const gd::BaseEvent& event = events.GetEvent(i);
+    if (event.CanHaveSubEvents()) IndexEvents(event.GetSubEvents());
+  }
+}
+
+void EventsSearchIndex::UpdateEvent(const gd::EventsList& events,
+                                    std::size_t positionInList) {
+  if (positionInList >= events.GetEventsCount()) return;
+
+  IndexEvent(events.GetEventSmartPtr(positionInList));
+}
+
+void EventsSearchIndex::RemoveEvent(const gd::BaseEvent& event) {
+  auto it = entriesByEvent.find(&event);
+  if (it == entriesByEvent.end()) return;
+
+  // The entry stays in the lists of entries by trigram until these lists are
+  // rebuilt.
+  Entry& entry = entries[it->second];
+  entry.event.reset();
+  std::vector<std::uint32_t>().swap(entry.trigrams);
+  deletedEntriesCount++;
+  entriesByEvent.erase(it);
+}
+
+void EventsSearchIndex::IndexEvent(std::shared_ptr<const gd::BaseEvent> event) {
+  RemoveEvent(*event);
+
+  Entry entry;
+  entry.event = event;
+  for (const auto* conditions : event->GetAllConditionsVectors())
+    AddInstructionsTrigrams(platform, *conditions, true, entry.trigrams);
+  for (const auto* actions : event->GetAllActionsVectors())
+    AddInstructionsTrigrams(platform, *actions, false, entry.trigrams);
+  for (const auto& expressionAndMetadata :
+       event->GetAllExpressionsWithMetadata())
+    AddTextTrigrams(expressionAndMetadata.first->GetPlainString(),
+                    entry.trigrams);
+  for (const auto& searchableString : event->GetAllSearchableStrings())
+    AddTextTrigrams(searchableString, entry.trigrams);
+
+  std::sort(entry.trigrams.begin(), entry.trigrams.end());
+  entry.trigrams.erase(
+      std::unique(entry.trigrams.begin(), entry.trigrams.end()),
+      entry.trigrams.end());
+  entry.trigrams.shrink_to_fit();
+
+  std::size_t id = entries.size();
+  for (std::uint32_t trigram : entry.trigrams)
+    entriesByTrigram[trigram].push_back(id);
+  entries.push_back(std::move(entry));
+  entriesByEvent[event.get()] = id;
+
+  if (deletedEntriesCount > 1000 && deletedEntriesCount > entries.size() / 2)
+    RemoveDeletedEntries();
+}
+
+const EventsSearchIndex::Entry* EventsSearchIndex::GetEntry(
+    const gd::BaseEvent& event, std::size_t& id) const {
+  auto it = entriesByEvent.find(&event);
+  if (it == entriesByEvent.end()) return nullptr;
+
+  // The event could have been deleted, and another one created at the same
+  // address.
+  const Entry& entry = entries[it->second];
+  if (entry.event.lock().get() != &event) return nullptr;
+
+  id = it->second;
+  return &entry;
+}
+
+void EventsSearchIndex::RemoveDeletedEntries() {
+  std::vector<Entry> liveEntries;
+  entriesByEvent.clear();
+  entriesByTrigram.clear();
+  for (auto& entry : entries) {
+    auto event = entry.event.lock();
+    if (!event) continue;
+
+    std::size_t id = liveEntries.size();
+    for (std::uint32_t trigram : entry.trigrams)
+      entriesByTrigram[trigram].push_back(id);
+    entriesByEvent[event.get()] = id;
+    liveEntries.push_back(std::move(entry));
+  }
+
+  entries.swap(liveEntries);
+  deletedEntriesCount = 0;
+}
+
+EventsSearchCandidates EventsSearchIndex::GetCandidates(
+    const gd::String& search, bool matchCase) const {
+  EventsSearchCandidates candidates(*this);
+
+  std::vector<std::uint32_t> searchTrigrams;
+  if (IsAscii(search.Raw()))
+    AddTrigrams(AsciiLowerCase(search.Raw()), searchTrigrams);
+  else
+    AddTrigrams(matchCase ? search.LowerCase().Raw() : search.CaseFold().Raw(),
+                searchTrigrams);
+  if (searchTrigrams.empty()) {
+    candidates.allEvents = true;
+    return candidates;
+  }
+
+  candidates.matchingEntries.assign(entries.size(), false);
+  std::vector<const std::vector<std::size_t>*> trigramsEntries;
+  for (std::uint32_t trigram : searchTrigrams) {
+    auto it = entriesByTrigram.find(trigram);
+    if (it == entriesByTrigram.end()) return candidates;
+
+    trigramsEntries.push_back(&it->second);
+  }
+
+  // Start from the rarest trigram, and only keep the entries having the others.
+  std::sort(trigramsEntries.begin(),
+            trigramsEntries.end(),
+            [](const std::vector<std::size_t>* a,
+               const std::vector<std::size_t>* b) {
+              return a->size() < b->size();
+            });
+  std::vector<std::size_t> ids = *trigramsEntries[0];
+  for (std::size_t i = 1; i < trigramsEntries.size() && !ids.empty(); ++i) {
+    const auto& trigramEntries = *trigramsEntries[i];
+    ids.erase(std::remove_if(ids.begin(),
+                             ids.end(),
+                             [&trigramEntries](std::size_t id) {
+                               return !std::binary_search(
+                                   trigramEntries.begin(),
+                                   trigramEntries.end(),
+                                   id);
+                             }),
+              ids.end());
+  }
+
+  for (std::size_t id : ids) candidates.matchingEntries[id] = true;
+  return candidates;
+}
+
+}  // namespace gd
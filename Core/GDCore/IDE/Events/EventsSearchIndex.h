@@ -0,0 +1,126 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class EventsList;
+class EventsSearchIndex;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The events that can contain a searched string, according to a
+ * gd::EventsSearchIndex.
+ *
+ * \see gd::EventsSearchIndex::GetCandidates
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsSearchCandidates {
+ public:
+  /**
+   * \brief Return false if the event can't contain the searched string (its
+   * sub-events excluded), true if it must be searched.
+   *
+   * Events unknown to the index (or which were deleted and replaced by another
+   * event at the same address) are always returned as candidates.
+   */
+  bool MayMatch(const gd::BaseEvent& event) const;
+
+ private:
+  friend class EventsSearchIndex;
+  EventsSearchCandidates(const gd::EventsSearchIndex& index_)
+      : index(index_), allEvents(false){};
+
+  const gd::EventsSearchIndex& index;
+  bool allEvents;  ///< True if the search is too short to use the index.
+  std::vector<bool> matchingEntries;
+};
+
+/**
+ * \brief An index of the trigrams (sequences of 3 bytes) of all the strings
+ * searched by gd::EventsRefactorer::SearchInEvents in events: parameters of
+ * instructions, expressions, sentences of instructions and searchable strings
+ * of events (like comments).
+ *
+ * Searching a string of at least 3 bytes first finds the events containing
+ * all of its trigrams (see GetCandidates): only these events are then searched
+ * with the usual matcher, so results are exactly the ones of a search without
+ * the index.
+ *
+ * The index must be kept up to date: after an event was inserted or modified,
+ * call UpdateEvent (or IndexEvents for a list of inserted events, with their
+ * sub-events). Events that are not indexed are always searched.
+ *
+ * \see gd::EventsRefactorer::SearchInEvents
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsSearchIndex {
+ public:
+  EventsSearchIndex(const gd::Platform& platform_)
+      : platform(platform_), deletedEntriesCount(0){};
+  virtual ~EventsSearchIndex(){};
+
+  /**
+   * \brief Index (or index again) the events of the list and their
+   * sub-events.
+   */
+  void IndexEvents(const gd::EventsList& events);
+
+  /**
+   * \brief Index again the event at the given position in the list, after it
+   * was inserted or modified. Its sub-events are not indexed again.
+   */
+  void UpdateEvent(const gd::EventsList& events, std::size_t positionInList);
+
+  /**
+   * \brief Remove the event from the index.
+   */
+  void RemoveEvent(const gd::BaseEvent& event);
+
+  /**
+   * \brief Return the events that can contain the search, for a search made
+   * with the same parameters by gd::EventsRefactorer::SearchInEvents.
+   */
+  EventsSearchCandidates GetCandidates(const gd::String& search,
+                                       bool matchCase) const;
+
+  /**
+   * \brief Return the number of events in the index.
+   */
+  std::size_t GetIndexedEventsCount() const { return entriesByEvent.size(); }
+
+ private:
+  friend class EventsSearchCandidates;
+
+  struct Entry {
+    std::weak_ptr<const gd::BaseEvent> event;
+    std::vector<std::uint32_t> trigrams;  ///< Sorted, without duplicates.
+  };
+
+  void IndexEvent(std::shared_ptr<const gd::BaseEvent> event);
+  const Entry* GetEntry(const gd::BaseEvent& event, std::size_t& id) const;
+  void RemoveDeletedEntries();
+
+  const gd::Platform& platform;
+  std::vector<Entry> entries;  ///< Entries of deleted events have no event.
+  std::unordered_map<const gd::BaseEvent*, std::size_t> entriesByEvent;
+  std::unordered_map<std::uint32_t, std::vector<std::size_t>>
+      entriesByTrigram;  ///< The entries containing each trigram, sorted.
+  std::size_t deletedEntriesCount;
+};
+
+}  // namespace gd
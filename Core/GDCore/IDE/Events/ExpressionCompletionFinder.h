@@ -20,6 +20,7 @@
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariableOwnerFinder.h"
 #include "GDCore/IDE/Events/ExpressionVariablePathFinder.h"
+#include "GDCore/Project/IdentifiersSearchIndex.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/Project/Variable.h"
 
@@ -942,23 +943,30 @@ class GD_CORE_API ExpressionCompletionFinder
       const gd::String& search,
       const ExpressionParserLocation& location,
       bool eagerlyCompleteIfExactMatch = false) {
-    variablesContainer.ForEachVariableMatchingSearch(
-        search,
-        [&](const gd::String& variableName, const gd::Variable& variable) {
-          ExpressionCompletionDescription description(
-              ExpressionCompletionDescription::Variable,
-              location.GetStartPosition(),
-              location.GetEndPosition());
-          description.SetCompletion(variableName);
-          description.SetVariableType(variable.GetType());
-          description.SetVariableScope(variablesContainer.GetSourceType());
-          completions.push_back(description);
-
-          if (eagerlyCompleteIfExactMatch && variableName == search) {
-            AddEagerCompletionForVariableChildren(
-                variable, variableName, location);
-          }
-        });
+    auto addCompletion = [&](const gd::String& variableName,
+                             const gd::Variable& variable) {
+      ExpressionCompletionDescription description(
+          ExpressionCompletionDescription::Variable,
+          location.GetStartPosition(),
+          location.GetEndPosition());
+      description.SetCompletion(variableName);
+      description.SetVariableType(variable.GetType());
+      description.SetVariableScope(variablesContainer.GetSourceType());
+      completions.push_back(description);
+
+      if (eagerlyCompleteIfExactMatch && variableName == search) {
+        AddEagerCompletionForVariableChildren(
+            variable, variableName, location);
+      }
+    };
+
+    const gd::IdentifiersSearchIndex* index =
+        projectScopedContainers.GetIdentifiersSearchIndex();
+    if (index)
+      index->ForEachVariableMatchingSearch(
+          variablesContainer, search, addCompletion);
+    else
+      variablesContainer.ForEachVariableMatchingSearch(search, addCompletion);
   }
 
   void AddCompletionsForObjectOrGroupVariablesMatchingSearch(
@@ -984,7 +992,8 @@ class GD_CORE_API ExpressionCompletionFinder
             AddEagerCompletionForVariableChildren(
                 variable, variableName, location);
           }
-        });
+        },
+        projectScopedContainers.GetIdentifiersSearchIndex());
   }
 
   void AddCompletionsForObjectMatchingSearch(
@@ -1004,7 +1013,8 @@ class GD_CORE_API ExpressionCompletionFinder
               description.SetCompletion(name);
               description.SetType(type);
               completions.push_back(description);
-            });
+            },
+            projectScopedContainers.GetIdentifiersSearchIndex());
   }
 
   void AddCompletionsForObjectsAndVariablesMatchingSearch(
@@ -0,0 +1,68 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/FusedEventsWorker.h"
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+
+namespace gd {
+
+FusedEventsWorker::~FusedEventsWorker() {}
+
+gd::ArbitraryEventsWorkerWithContext& FusedEventsWorker::WithContext(
+    gd::ArbitraryEventsWorkerWithContext& worker) {
+  worker.currentProjectScopedContainers = &GetProjectScopedContainers();
+  return worker;
+}
+
+void FusedEventsWorker::DoVisitEventList(gd::EventsList& events) {
+  for (auto* worker : workers) WithContext(*worker).DoVisitEventList(events);
+}
+
+bool FusedEventsWorker::DoVisitEvent(gd::BaseEvent& event) {
+  for (auto* worker : workers) {
+    if (WithContext(*worker).DoVisitEvent(event)) return true;
+  }
+  return false;
+}
+
+bool FusedEventsWorker::DoVisitLinkEvent(gd::LinkEvent& linkEvent) {
+  for (auto* worker : workers) {
+    if (WithContext(*worker).DoVisitLinkEvent(linkEvent)) return true;
+  }
+  return false;
+}
+
+void FusedEventsWorker::DoVisitInstructionList(
+    gd::InstructionsList& instructions, bool areConditions) {
+  for (auto* worker : workers)
+    WithContext(*worker).DoVisitInstructionList(instructions, areConditions);
+}
+
+bool FusedEventsWorker::DoVisitInstruction(gd::Instruction& instruction,
+                                           bool isCondition) {
+  for (auto* worker : workers) {
+    if (WithContext(*worker).DoVisitInstruction(instruction, isCondition))
+      return true;
+  }
+  return false;
+}
+
+bool FusedEventsWorker::DoVisitEventExpression(
+    gd::Expression& expression, const gd::ParameterMetadata& metadata) {
+  for (auto* worker : workers) {
+    if (WithContext(*worker).DoVisitEventExpression(expression, metadata))
+      return true;
+  }
+  return false;
+}
+
+}  // namespace gd
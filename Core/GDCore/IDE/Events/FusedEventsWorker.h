@@ -0,0 +1,79 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+
+namespace gd {
+class BaseEvent;
+class LinkEvent;
+class EventsList;
+class Expression;
+class Instruction;
+class InstructionsList;
+class ParameterMetadata;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Run several workers while browsing the events only once.
+ *
+ * Each event, instruction and expression is given to the workers in the order
+ * they were added, before going to the next one. An element is removed as soon
+ * as a worker asks for it, and the next workers don't see it.
+ *
+ * The workers must not depend on changes done by the other workers on the
+ * rest of the events (for instance, a worker switching the types of
+ * instructions according to renamed variables must be launched after the
+ * variables are renamed everywhere).
+ *
+ * \note The workers are not owned by this worker.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API FusedEventsWorker : public ArbitraryEventsWorkerWithContext {
+ public:
+  FusedEventsWorker(){};
+  virtual ~FusedEventsWorker();
+
+  /**
+   * \brief Add a worker to be run on the events.
+   */
+  FusedEventsWorker& AddWorker(gd::ArbitraryEventsWorkerWithContext& worker) {
+    workers.push_back(&worker);
+    return *this;
+  };
+
+  /**
+   * \brief Return true if no worker was added.
+   */
+  bool IsEmpty() const { return workers.empty(); };
+
+ private:
+  void DoVisitEventList(gd::EventsList& events) override;
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitLinkEvent(gd::LinkEvent& linkEvent) override;
+  void DoVisitInstructionList(gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+  bool DoVisitEventExpression(gd::Expression& expression,
+                              const gd::ParameterMetadata& metadata) override;
+
+  /**
+   * \brief Give to the worker the containers of the events being browsed
+   * (including the local variables of the parent events).
+   */
+  gd::ArbitraryEventsWorkerWithContext& WithContext(
+      gd::ArbitraryEventsWorkerWithContext& worker);
+
+  std::vector<gd::ArbitraryEventsWorkerWithContext*> workers;
+};
+
+}  // namespace gd
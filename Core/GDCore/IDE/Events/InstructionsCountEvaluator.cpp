@@ -3,22 +3,34 @@
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Tools/ParallelTasks.h"
 
 namespace gd {
 
 const int InstructionsCountEvaluator::ScanProject(gd::Project &project) {
   InstructionsCountEvaluator worker(project);
-  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(project,
-                                                                 worker);
+  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+      project, worker, gd::ParallelTasks::GetHardwareThreadsCount());
   return worker.instructionCount;
 };
 
+std::unique_ptr<ReadOnlyArbitraryEventsWorker>
+InstructionsCountEvaluator::CloneForParallelBrowsing() const {
+  return std::unique_ptr<ReadOnlyArbitraryEventsWorker>(
+      new InstructionsCountEvaluator(project));
+}
+
+void InstructionsCountEvaluator::MergeParallelResults(
+    ReadOnlyArbitraryEventsWorker &worker) {
+  instructionCount +=
+      static_cast<InstructionsCountEvaluator &>(worker).instructionCount;
+}
+
 // Instructions scanner
 
-bool InstructionsCountEvaluator::DoVisitInstruction(
-    gd::Instruction &instruction, bool isCondition) {
+void InstructionsCountEvaluator::DoVisitInstruction(
+    const gd::Instruction &instruction, bool isCondition) {
   instructionCount++;
-  return false;
 }
 
 } // namespace gd
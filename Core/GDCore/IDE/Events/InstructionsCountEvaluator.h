@@ -27,21 +27,29 @@ namespace gd {
  * This is used by the examples repository to evaluate examples size.
  *
  */
-class GD_CORE_API InstructionsCountEvaluator : public ArbitraryEventsWorker {
+class GD_CORE_API InstructionsCountEvaluator
+    : public ReadOnlyArbitraryEventsWorker {
 public:
   /**
    * Return the number of instructions in the project excluding extensions.
+   *
+   * Events are browsed using all the threads of the machine.
    */
   static const int ScanProject(gd::Project &project);
 
+  std::unique_ptr<ReadOnlyArbitraryEventsWorker>
+  CloneForParallelBrowsing() const override;
+
+  void MergeParallelResults(ReadOnlyArbitraryEventsWorker &worker) override;
+
 private:
-  InstructionsCountEvaluator(gd::Project &project_)
+  InstructionsCountEvaluator(const gd::Project &project_)
       : project(project_), instructionCount(0){};
-  gd::Project &project;
+  const gd::Project &project;
   int instructionCount;
 
   // Instructions Visitor
-  bool DoVisitInstruction(gd::Instruction &instruction,
+  void DoVisitInstruction(const gd::Instruction &instruction,
                           bool isCondition) override;
 };
 
@@ -17,7 +17,10 @@ namespace gd {
 
 bool InstructionsTypeRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                            bool isCondition) {
-  if (instruction.GetType() == oldType) {
+  // If the old type was not interned, the atom is the empty one: the string
+  // is still compared to handle instructions without a type.
+  if (instruction.GetTypeAtom() == oldTypeAtom &&
+      instruction.GetType() == oldType) {
     instruction.SetType(newType);
   }
   
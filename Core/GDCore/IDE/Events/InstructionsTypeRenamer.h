@@ -10,6 +10,7 @@
 #include <vector>
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/StringAtom.h"
 namespace gd {
 class BaseEvent;
 class Project;
@@ -29,7 +30,10 @@ class GD_CORE_API InstructionsTypeRenamer : public ArbitraryEventsWorker {
   InstructionsTypeRenamer(const gd::Project& project_,
                           const gd::String& oldType_,
                           const gd::String& newType_)
-      : project(project_), oldType(oldType_), newType(newType_){};
+      : project(project_),
+        oldType(oldType_),
+        oldTypeAtom(gd::StringAtom::FindExisting(oldType_)),
+        newType(newType_){};
   virtual ~InstructionsTypeRenamer();
 
  private:
@@ -38,6 +42,8 @@ class GD_CORE_API InstructionsTypeRenamer : public ArbitraryEventsWorker {
 
   const gd::Project& project;
   gd::String oldType;
+  gd::StringAtom oldTypeAtom;  ///< Compared first to the type of instructions,
+                               ///< without interning the old type.
   gd::String newType;
 };
 
@@ -0,0 +1,41 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "FilesContentHashCache.h"
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+
+namespace gd {
+
+gd::String FilesContentHashCache::GetFileContentHash(gd::AbstractFileSystem& fs,
+                                                     const gd::String& file) {
+  std::size_t size = 0;
+  std::int64_t lastModificationTime = 0;
+  if (!fs.GetFileStats(file, size, lastModificationTime)) {
+    // Without stats, there is no way to know if the file changed.
+    entries.erase(file);
+    return fs.GetFileContentHash(file);
+  }
+
+  auto it = entries.find(file);
+  if (it != entries.end() && it->second.size == size &&
+      it->second.lastModificationTime == lastModificationTime) {
+    return it->second.hash;
+  }
+
+  gd::String hash = fs.GetFileContentHash(file);
+  if (hash.empty()) {
+    entries.erase(file);
+    return hash;
+  }
+
+  Entry& entry = entries[file];
+  entry.size = size;
+  entry.lastModificationTime = lastModificationTime;
+  entry.hash = hash;
+  return hash;
+}
+
+}  // namespace gd
@@ -0,0 +1,65 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "GDCore/String.h"
+namespace gd {
+class AbstractFileSystem;
+}
+
+namespace gd {
+
+/**
+ * \brief Cache the hash of the content of files, so that files are only read
+ * again when they changed.
+ *
+ * A cached hash is reused as long as the size and the last modification time
+ * of the file, given by gd::AbstractFileSystem::GetFileStats, are unchanged.
+ * When the file system can't give this information, the hash is always
+ * computed again.
+ *
+ * \see gd::ResourcesMergingHelper
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API FilesContentHashCache {
+ public:
+  FilesContentHashCache(){};
+  virtual ~FilesContentHashCache(){};
+
+  /**
+   * \brief Return the hash of the content of the file, reading it only if
+   * it's not in the cache or if it changed.
+   *
+   * \return The hash, or an empty string if the file could not be read.
+   */
+  gd::String GetFileContentHash(gd::AbstractFileSystem& fs,
+                                const gd::String& file);
+
+  /**
+   * \brief Remove all the hashes stored in the cache.
+   */
+  void Clear() { entries.clear(); };
+
+  /**
+   * \brief Return the number of files having their hash stored in the cache.
+   */
+  std::size_t GetCachedFilesCount() const { return entries.size(); };
+
+ private:
+  struct Entry {
+    std::size_t size;
+    std::int64_t lastModificationTime;
+    gd::String hash;
+  };
+
+  std::unordered_map<gd::String, Entry> entries;  ///< Hashes, by file path.
+};
+
+}  // namespace gd
@@ -5,6 +5,7 @@
  */
 #include "ProjectResourcesCopier.h"
 #include <map>
+#include <set>
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Project/ResourcesAbsolutePathChecker.h"
@@ -24,16 +25,20 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
     gd::String destinationDirectory,
     bool updateOriginalProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool deduplicateIdenticalFiles,
+    gd::FilesContentHashCache* filesContentHashCache) {
   if (updateOriginalProject) {
     gd::ProjectResourcesCopier::CopyAllResourcesTo(
         originalProject, originalProject, fs, destinationDirectory,
-        preserveAbsoluteFilenames, preserveDirectoryStructure);
+        preserveAbsoluteFilenames, preserveDirectoryStructure,
+        deduplicateIdenticalFiles, filesContentHashCache);
   } else {
     gd::Project clonedProject = originalProject;
     gd::ProjectResourcesCopier::CopyAllResourcesTo(
         originalProject, clonedProject, fs, destinationDirectory,
-        preserveAbsoluteFilenames, preserveDirectoryStructure);
+        preserveAbsoluteFilenames, preserveDirectoryStructure,
+        deduplicateIdenticalFiles, filesContentHashCache);
   }
   return true;
 }
@@ -44,7 +49,9 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool deduplicateIdenticalFiles,
+    gd::FilesContentHashCache* filesContentHashCache) {
 
   // Check if there are some resources with absolute filenames
   gd::ResourcesAbsolutePathChecker absolutePathChecker(originalProject.GetResourcesManager(), fs);
@@ -61,17 +68,24 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
   resourcesMergingHelper.PreserveDirectoriesStructure(
       preserveDirectoryStructure);
   resourcesMergingHelper.PreserveAbsoluteFilenames(preserveAbsoluteFilenames);
+  resourcesMergingHelper.DeduplicateIdenticalFiles(deduplicateIdenticalFiles);
+  if (filesContentHashCache)
+    resourcesMergingHelper.SetFilesContentHashCache(*filesContentHashCache);
   gd::ResourceExposer::ExposeWholeProjectResources(clonedProject,
                                                     resourcesMergingHelper);
 
   // Copy resources
   map<gd::String, gd::String>& resourcesNewFilename =
       resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
+  std::set<gd::String> copiedNewFilenames;
   for (map<gd::String, gd::String>::const_iterator it =
            resourcesNewFilename.begin();
        it != resourcesNewFilename.end();
        ++it) {
     if (!it->first.empty()) {
+      // Identical files share the same new filename: copy them only once.
+      if (!copiedNewFilenames.insert(it->second).second) continue;
+
       // Create the destination filename
       gd::String destinationFile = it->second;
       fs.MakeAbsolute(destinationFile, destinationDirectory);
@@ -10,6 +10,7 @@
 namespace gd {
 class Project;
 class AbstractFileSystem;
+class FilesContentHashCache;
 }  // namespace gd
 
 namespace gd {
@@ -40,14 +41,26 @@ class GD_CORE_API ProjectResourcesCopier {
    * of the resources will be preserved when copying. Otherwise, everything will
    * be send in the destinationDirectory.
    *
+   * \param deduplicateIdenticalFiles If set to true, files with the same
+   * content are copied only once and all the resources using them are updated
+   * to use this single copy.
+   *
+   * \param filesContentHashCache If not null, the cache used to store the
+   * hashes of the files content when identical files are deduplicated. Pass
+   * the same cache for all the exports so that unchanged files are not read
+   * again.
+   *
    * \return true if no error happened
    */
-  static bool CopyAllResourcesTo(gd::Project& project,
-                                 gd::AbstractFileSystem& fs,
-                                 gd::String destinationDirectory,
-                                 bool updateOriginalProject,
-                                 bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+  static bool CopyAllResourcesTo(
+      gd::Project& project,
+      gd::AbstractFileSystem& fs,
+      gd::String destinationDirectory,
+      bool updateOriginalProject,
+      bool preserveAbsoluteFilenames = true,
+      bool preserveDirectoryStructure = true,
+      bool deduplicateIdenticalFiles = false,
+      gd::FilesContentHashCache* filesContentHashCache = nullptr);
 
 private:
   static bool CopyAllResourcesTo(gd::Project& originalProject,
@@ -55,7 +68,9 @@ private:
                                  gd::AbstractFileSystem& fs,
                                  gd::String destinationDirectory,
                                  bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveDirectoryStructure = true,
+                                 bool deduplicateIdenticalFiles = false,
+                                 gd::FilesContentHashCache* filesContentHashCache = nullptr);
 };
 
 }  // namespace gd
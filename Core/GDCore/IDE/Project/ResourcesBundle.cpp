@@ -0,0 +1,167 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "ResourcesBundle.h"
+
+namespace {
+
+const char magic[] = {'G', 'D', 'R', 'B'};
+const std::size_t headerSize = 16;
+
+void WriteUInt32(std::string& output, std::uint32_t value) {
+  for (int i = 0; i < 4; ++i)
+    output.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+void WriteUInt64(std::string& output, std::uint64_t value) {
+  for (int i = 0; i < 8; ++i)
+    output.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+bool ReadUInt32(const std::string& input,
+                std::size_t& position,
+                std::uint32_t& value) {
+  if (input.size() < 4 || position > input.size() - 4) return false;
+
+  value = 0;
+  for (int i = 0; i < 4; ++i)
+    value |= static_cast<std::uint32_t>(
+                 static_cast<unsigned char>(input[position + i]))
+             << (8 * i);
+  position += 4;
+  return true;
+}
+
+bool ReadUInt64(const std::string& input,
+                std::size_t& position,
+                std::uint64_t& value) {
+  if (input.size() < 8 || position > input.size() - 8) return false;
+
+  value = 0;
+  for (int i = 0; i < 8; ++i)
+    value |= static_cast<std::uint64_t>(
+                 static_cast<unsigned char>(input[position + i]))
+             << (8 * i);
+  position += 8;
+  return true;
+}
+
+}  // namespace
+
+namespace gd {
+
+const std::uint32_t ResourcesBundle::version = 1;
+const std::string ResourcesBundle::badContent;
+
+void ResourcesBundle::AddFile(const gd::String& name,
+                              const std::string& content) {
+  auto it = filesPositions.find(name);
+  if (it != filesPositions.end()) {
+    files[it->second].second = content;
+    return;
+  }
+
+  filesPositions[name] = files.size();
+  files.push_back(std::make_pair(name, content));
+}
+
+const std::string& ResourcesBundle::GetFileContent(
+    const gd::String& name) const {
+  auto it = filesPositions.find(name);
+  if (it == filesPositions.end()) return badContent;
+
+  return files[it->second].second;
+}
+
+std::vector<gd::String> ResourcesBundle::GetAllFileNames() const {
+  std::vector<gd::String> names;
+  for (const auto& file : files) names.push_back(file.first);
+
+  return names;
+}
+
+std::string ResourcesBundle::Pack() const {
+  // Compute the size of the index to know where the content starts.
+  std::size_t indexSize = 0;
+  for (const auto& file : files) indexSize += 4 + file.first.Raw().size() + 8 + 8;
+
+  std::string output;
+  output.append(magic, sizeof(magic));
+  WriteUInt32(output, version);
+  WriteUInt32(output, 0);  // Flags: content is not compressed.
+  WriteUInt32(output, static_cast<std::uint32_t>(files.size()));
+
+  std::uint64_t offset = headerSize + indexSize;
+  for (const auto& file : files) {
+    const std::string& name = file.first.Raw();
+    WriteUInt32(output, static_cast<std::uint32_t>(name.size()));
+    output.append(name);
+    WriteUInt64(output, offset);
+    WriteUInt64(output, file.second.size());
+    offset += file.second.size();
+  }
+
+  output.reserve(offset);
+  for (const auto& file : files) output.append(file.second);
+
+  return output;
+}
+
+bool ResourcesBundle::ReadIndex(const std::string& packedBundleBeginning,
+                                std::vector<Entry>& entries) {
+  entries.clear();
+  const std::string& input = packedBundleBeginning;
+  if (input.size() < headerSize ||
+      input.compare(0, sizeof(magic), magic, sizeof(magic)) != 0)
+    return false;
+
+  std::size_t position = sizeof(magic);
+  std::uint32_t bundleVersion = 0, flags = 0, filesCount = 0;
+  if (!ReadUInt32(input, position, bundleVersion) ||
+      !ReadUInt32(input, position, flags) ||
+      !ReadUInt32(input, position, filesCount))
+    return false;
+  if (bundleVersion != version || flags != 0) return false;
+
+  for (std::uint32_t i = 0; i < filesCount; ++i) {
+    std::uint32_t nameSize = 0;
+    if (!ReadUInt32(input, position, nameSize)) return false;
+    if (nameSize > input.size() - position) return false;
+
+    Entry entry;
+    entry.name = gd::String::FromUTF8(input.substr(position, nameSize));
+    position += nameSize;
+    if (!ReadUInt64(input, position, entry.offset) ||
+        !ReadUInt64(input, position, entry.size))
+      return false;
+
+    entries.push_back(entry);
+  }
+
+  return true;
+}
+
+bool ResourcesBundle::Unpack(const std::string& packedBundle) {
+  files.clear();
+  filesPositions.clear();
+
+  std::vector<Entry> entries;
+  if (!ReadIndex(packedBundle, entries)) return false;
+
+  for (const auto& entry : entries) {
+    if (entry.offset > packedBundle.size() ||
+        entry.size > packedBundle.size() - entry.offset) {
+      files.clear();
+      filesPositions.clear();
+      return false;
+    }
+
+    AddFile(entry.name, packedBundle.substr(entry.offset, entry.size));
+  }
+
+  return true;
+}
+
+}  // namespace gd
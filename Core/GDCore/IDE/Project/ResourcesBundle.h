@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A bundle packing the content of several files into a single file,
+ * with an index of the offset and the size of each file.
+ *
+ * The content of the files is stored uncompressed, one after the other, so
+ * that a file can be read with a range request once the index is known.
+ *
+ * Binary format (integers are little-endian):
+ * - `GDRB` (4 bytes): the magic identifier of the bundle.
+ * - Version (uint32): currently 1.
+ * - Flags (uint32): 0 (uncompressed content).
+ * - Count of files (uint32).
+ * - For each file: the length of its name (uint32), its name (UTF-8), the
+ *   offset of its content from the start of the bundle (uint64) and the size
+ *   of its content (uint64).
+ * - The content of the files.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ResourcesBundle {
+ public:
+  /**
+   * \brief The location of a file content in a bundle.
+   */
+  struct Entry {
+    gd::String name;
+    std::uint64_t offset;
+    std::uint64_t size;
+  };
+
+  ResourcesBundle(){};
+  virtual ~ResourcesBundle(){};
+
+  /**
+   * \brief Add a file to the bundle (or replace the content of a file with
+   * the same name).
+   */
+  void AddFile(const gd::String& name, const std::string& content);
+
+  /**
+   * \brief Return true if a file with the given name is in the bundle.
+   */
+  bool HasFile(const gd::String& name) const {
+    return filesPositions.find(name) != filesPositions.end();
+  };
+
+  /**
+   * \brief Return the content of a file, or an empty string if it's not in
+   * the bundle.
+   */
+  const std::string& GetFileContent(const gd::String& name) const;
+
+  /**
+   * \brief Return the names of the files, in the order they were added.
+   */
+  std::vector<gd::String> GetAllFileNames() const;
+
+  /**
+   * \brief Return the number of files in the bundle.
+   */
+  std::size_t GetFilesCount() const { return files.size(); };
+
+  /**
+   * \brief Return the content of the bundle, in the binary format described
+   * in the class documentation.
+   */
+  std::string Pack() const;
+
+  /**
+   * \brief Replace the files of this bundle by the ones of the packed bundle.
+   *
+   * \return false if the bundle is invalid or truncated (in which case this
+   * bundle is left empty).
+   */
+  bool Unpack(const std::string& packedBundle);
+
+  /**
+   * \brief Read the index of a packed bundle.
+   *
+   * Only the beginning of the bundle, containing the header and the index, is
+   * required: this allows a reader to fetch the index first, then only the
+   * content of the files it needs.
+   *
+   * \return false if the index is invalid or not complete.
+   */
+  static bool ReadIndex(const std::string& packedBundleBeginning,
+                        std::vector<Entry>& entries);
+
+  static const std::uint32_t version;
+
+ private:
+  std::vector<std::pair<gd::String, std::string>> files;
+  std::unordered_map<gd::String, std::size_t> filesPositions;
+
+  static const std::string badContent;
+};
+
+}  // namespace gd
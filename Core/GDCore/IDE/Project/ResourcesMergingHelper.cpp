@@ -65,6 +65,19 @@ void ResourcesMergingHelper::SetNewFilename(gd::String oldFilename,
                                             gd::String newFilename) {
   if (newFilenames.find(oldFilename) != newFilenames.end()) return;
 
+  gd::String contentHash;
+  if (deduplicateIdenticalFiles) {
+    contentHash = filesContentHashCache->GetFileContentHash(fs, oldFilename);
+    if (!contentHash.empty()) {
+      auto it = newFilenamesByContentHash.find(contentHash);
+      if (it != newFilenamesByContentHash.end()) {
+        // An identical file was already given a new filename: reuse it.
+        newFilenames[oldFilename] = it->second;
+        return;
+      }
+    }
+  }
+
   // Extract baseName and extension from the new filename
   size_t extensionPos = newFilename.find_last_of(".");
   gd::String extension =
@@ -87,6 +100,8 @@ void ResourcesMergingHelper::SetNewFilename(gd::String oldFilename,
 
   newFilenames[oldFilename] = finalFilename;
   oldFilenames[finalFilename] = oldFilename;
+  if (!contentHash.empty())
+    newFilenamesByContentHash[contentHash] = finalFilename;
 }
 
 void ResourcesMergingHelper::SetBaseDirectory(
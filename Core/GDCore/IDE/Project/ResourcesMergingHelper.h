@@ -8,8 +8,10 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/Project/FilesContentHashCache.h"
 #include "GDCore/String.h"
 namespace gd {
 class AbstractFileSystem;
@@ -23,6 +25,9 @@ namespace gd {
  * in a single directory (potentially changing the filename to avoid conflicts,
  * but preserving extensions).
  *
+ * When identical files deduplication is enabled, files with the same content
+ * are all given the same new filename, so that they are copied only once.
+ *
  * \see ArbitraryResourceWorker
  *
  * \ingroup IDE
@@ -33,7 +38,8 @@ public:
                          gd::AbstractFileSystem &fileSystem)
       : ArbitraryResourceWorker(resourcesManager),
         preserveDirectoriesStructure(false), preserveAbsoluteFilenames(false),
-        fs(fileSystem){};
+        deduplicateIdenticalFiles(false),
+        filesContentHashCache(&ownFilesContentHashCache), fs(fileSystem){};
   virtual ~ResourcesMergingHelper(){};
 
   /**
@@ -58,6 +64,25 @@ public:
     preserveAbsoluteFilenames = preserveAbsoluteFilenames_;
   };
 
+  /**
+   * \brief Set if files having the same content must be given the same new
+   * filename (the first one found), so that they are only copied once.
+   */
+  void DeduplicateIdenticalFiles(bool deduplicateIdenticalFiles_ = true) {
+    deduplicateIdenticalFiles = deduplicateIdenticalFiles_;
+  };
+
+  /**
+   * \brief Set the cache to be used to store the hashes of the files content
+   * when identical files are deduplicated. Useful to avoid reading again
+   * unchanged files from an export to another.
+   *
+   * \note The cache must outlive the ResourcesMergingHelper.
+   */
+  void SetFilesContentHashCache(gd::FilesContentHashCache& cache) {
+    filesContentHashCache = &cache;
+  };
+
   /**
    * \brief Return a map containing the resources old absolute filename as key,
    * and the resources new filenames as value. The new filenames are relative to
@@ -84,6 +109,11 @@ public:
    * New file names that can be accessed by their original name.
    */
   std::map<gd::String, gd::String> newFilenames;
+  /**
+   * New file names that can be accessed by the hash of their content.
+   * Only filled when identical files are deduplicated.
+   */
+  std::unordered_map<gd::String, gd::String> newFilenamesByContentHash;
   gd::String baseDirectory;
   bool preserveDirectoriesStructure;  ///< If set to true, the directory
                                       ///< structure, starting from
@@ -93,6 +123,11 @@ public:
                                    ///< absolute (C:\MyFile.png  will not be
                                    ///< transformed into a relative filename
                                    ///< (MyFile.png).
+  bool deduplicateIdenticalFiles;  ///< If set to true, files with the same
+                                   ///< content share the same new filename.
+  gd::FilesContentHashCache* filesContentHashCache;  ///< The cache used for
+                                                     ///< files content hashes.
+  gd::FilesContentHashCache ownFilesContentHashCache;
   gd::AbstractFileSystem&
       fs;  ///< The gd::AbstractFileSystem used to manipulate files.
 };
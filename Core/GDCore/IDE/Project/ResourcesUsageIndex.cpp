@@ -0,0 +1,329 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "ResourcesUsageIndex.h"
+
+#include <algorithm>
+
+#include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/IDE/ResourceExposer.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+
+namespace {
+
+/**
+ * \brief Store the resources exposed to it as used by the current user.
+ */
+class ResourcesUsageCollector : public gd::ArbitraryResourceWorker {
+ public:
+  ResourcesUsageCollector(gd::ResourcesManager& resourcesManager,
+                          gd::ResourceUser::PartType partType,
+                          const gd::String& partName)
+      : gd::ArbitraryResourceWorker(resourcesManager),
+        currentUser(partType, partName, gd::ResourceUser::ProjectProperty){};
+  virtual ~ResourcesUsageCollector(){};
+
+  void SetCurrentUser(gd::ResourceUser::UserType userType,
+                      const gd::String& objectName = "",
+                      const gd::String& behaviorName = "") {
+    currentUser = gd::ResourceUser(currentUser.GetPartType(),
+                                   currentUser.GetPartName(),
+                                   userType,
+                                   objectName,
+                                   behaviorName);
+  }
+
+  const std::vector<std::pair<gd::String, gd::ResourceUser>>& GetUsages()
+      const {
+    return usages;
+  }
+
+  void ExposeFile(gd::String& resourceFileName) override{
+      // Don't do anything: only resource names are indexed.
+  };
+  void ExposeImage(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeAudio(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeFont(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeJson(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeTilemap(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeTileset(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeVideo(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeBitmapFont(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeModel3D(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeAtlas(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+  void ExposeSpine(gd::String& resourceName) override {
+    AddUsage(resourceName);
+  };
+
+ private:
+  void AddUsage(const gd::String& resourceName) {
+    if (resourceName.empty()) return;
+    usages.push_back(std::make_pair(resourceName, currentUser));
+  }
+
+  gd::ResourceUser currentUser;
+  std::vector<std::pair<gd::String, gd::ResourceUser>> usages;
+};
+
+/**
+ * \brief Expose the resources of objects and their behaviors to a
+ * ResourcesUsageCollector, remembering which object or behavior uses them.
+ */
+class ResourcesUsageInObjectsWorker : public gd::ArbitraryObjectsWorker {
+ public:
+  ResourcesUsageInObjectsWorker(const gd::Project& project_,
+                                ResourcesUsageCollector& collector_)
+      : project(project_), collector(collector_){};
+  virtual ~ResourcesUsageInObjectsWorker(){};
+
+ private:
+  void DoVisitObject(gd::Object& object) override {
+    // Behaviors are visited just after their object.
+    currentObjectName = object.GetName();
+    collector.SetCurrentUser(gd::ResourceUser::ObjectConfiguration,
+                             currentObjectName);
+
+    object.GetConfiguration().ExposeResources(collector);
+    auto& effects = object.GetEffects();
+    for (std::size_t effectIndex = 0; effectIndex < effects.GetEffectsCount();
+         effectIndex++) {
+      gd::ResourceExposer::ExposeEffectResources(
+          project.GetCurrentPlatform(), effects.GetEffect(effectIndex),
+          collector);
+    }
+  }
+
+  void DoVisitBehavior(gd::Behavior& behavior) override {
+    collector.SetCurrentUser(gd::ResourceUser::ObjectBehavior,
+                             currentObjectName,
+                             behavior.GetName());
+    behavior.ExposeResources(collector);
+  }
+
+  const gd::Project& project;
+  ResourcesUsageCollector& collector;
+  gd::String currentObjectName;
+};
+
+}  // namespace
+
+namespace gd {
+
+void ResourcesUsageIndex::IndexWholeProject(gd::Project& project) {
+  Clear();
+
+  UpdateProject(project);
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+    UpdateLayout(project, project.GetLayout(i));
+  }
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); i++) {
+    UpdateExternalEvents(project, project.GetExternalEvents(i));
+  }
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       i++) {
+    UpdateEventsFunctionsExtension(project,
+                                   project.GetEventsFunctionsExtension(i));
+  }
+}
+
+void ResourcesUsageIndex::UpdateProject(gd::Project& project) {
+  RemovePart(ResourceUser::ProjectPart, "");
+
+  ResourcesUsageCollector collector(
+      project.GetResourcesManager(), ResourceUser::ProjectPart, "");
+  project.GetPlatformSpecificAssets().ExposeResources(collector);
+
+  auto& loadingScreen = project.GetLoadingScreen();
+  gd::String backgroundImageResourceName =
+      loadingScreen.GetBackgroundImageResourceName();
+  collector.ExposeImage(backgroundImageResourceName);
+
+  ResourcesUsageInObjectsWorker objectsWorker(project, collector);
+  objectsWorker.Launch(project.GetObjects());
+
+  AddUsages(collector.GetUsages());
+}
+
+void ResourcesUsageIndex::UpdateLayout(gd::Project& project,
+                                       gd::Layout& layout) {
+  RemovePart(ResourceUser::LayoutPart, layout.GetName());
+
+  ResourcesUsageCollector collector(project.GetResourcesManager(),
+                                    ResourceUser::LayoutPart,
+                                    layout.GetName());
+  ResourcesUsageInObjectsWorker objectsWorker(project, collector);
+  gd::ProjectBrowserHelper::ExposeLayoutObjects(layout, objectsWorker);
+
+  collector.SetCurrentUser(ResourceUser::LayerEffect);
+  for (std::size_t layerIndex = 0; layerIndex < layout.GetLayersCount();
+       layerIndex++) {
+    auto& effects = layout.GetLayer(layerIndex).GetEffects();
+    for (std::size_t effectIndex = 0; effectIndex < effects.GetEffectsCount();
+         effectIndex++) {
+      gd::ResourceExposer::ExposeEffectResources(
+          project.GetCurrentPlatform(), effects.GetEffect(effectIndex),
+          collector);
+    }
+  }
+
+  collector.SetCurrentUser(ResourceUser::Events);
+  auto eventsWorker = gd::GetResourceWorkerOnEvents(project, collector);
+  eventsWorker.Launch(layout.GetEvents());
+
+  AddUsages(collector.GetUsages());
+}
+
+void ResourcesUsageIndex::UpdateExternalEvents(
+    gd::Project& project, gd::ExternalEvents& externalEvents) {
+  RemovePart(ResourceUser::ExternalEventsPart, externalEvents.GetName());
+
+  ResourcesUsageCollector collector(project.GetResourcesManager(),
+                                    ResourceUser::ExternalEventsPart,
+                                    externalEvents.GetName());
+  collector.SetCurrentUser(ResourceUser::Events);
+  auto eventsWorker = gd::GetResourceWorkerOnEvents(project, collector);
+  eventsWorker.Launch(externalEvents.GetEvents());
+
+  AddUsages(collector.GetUsages());
+}
+
+void ResourcesUsageIndex::UpdateEventsFunctionsExtension(
+    gd::Project& project,
+    gd::EventsFunctionsExtension& eventsFunctionsExtension) {
+  RemovePart(ResourceUser::EventsFunctionsExtensionPart,
+             eventsFunctionsExtension.GetName());
+
+  ResourcesUsageCollector collector(project.GetResourcesManager(),
+                                    ResourceUser::EventsFunctionsExtensionPart,
+                                    eventsFunctionsExtension.GetName());
+  ResourcesUsageInObjectsWorker objectsWorker(project, collector);
+  for (auto&& eventsBasedObject :
+       eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+    objectsWorker.Launch(eventsBasedObject->GetObjects());
+  }
+
+  collector.SetCurrentUser(ResourceUser::Events);
+  auto eventsWorker = gd::GetResourceWorkerOnEvents(project, collector);
+  gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(
+      project, eventsFunctionsExtension, eventsWorker);
+
+  AddUsages(collector.GetUsages());
+}
+
+void ResourcesUsageIndex::Clear() {
+  usersByResource.clear();
+  resourcesByPart.clear();
+}
+
+bool ResourcesUsageIndex::IsResourceUsedInLayout(
+    const gd::String& resourceName, const gd::String& layoutName) const {
+  auto it = usersByResource.find(resourceName);
+  if (it == usersByResource.end()) return false;
+
+  return it->second.find(PartKey(ResourceUser::LayoutPart, layoutName)) !=
+         it->second.end();
+}
+
+std::vector<gd::String> ResourcesUsageIndex::GetLayoutsUsingResource(
+    const gd::String& resourceName) const {
+  std::vector<gd::String> layoutNames;
+  auto it = usersByResource.find(resourceName);
+  if (it == usersByResource.end()) return layoutNames;
+
+  for (const auto& partUsers : it->second) {
+    if (partUsers.first.first == ResourceUser::LayoutPart)
+      layoutNames.push_back(partUsers.first.second);
+  }
+  return layoutNames;
+}
+
+std::vector<gd::ResourceUser> ResourcesUsageIndex::GetResourceUsers(
+    const gd::String& resourceName) const {
+  std::vector<gd::ResourceUser> users;
+  auto it = usersByResource.find(resourceName);
+  if (it == usersByResource.end()) return users;
+
+  for (const auto& partUsers : it->second) {
+    users.insert(users.end(), partUsers.second.begin(), partUsers.second.end());
+  }
+  return users;
+}
+
+std::vector<gd::String> ResourcesUsageIndex::GetAllUsedResourceNames() const {
+  std::vector<gd::String> resourceNames;
+  resourceNames.reserve(usersByResource.size());
+  for (const auto& resourceUsers : usersByResource) {
+    resourceNames.push_back(resourceUsers.first);
+  }
+  return resourceNames;
+}
+
+std::vector<gd::String> ResourcesUsageIndex::GetResourcesUsedByPart(
+    ResourceUser::PartType partType, const gd::String& partName) const {
+  auto it = resourcesByPart.find(PartKey(partType, partName));
+  if (it == resourcesByPart.end()) return std::vector<gd::String>();
+
+  return std::vector<gd::String>(it->second.begin(), it->second.end());
+}
+
+void ResourcesUsageIndex::RemovePart(ResourceUser::PartType partType,
+                                     const gd::String& partName) {
+  PartKey partKey(partType, partName);
+  auto partIt = resourcesByPart.find(partKey);
+  if (partIt == resourcesByPart.end()) return;
+
+  for (const gd::String& resourceName : partIt->second) {
+    auto it = usersByResource.find(resourceName);
+    if (it == usersByResource.end()) continue;
+
+    it->second.erase(partKey);
+    if (it->second.empty()) usersByResource.erase(it);
+  }
+  resourcesByPart.erase(partIt);
+}
+
+void ResourcesUsageIndex::AddUsages(
+    const std::vector<std::pair<gd::String, gd::ResourceUser>>& usages) {
+  for (const auto& usage : usages) {
+    const gd::String& resourceName = usage.first;
+    const gd::ResourceUser& user = usage.second;
+    PartKey partKey(user.GetPartType(), user.GetPartName());
+
+    auto& users = usersByResource[resourceName][partKey];
+    if (std::find(users.begin(), users.end(), user) == users.end())
+      users.push_back(user);
+    resourcesByPart[partKey].insert(resourceName);
+  }
+}
+
+}  // namespace gd
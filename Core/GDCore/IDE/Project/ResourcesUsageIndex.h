@@ -0,0 +1,225 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class Layout;
+class ExternalEvents;
+class EventsFunctionsExtension;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Describe something using a resource: an object, a behavior, a layer
+ * effect, events or a project property, in a given part of the project.
+ *
+ * \see gd::ResourcesUsageIndex
+ */
+class GD_CORE_API ResourceUser {
+ public:
+  /**
+   * \brief The part of the project where the resource is used.
+   */
+  enum PartType {
+    ProjectPart,  ///< Global objects, platform specific assets, loading
+                  ///< screen.
+    LayoutPart,
+    ExternalEventsPart,
+    EventsFunctionsExtensionPart
+  };
+
+  /**
+   * \brief What is using the resource.
+   */
+  enum UserType {
+    ProjectProperty,
+    ObjectConfiguration,  ///< The object configuration or its effects.
+    ObjectBehavior,
+    LayerEffect,
+    Events
+  };
+
+  ResourceUser(PartType partType_,
+               const gd::String& partName_,
+               UserType userType_,
+               const gd::String& objectName_ = "",
+               const gd::String& behaviorName_ = "")
+      : partType(partType_),
+        partName(partName_),
+        userType(userType_),
+        objectName(objectName_),
+        behaviorName(behaviorName_){};
+
+  PartType GetPartType() const { return partType; }
+
+  /**
+   * \brief Return the name of the layout, external events or extension using
+   * the resource (empty for the project).
+   */
+  const gd::String& GetPartName() const { return partName; }
+
+  UserType GetUserType() const { return userType; }
+
+  /**
+   * \brief Return the name of the object using the resource (directly or
+   * through one of its behaviors or effects), if any.
+   */
+  const gd::String& GetObjectName() const { return objectName; }
+
+  /**
+   * \brief Return the name of the behavior using the resource, if any.
+   */
+  const gd::String& GetBehaviorName() const { return behaviorName; }
+
+  bool operator==(const ResourceUser& other) const {
+    return partType == other.partType && partName == other.partName &&
+           userType == other.userType && objectName == other.objectName &&
+           behaviorName == other.behaviorName;
+  }
+
+ private:
+  PartType partType;
+  gd::String partName;
+  UserType userType;
+  gd::String objectName;
+  gd::String behaviorName;
+};
+
+/**
+ * \brief Index of the resources usages in a project, to know which parts of
+ * the project use a resource without browsing the whole project.
+ *
+ * The index is built once with IndexWholeProject. Then, when a part of the
+ * project is modified (a layout, external events, an extension or the global
+ * objects and properties), only this part must be indexed again with the
+ * corresponding `Update*` method. Removed parts must be removed with the
+ * corresponding `Remove*` method.
+ *
+ * Usages found in a layout are only the ones of the layout itself (its
+ * objects, layers and events), not the ones of the external events or
+ * extensions it uses.
+ *
+ * \see gd::ResourceExposer
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ResourcesUsageIndex {
+ public:
+  ResourcesUsageIndex(){};
+  virtual ~ResourcesUsageIndex(){};
+
+  /**
+   * \brief Clear the index and index all the parts of the project.
+   */
+  void IndexWholeProject(gd::Project& project);
+
+  /**
+   * \brief Index again the global objects, the platform specific assets and
+   * the loading screen of the project.
+   */
+  void UpdateProject(gd::Project& project);
+
+  /**
+   * \brief Index again the objects, the layers and the events of a layout.
+   */
+  void UpdateLayout(gd::Project& project, gd::Layout& layout);
+
+  /**
+   * \brief Index again the events of external events.
+   */
+  void UpdateExternalEvents(gd::Project& project,
+                            gd::ExternalEvents& externalEvents);
+
+  /**
+   * \brief Index again the events and the objects of an extension.
+   */
+  void UpdateEventsFunctionsExtension(
+      gd::Project& project,
+      gd::EventsFunctionsExtension& eventsFunctionsExtension);
+
+  void RemoveLayout(const gd::String& layoutName) {
+    RemovePart(ResourceUser::LayoutPart, layoutName);
+  };
+  void RemoveExternalEvents(const gd::String& externalEventsName) {
+    RemovePart(ResourceUser::ExternalEventsPart, externalEventsName);
+  };
+  void RemoveEventsFunctionsExtension(const gd::String& extensionName) {
+    RemovePart(ResourceUser::EventsFunctionsExtensionPart, extensionName);
+  };
+
+  /**
+   * \brief Remove everything from the index.
+   */
+  void Clear();
+
+  /**
+   * \brief Return true if the resource is used anywhere in the project.
+   */
+  bool IsResourceUsed(const gd::String& resourceName) const {
+    return usersByResource.find(resourceName) != usersByResource.end();
+  };
+
+  /**
+   * \brief Return true if the resource is used in the given layout.
+   */
+  bool IsResourceUsedInLayout(const gd::String& resourceName,
+                              const gd::String& layoutName) const;
+
+  /**
+   * \brief Return the names of the layouts using the resource.
+   */
+  std::vector<gd::String> GetLayoutsUsingResource(
+      const gd::String& resourceName) const;
+
+  /**
+   * \brief Return everything using the resource.
+   */
+  std::vector<gd::ResourceUser> GetResourceUsers(
+      const gd::String& resourceName) const;
+
+  /**
+   * \brief Return the names of all the resources used in the project.
+   */
+  std::vector<gd::String> GetAllUsedResourceNames() const;
+
+  /**
+   * \brief Return the names of the resources used by a part of the project.
+   */
+  std::vector<gd::String> GetResourcesUsedByPart(
+      ResourceUser::PartType partType, const gd::String& partName) const;
+
+ private:
+  typedef std::pair<ResourceUser::PartType, gd::String> PartKey;
+
+  void RemovePart(ResourceUser::PartType partType, const gd::String& partName);
+  void AddUsages(
+      const std::vector<std::pair<gd::String, gd::ResourceUser>>& usages);
+
+  /**
+   * Users of each resource, by the part of the project they are in.
+   */
+  std::unordered_map<gd::String,
+                     std::map<PartKey, std::vector<gd::ResourceUser>>>
+      usersByResource;
+  /**
+   * Resources used by each part of the project, to remove the usages of a
+   * part when it's indexed again or removed.
+   */
+  std::map<PartKey, std::set<gd::String>> resourcesByPart;
+};
+
+}  // namespace gd
@@ -5,6 +5,13 @@
  */
 #include "ProjectBrowserHelper.h"
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
@@ -21,6 +28,94 @@
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/String.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
+#include "GDCore/Tools/ParallelTasks.h"
+
+namespace {
+
+/**
+ * Return the events lists of the project, in the order they are browsed by
+ * gd::ProjectBrowserHelper::ExposeProjectEvents.
+ */
+std::vector<const gd::EventsList *>
+GetProjectEventsLists(const gd::Project &project, bool withExtensions) {
+  std::vector<const gd::EventsList *> eventsLists;
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    eventsLists.push_back(&project.GetLayout(s).GetEvents());
+  }
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    eventsLists.push_back(&project.GetExternalEvents(s).GetEvents());
+  }
+  if (!withExtensions) return eventsLists;
+
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto &eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    for (auto &&eventsFunction : eventsFunctionsExtension.GetInternalVector()) {
+      eventsLists.push_back(&eventsFunction->GetEvents());
+    }
+    for (auto &&eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      for (auto &&eventsFunction :
+           eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+        eventsLists.push_back(&eventsFunction->GetEvents());
+      }
+    }
+    for (auto &&eventsBasedObject :
+         eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+      for (auto &&eventsFunction :
+           eventsBasedObject->GetEventsFunctions().GetInternalVector()) {
+        eventsLists.push_back(&eventsFunction->GetEvents());
+      }
+    }
+  }
+  return eventsLists;
+}
+
+void LaunchInParallel(const gd::Project &project,
+                      const std::vector<const gd::EventsList *> &eventsLists,
+                      gd::ReadOnlyArbitraryEventsWorker &worker,
+                      std::size_t threadsCount) {
+  // Give a few chunks of contiguous events lists to each thread, so that a
+  // thread having big events lists doesn't make the others wait.
+  std::size_t chunksCount =
+      threadsCount <= 1 ? 1 : std::min(eventsLists.size(), threadsCount * 4);
+  std::vector<std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>> workers;
+  for (std::size_t i = 0; chunksCount > 1 && i < chunksCount; ++i) {
+    auto chunkWorker = worker.CloneForParallelBrowsing();
+    if (!chunkWorker) break;
+
+    workers.push_back(std::move(chunkWorker));
+  }
+  if (chunksCount <= 1 || workers.size() != chunksCount) {
+    for (const gd::EventsList *events : eventsLists) worker.Launch(*events);
+    return;
+  }
+
+  // Deferred extensions are declared while searching for metadata, which
+  // must not happen on several threads at the same time.
+  for (auto platform : project.GetUsedPlatforms())
+    platform->DeclareAllExtensions();
+  // Layouts used by links are loaded now rather than making threads wait
+  // for each other.
+  project.LoadAllLayouts();
+
+  std::vector<std::function<void()>> tasks;
+  for (std::size_t i = 0; i < chunksCount; ++i) {
+    std::size_t begin = eventsLists.size() * i / chunksCount;
+    std::size_t end = eventsLists.size() * (i + 1) / chunksCount;
+    gd::ReadOnlyArbitraryEventsWorker &chunkWorker = *workers[i];
+    tasks.push_back([&eventsLists, &chunkWorker, begin, end]() {
+      for (std::size_t j = begin; j < end; ++j)
+        chunkWorker.Launch(*eventsLists[j]);
+    });
+  }
+  gd::ParallelTasks::Run(tasks, threadsCount);
+
+  for (auto &chunkWorker : workers) worker.MergeParallelResults(*chunkWorker);
+}
+
+}  // namespace
 
 namespace gd {
 
@@ -51,6 +146,110 @@ void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(
   }
 }
 
+void ProjectBrowserHelper::ExposeProjectEvents(
+    const gd::Project &project, gd::ReadOnlyArbitraryEventsWorker &worker) {
+  for (const gd::EventsList *events : GetProjectEventsLists(project, true)) {
+    worker.Launch(*events);
+  }
+}
+
+void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(
+    const gd::Project &project, gd::ReadOnlyArbitraryEventsWorker &worker) {
+  for (const gd::EventsList *events : GetProjectEventsLists(project, false)) {
+    worker.Launch(*events);
+  }
+}
+
+void ProjectBrowserHelper::ExposeProjectEventsInParallel(
+    const gd::Project &project, gd::ReadOnlyArbitraryEventsWorker &worker,
+    std::size_t threadsCount) {
+  LaunchInParallel(project, GetProjectEventsLists(project, true), worker,
+                   threadsCount);
+}
+
+void ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+    const gd::Project &project, gd::ReadOnlyArbitraryEventsWorker &worker,
+    std::size_t threadsCount) {
+  LaunchInParallel(project, GetProjectEventsLists(project, false), worker,
+                   threadsCount);
+}
+
+void ProjectBrowserHelper::ExposeProjectEventsInParallel(
+    gd::Project &project,
+    const std::function<std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>()>
+        &createWorker,
+    std::size_t threadsCount) {
+  // Same events as ExposeProjectEvents, with a worker for each layout,
+  // external events and extension.
+  std::vector<std::function<void(gd::ArbitraryEventsWorkerWithContext &)>>
+      shards;
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    auto &layout = project.GetLayout(s);
+    shards.push_back(
+        [&project, &layout](gd::ArbitraryEventsWorkerWithContext &worker) {
+          auto projectScopedContainers = gd::ProjectScopedContainers::
+              MakeNewProjectScopedContainersForProjectAndLayout(project,
+                                                                layout);
+          worker.Launch(layout.GetEvents(), projectScopedContainers);
+        });
+  }
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    auto &externalEvents = project.GetExternalEvents(s);
+    const gd::String &associatedLayout = externalEvents.GetAssociatedLayout();
+    if (!project.HasLayoutNamed(associatedLayout)) continue;
+
+    auto &layout = project.GetLayout(associatedLayout);
+    shards.push_back([&project, &layout, &externalEvents](
+                         gd::ArbitraryEventsWorkerWithContext &worker) {
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+      worker.Launch(externalEvents.GetEvents(), projectScopedContainers);
+    });
+  }
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto &eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    shards.push_back([&project, &eventsFunctionsExtension](
+                         gd::ArbitraryEventsWorkerWithContext &worker) {
+      ExposeEventsFunctionsExtensionEvents(project, eventsFunctionsExtension,
+                                           worker);
+    });
+  }
+
+  std::vector<std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>> workers;
+  for (std::size_t i = 0; i < shards.size(); ++i)
+    workers.push_back(createWorker());
+
+  if (threadsCount > 1) {
+    // Deferred extensions are declared while searching for metadata, which
+    // must not happen on several threads at the same time.
+    for (auto platform : project.GetUsedPlatforms())
+      platform->DeclareAllExtensions();
+    // Layouts used by links are loaded now rather than making threads wait
+    // for each other.
+    project.LoadAllLayouts();
+  }
+
+  // Exceptions are kept to be thrown in the order of the events, whatever
+  // the thread that browsed them.
+  std::vector<std::exception_ptr> exceptions(shards.size());
+  std::vector<std::function<void()>> tasks;
+  for (std::size_t i = 0; i < shards.size(); ++i) {
+    tasks.push_back([&shards, &workers, &exceptions, i]() {
+      try {
+        shards[i](*workers[i]);
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    });
+  }
+  gd::ParallelTasks::Run(tasks, threadsCount);
+
+  for (auto &exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+}
+
 void ProjectBrowserHelper::ExposeLayoutEventsAndExternalEvents(
     gd::Project &project, gd::Layout &layout,
     gd::ArbitraryEventsWorker &worker) {
@@ -5,6 +5,10 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 namespace gd {
 class Project;
 class Layout;
@@ -15,6 +19,7 @@ class EventsBasedBehavior;
 class EventsBasedObject;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ReadOnlyArbitraryEventsWorker;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -56,6 +61,70 @@ public:
   ExposeProjectEventsWithoutExtensions(gd::Project &project,
                                        gd::ArbitraryEventsWorker &worker);
 
+  /**
+   * \brief Call the specified read-only worker on all events of the project
+   * (layout, external events, events functions...)
+   */
+  static void ExposeProjectEvents(const gd::Project &project,
+                                  gd::ReadOnlyArbitraryEventsWorker &worker);
+
+  /**
+   * \brief Call the specified read-only worker on all events of the project
+   * (layout and external events) but not events from extensions.
+   */
+  static void
+  ExposeProjectEventsWithoutExtensions(const gd::Project &project,
+                                       gd::ReadOnlyArbitraryEventsWorker &worker);
+
+  /**
+   * \brief Call the specified read-only worker on all events of the project,
+   * spreading the events lists on the given number of threads.
+   *
+   * Each thread browses its events lists with its own worker, created with
+   * gd::ReadOnlyArbitraryEventsWorker::CloneForParallelBrowsing, and the
+   * results are then merged, in the order of the events, into the specified
+   * worker. Events are browsed by the worker alone if it can't be cloned or
+   * if threads are not available.
+   *
+   * Extensions metadata can be searched from workers: deferred extensions of
+   * the platforms of the project are declared before threads are started.
+   */
+  static void
+  ExposeProjectEventsInParallel(const gd::Project &project,
+                                gd::ReadOnlyArbitraryEventsWorker &worker,
+                                std::size_t threadsCount);
+
+  /**
+   * \brief Call the specified read-only worker on all events of the project
+   * (layout and external events) but not events from extensions, spreading
+   * the events lists on the given number of threads.
+   *
+   * \see ProjectBrowserHelper::ExposeProjectEventsInParallel
+   */
+  static void ExposeProjectEventsWithoutExtensionsInParallel(
+      const gd::Project &project,
+      gd::ReadOnlyArbitraryEventsWorker &worker,
+      std::size_t threadsCount);
+
+  /**
+   * \brief Call workers on all events of the project (layout, external
+   * events, events functions...), spreading the layouts, the external events
+   * and the extensions on the given number of threads.
+   * Each layout, external events or extension is browsed by its own worker,
+   * created on the calling thread with \a createWorker, so workers can modify
+   * the events they browse.
+   * If browsing some events throws, the other events are still browsed and
+   * the exception of the first events (in the order of ExposeProjectEvents)
+   * is then thrown.
+   * \see ProjectBrowserHelper::ExposeProjectEvents
+   */
+  static void ExposeProjectEventsInParallel(
+      gd::Project &project,
+      const std::function<
+          std::unique_ptr<gd::ArbitraryEventsWorkerWithContext>()>
+          &createWorker,
+      std::size_t threadsCount);
+
   /**
    * \brief Call the specified worker on all events of a layout and
    * its external events.
@@ -0,0 +1,530 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "ProjectDependencyGraph.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+
+namespace {
+
+typedef std::set<gd::ProjectDependencyNode> NodesSet;
+
+/**
+ * \brief Find the parts of a project used by objects and events: linked
+ * layouts and external events, events-based behaviors and objects and
+ * functions of events functions extensions.
+ *
+ * Functions are identified by their type (`ExtensionName::FunctionName` or
+ * `ExtensionName::BehaviorOrObjectName::FunctionName`), so the extensions don't
+ * need to be declared in the platform.
+ */
+class ProjectDependenciesFinder : public gd::ReadOnlyArbitraryEventsWorker,
+                                  public gd::ExpressionParser2NodeWorker {
+ public:
+  ProjectDependenciesFinder(const gd::Project& project_,
+                            NodesSet& dependencies_)
+      : project(project_), dependencies(dependencies_){};
+  virtual ~ProjectDependenciesFinder(){};
+
+  void AddObjectsDependencies(const gd::ObjectsContainer& objects) {
+    for (std::size_t i = 0; i < objects.GetObjectsCount(); i++) {
+      const gd::Object& object = objects.GetObject(i);
+      AddEventsBasedEntityType(object.GetType());
+      for (const gd::String& behaviorName : object.GetAllBehaviorNames()) {
+        AddEventsBasedEntityType(object.GetBehavior(behaviorName).GetTypeName());
+      }
+    }
+  }
+
+  void AddEventsBasedEntityType(const gd::String& type) {
+    if (project.HasEventsBasedBehavior(type)) {
+      dependencies.insert(gd::ProjectDependencyNode(
+          gd::ProjectDependencyNode::EventsBasedBehaviorNode, type));
+    } else if (project.HasEventsBasedObject(type)) {
+      dependencies.insert(gd::ProjectDependencyNode(
+          gd::ProjectDependencyNode::EventsBasedObjectNode, type));
+    }
+  }
+
+  void AddFunctionType(const gd::String& type) {
+    std::size_t separatorPosition = type.find("::");
+    if (separatorPosition == gd::String::npos) return;
+
+    std::size_t secondSeparatorPosition =
+        type.find("::", separatorPosition + 2);
+    if (secondSeparatorPosition != gd::String::npos) {
+      AddEventsBasedEntityType(type.substr(0, secondSeparatorPosition));
+      return;
+    }
+
+    gd::String extensionName = type.substr(0, separatorPosition);
+    if (project.HasEventsFunctionsExtensionNamed(extensionName)) {
+      dependencies.insert(gd::ProjectDependencyNode(
+          gd::ProjectDependencyNode::EventsFunctionsExtensionNode,
+          extensionName));
+    }
+  }
+
+ private:
+  void DoVisitLinkEvent(const gd::LinkEvent& linkEvent) override {
+    const gd::String& target = linkEvent.GetTarget();
+    if (project.HasExternalEventsNamed(target)) {
+      dependencies.insert(gd::ProjectDependencyNode(
+          gd::ProjectDependencyNode::ExternalEventsNode, target));
+    } else if (project.HasLayoutNamed(target)) {
+      dependencies.insert(gd::ProjectDependencyNode(
+          gd::ProjectDependencyNode::LayoutNode, target));
+    } else if (!target.empty()) {
+      // Events linking to missing external events become dirty when they are
+      // added.
+      dependencies.insert(gd::ProjectDependencyNode(
+          gd::ProjectDependencyNode::ExternalEventsNode, target));
+    }
+  }
+
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    AddFunctionType(instruction.GetType());
+
+    const gd::InstructionMetadata& metadata =
+        isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                          project.GetCurrentPlatform(), instruction.GetType())
+                    : gd::MetadataProvider::GetActionMetadata(
+                          project.GetCurrentPlatform(), instruction.GetType());
+    gd::ParameterMetadataTools::IterateOverParameters(
+        instruction.GetParameters(),
+        metadata.GetParameters(),
+        [this](const gd::ParameterMetadata& parameterMetadata,
+               const gd::Expression& parameterValue,
+               const gd::String& lastObjectName) {
+          const gd::String& parameterType = parameterMetadata.GetType();
+          if (gd::ParameterMetadata::IsExpression("number", parameterType) ||
+              gd::ParameterMetadata::IsExpression("string", parameterType)) {
+            parameterValue.GetRootNode()->Visit(*this);
+          }
+        });
+  }
+
+  // Objects and behaviors functions are found with the objects.
+  void OnVisitFunctionCallNode(gd::FunctionCallNode& node) override {
+    if (node.objectName.empty() && node.behaviorName.empty()) {
+      AddFunctionType(node.functionName);
+    }
+    for (auto& parameter : node.parameters) {
+      parameter->Visit(*this);
+    }
+  }
+
+  void OnVisitSubExpressionNode(gd::SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(gd::OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(gd::UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitVariableNode(gd::VariableNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(gd::VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      gd::VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitNumberNode(gd::NumberNode& node) override {}
+  void OnVisitTextNode(gd::TextNode& node) override {}
+  void OnVisitIdentifierNode(gd::IdentifierNode& node) override {}
+  void OnVisitObjectFunctionNameNode(
+      gd::ObjectFunctionNameNode& node) override {}
+  void OnVisitEmptyNode(gd::EmptyNode& node) override {}
+
+  const gd::Project& project;
+  NodesSet& dependencies;
+};
+
+const NodesSet noNodes;
+
+}  // namespace
+
+namespace gd {
+
+void ProjectDependencyGraph::AnalyzeWholeProject(gd::Project& project) {
+  Clear();
+
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); i++) {
+    UpdateLayout(project, project.GetLayout(i));
+  }
+  for (std::size_t i = 0; i < project.GetExternalLayoutsCount(); i++) {
+    UpdateExternalLayout(project, project.GetExternalLayout(i));
+  }
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); i++) {
+    UpdateExternalEvents(project, project.GetExternalEvents(i));
+  }
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       i++) {
+    UpdateEventsFunctionsExtension(project,
+                                   project.GetEventsFunctionsExtension(i));
+  }
+}
+
+void ProjectDependencyGraph::UpdateLayout(gd::Project& project,
+                                          gd::Layout& layout) {
+  NodesSet dependencies;
+  ProjectDependenciesFinder finder(project, dependencies);
+  finder.AddObjectsDependencies(layout.GetObjects());
+  finder.Launch(layout.GetEvents());
+
+  resourcesUsageIndex.UpdateLayout(project, layout);
+  AddResourcesDependencies(
+      ResourceUser::LayoutPart, layout.GetName(), dependencies);
+
+  ProjectDependencyNode node(ProjectDependencyNode::LayoutNode,
+                             layout.GetName());
+  dependencies.erase(node);
+  SetDependencies(node, dependencies);
+}
+
+void ProjectDependencyGraph::UpdateExternalLayout(
+    gd::Project& project, gd::ExternalLayout& externalLayout) {
+  NodesSet dependencies;
+  const gd::String& associatedLayout = externalLayout.GetAssociatedLayout();
+  if (!associatedLayout.empty()) {
+    dependencies.insert(ProjectDependencyNode(ProjectDependencyNode::LayoutNode,
+                                              associatedLayout));
+  }
+
+  SetDependencies(ProjectDependencyNode(
+                      ProjectDependencyNode::ExternalLayoutNode,
+                      externalLayout.GetName()),
+                  dependencies);
+}
+
+void ProjectDependencyGraph::UpdateExternalEvents(
+    gd::Project& project, gd::ExternalEvents& externalEvents) {
+  NodesSet dependencies;
+  ProjectDependenciesFinder finder(project, dependencies);
+  finder.Launch(externalEvents.GetEvents());
+
+  resourcesUsageIndex.UpdateExternalEvents(project, externalEvents);
+  AddResourcesDependencies(ResourceUser::ExternalEventsPart,
+                           externalEvents.GetName(),
+                           dependencies);
+
+  ProjectDependencyNode node(ProjectDependencyNode::ExternalEventsNode,
+                             externalEvents.GetName());
+  dependencies.erase(node);
+  SetDependencies(node, dependencies);
+}
+
+void ProjectDependencyGraph::UpdateEventsFunctionsExtension(
+    gd::Project& project,
+    gd::EventsFunctionsExtension& eventsFunctionsExtension) {
+  const gd::String& extensionName = eventsFunctionsExtension.GetName();
+  ProjectDependencyNode extensionNode(
+      ProjectDependencyNode::EventsFunctionsExtensionNode, extensionName);
+
+  // Resources are not tracked by behavior or object, so they are all
+  // dependencies of the extension (on which behaviors and objects depend).
+  NodesSet extensionDependencies;
+  {
+    ProjectDependenciesFinder finder(project, extensionDependencies);
+    for (auto&& eventsFunction : eventsFunctionsExtension.GetInternalVector()) {
+      finder.Launch(eventsFunction->GetEvents());
+    }
+  }
+  resourcesUsageIndex.UpdateEventsFunctionsExtension(project,
+                                                     eventsFunctionsExtension);
+  AddResourcesDependencies(ResourceUser::EventsFunctionsExtensionPart,
+                           extensionName,
+                           extensionDependencies);
+  extensionDependencies.erase(extensionNode);
+  SetDependencies(extensionNode, extensionDependencies);
+
+  NodesSet entityNodes;
+  for (auto&& eventsBasedBehavior :
+       eventsFunctionsExtension.GetEventsBasedBehaviors().GetInternalVector()) {
+    ProjectDependencyNode node(
+        ProjectDependencyNode::EventsBasedBehaviorNode,
+        gd::PlatformExtension::GetBehaviorFullType(
+            extensionName, eventsBasedBehavior->GetName()));
+    NodesSet dependencies;
+    dependencies.insert(extensionNode);
+
+    ProjectDependenciesFinder finder(project, dependencies);
+    for (auto&& eventsFunction :
+         eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+      finder.Launch(eventsFunction->GetEvents());
+    }
+    // Required behaviors are properties holding the behavior type.
+    auto& properties = eventsBasedBehavior->GetPropertyDescriptors();
+    for (std::size_t i = 0; i < properties.GetCount(); i++) {
+      const auto& property = properties.Get(i);
+      if (property.GetType() == "Behavior" &&
+          !property.GetExtraInfo().empty()) {
+        finder.AddEventsBasedEntityType(property.GetExtraInfo()[0]);
+      }
+    }
+
+    dependencies.erase(node);
+    SetDependencies(node, dependencies);
+    entityNodes.insert(node);
+  }
+  for (auto&& eventsBasedObject :
+       eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+    ProjectDependencyNode node(
+        ProjectDependencyNode::EventsBasedObjectNode,
+        gd::PlatformExtension::GetObjectFullType(
+            extensionName, eventsBasedObject->GetName()));
+    NodesSet dependencies;
+    dependencies.insert(extensionNode);
+
+    ProjectDependenciesFinder finder(project, dependencies);
+    finder.AddObjectsDependencies(eventsBasedObject->GetObjects());
+    for (auto&& eventsFunction :
+         eventsBasedObject->GetEventsFunctions().GetInternalVector()) {
+      finder.Launch(eventsFunction->GetEvents());
+    }
+
+    dependencies.erase(node);
+    SetDependencies(node, dependencies);
+    entityNodes.insert(node);
+  }
+
+  // Remove the behaviors and objects that don't exist anymore.
+  const gd::String entityNamesPrefix = extensionName + "::";
+  std::vector<ProjectDependencyNode> removedEntityNodes;
+  for (const auto& it : dependenciesByNode) {
+    const ProjectDependencyNode& node = it.first;
+    if ((node.GetType() == ProjectDependencyNode::EventsBasedBehaviorNode ||
+         node.GetType() == ProjectDependencyNode::EventsBasedObjectNode) &&
+        node.GetName().find(entityNamesPrefix) == 0 &&
+        entityNodes.find(node) == entityNodes.end()) {
+      removedEntityNodes.push_back(node);
+    }
+  }
+  for (const auto& node : removedEntityNodes) RemoveNode(node);
+}
+
+void ProjectDependencyGraph::RemoveLayout(const gd::String& layoutName) {
+  resourcesUsageIndex.RemoveLayout(layoutName);
+  RemoveNode(
+      ProjectDependencyNode(ProjectDependencyNode::LayoutNode, layoutName));
+}
+
+void ProjectDependencyGraph::RemoveExternalLayout(
+    const gd::String& externalLayoutName) {
+  RemoveNode(ProjectDependencyNode(ProjectDependencyNode::ExternalLayoutNode,
+                                   externalLayoutName));
+}
+
+void ProjectDependencyGraph::RemoveExternalEvents(
+    const gd::String& externalEventsName) {
+  resourcesUsageIndex.RemoveExternalEvents(externalEventsName);
+  RemoveNode(ProjectDependencyNode(ProjectDependencyNode::ExternalEventsNode,
+                                   externalEventsName));
+}
+
+void ProjectDependencyGraph::RemoveEventsFunctionsExtension(
+    const gd::String& extensionName) {
+  resourcesUsageIndex.RemoveEventsFunctionsExtension(extensionName);
+
+  const gd::String entityNamesPrefix = extensionName + "::";
+  std::vector<ProjectDependencyNode> removedNodes;
+  for (const auto& it : dependenciesByNode) {
+    const ProjectDependencyNode& node = it.first;
+    if ((node.GetType() == ProjectDependencyNode::EventsBasedBehaviorNode ||
+         node.GetType() == ProjectDependencyNode::EventsBasedObjectNode) &&
+        node.GetName().find(entityNamesPrefix) == 0) {
+      removedNodes.push_back(node);
+    }
+  }
+  removedNodes.push_back(ProjectDependencyNode(
+      ProjectDependencyNode::EventsFunctionsExtensionNode, extensionName));
+  for (const auto& node : removedNodes) RemoveNode(node);
+}
+
+void ProjectDependencyGraph::MarkAsModified(
+    const gd::ProjectDependencyNode& node) {
+  version++;
+  modificationVersions[node] = version;
+}
+
+void ProjectDependencyGraph::Clear() {
+  // The version is not reset, so that versions returned before are still
+  // meaningful: all the nodes analyzed again will be considered as modified.
+  dependenciesByNode.clear();
+  dependentsByNode.clear();
+  modificationVersions.clear();
+  resourcesUsageIndex.Clear();
+}
+
+bool ProjectDependencyGraph::HasNode(
+    const gd::ProjectDependencyNode& node) const {
+  return dependenciesByNode.find(node) != dependenciesByNode.end() ||
+         dependentsByNode.find(node) != dependentsByNode.end();
+}
+
+const std::set<gd::ProjectDependencyNode>&
+ProjectDependencyGraph::GetDependencies(
+    const gd::ProjectDependencyNode& node) const {
+  auto it = dependenciesByNode.find(node);
+  return it != dependenciesByNode.end() ? it->second : noNodes;
+}
+
+const std::set<gd::ProjectDependencyNode>&
+ProjectDependencyGraph::GetDependents(
+    const gd::ProjectDependencyNode& node) const {
+  auto it = dependentsByNode.find(node);
+  return it != dependentsByNode.end() ? it->second : noNodes;
+}
+
+std::vector<gd::ProjectDependencyNode>
+ProjectDependencyGraph::GetTopologicalOrder() const {
+  std::map<ProjectDependencyNode, std::size_t> remainingDependenciesCount;
+  for (const auto& it : dependentsByNode) {
+    remainingDependenciesCount[it.first] = 0;
+  }
+  for (const auto& it : dependenciesByNode) {
+    remainingDependenciesCount[it.first] = it.second.size();
+  }
+
+  // Nodes are taken by type and name among the ones ready, to always give
+  // the same order.
+  NodesSet readyNodes;
+  for (const auto& it : remainingDependenciesCount) {
+    if (it.second == 0) readyNodes.insert(it.first);
+  }
+
+  std::vector<ProjectDependencyNode> orderedNodes;
+  orderedNodes.reserve(remainingDependenciesCount.size());
+  while (!readyNodes.empty()) {
+    ProjectDependencyNode node = *readyNodes.begin();
+    readyNodes.erase(readyNodes.begin());
+    orderedNodes.push_back(node);
+    remainingDependenciesCount.erase(node);
+
+    for (const auto& dependent : GetDependents(node)) {
+      auto it = remainingDependenciesCount.find(dependent);
+      if (it != remainingDependenciesCount.end() && --it->second == 0)
+        readyNodes.insert(dependent);
+    }
+  }
+
+  // Nodes left are part of (or depend on) a cycle.
+  for (const auto& it : remainingDependenciesCount) {
+    orderedNodes.push_back(it.first);
+  }
+  return orderedNodes;
+}
+
+std::vector<gd::ProjectDependencyNode>
+ProjectDependencyGraph::GetDirtyNodesSince(std::size_t sinceVersion) const {
+  NodesSet dirtyNodes;
+  std::vector<ProjectDependencyNode> nodesToVisit;
+  for (const auto& it : modificationVersions) {
+    if (it.second > sinceVersion && dirtyNodes.insert(it.first).second)
+      nodesToVisit.push_back(it.first);
+  }
+  while (!nodesToVisit.empty()) {
+    ProjectDependencyNode node = nodesToVisit.back();
+    nodesToVisit.pop_back();
+    for (const auto& dependent : GetDependents(node)) {
+      if (dirtyNodes.insert(dependent).second) nodesToVisit.push_back(dependent);
+    }
+  }
+  if (dirtyNodes.empty()) return std::vector<ProjectDependencyNode>();
+
+  // Removed nodes that are not used anymore are not part of the graph.
+  std::vector<ProjectDependencyNode> orderedDirtyNodes;
+  for (const auto& node : GetTopologicalOrder()) {
+    if (dirtyNodes.find(node) != dirtyNodes.end())
+      orderedDirtyNodes.push_back(node);
+  }
+  return orderedDirtyNodes;
+}
+
+std::vector<gd::String> ProjectDependencyGraph::GetDirtyNamesSince(
+    gd::ProjectDependencyNode::Type type, std::size_t sinceVersion) const {
+  std::vector<gd::String> names;
+  for (const auto& node : GetDirtyNodesSince(sinceVersion)) {
+    if (node.GetType() == type) names.push_back(node.GetName());
+  }
+  return names;
+}
+
+void ProjectDependencyGraph::SetDependencies(
+    const gd::ProjectDependencyNode& node, const NodesSet& dependencies) {
+  NodesSet& currentDependencies = dependenciesByNode[node];
+  for (const auto& dependency : currentDependencies) {
+    auto it = dependentsByNode.find(dependency);
+    if (it == dependentsByNode.end()) continue;
+
+    it->second.erase(node);
+    if (it->second.empty()) dependentsByNode.erase(it);
+  }
+
+  currentDependencies = dependencies;
+  for (const auto& dependency : dependencies) {
+    dependentsByNode[dependency].insert(node);
+  }
+  MarkAsModified(node);
+}
+
+void ProjectDependencyGraph::RemoveNode(const gd::ProjectDependencyNode& node) {
+  auto nodeIt = dependenciesByNode.find(node);
+  if (nodeIt == dependenciesByNode.end()) return;
+
+  for (const auto& dependency : nodeIt->second) {
+    auto it = dependentsByNode.find(dependency);
+    if (it == dependentsByNode.end()) continue;
+
+    it->second.erase(node);
+    if (it->second.empty()) dependentsByNode.erase(it);
+  }
+  dependenciesByNode.erase(nodeIt);
+
+  // Keep the modification version so that the nodes that were using this
+  // node are considered as dirty.
+  MarkAsModified(node);
+}
+
+void ProjectDependencyGraph::AddResourcesDependencies(
+    ResourceUser::PartType partType,
+    const gd::String& partName,
+    NodesSet& dependencies) const {
+  for (const gd::String& resourceName :
+       resourcesUsageIndex.GetResourcesUsedByPart(partType, partName)) {
+    dependencies.insert(ProjectDependencyNode(
+        ProjectDependencyNode::ResourceNode, resourceName));
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,217 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/IDE/Project/ResourcesUsageIndex.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Project;
+class Layout;
+class ExternalLayout;
+class ExternalEvents;
+class EventsFunctionsExtension;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A part of the project (or a resource) in a
+ * gd::ProjectDependencyGraph.
+ *
+ * Events-based behaviors and objects are named with their full type
+ * (`ExtensionName::BehaviorName`).
+ */
+class GD_CORE_API ProjectDependencyNode {
+ public:
+  enum Type {
+    LayoutNode,
+    ExternalLayoutNode,
+    ExternalEventsNode,
+    EventsFunctionsExtensionNode,
+    EventsBasedBehaviorNode,
+    EventsBasedObjectNode,
+    ResourceNode
+  };
+
+  ProjectDependencyNode(Type type_, const gd::String& name_)
+      : type(type_), name(name_){};
+
+  Type GetType() const { return type; }
+  const gd::String& GetName() const { return name; }
+
+  bool operator==(const ProjectDependencyNode& other) const {
+    return type == other.type && name == other.name;
+  }
+  bool operator!=(const ProjectDependencyNode& other) const {
+    return !(*this == other);
+  }
+  bool operator<(const ProjectDependencyNode& other) const {
+    return type != other.type ? type < other.type : name < other.name;
+  }
+
+ private:
+  Type type;
+  gd::String name;
+};
+
+/**
+ * \brief Graph of the dependencies between the parts of a project, kept up to
+ * date part by part, so that only what is affected by a change has to be
+ * generated or exported again.
+ *
+ * A node depends on:
+ * - the layouts and external events it links to (link events),
+ * - the events-based behaviors and objects used by its objects,
+ * - the events functions extensions, behaviors and objects whose functions
+ * are used in its events,
+ * - the resources it uses (see gd::ResourcesUsageIndex).
+ *
+ * External layouts depend on their associated layout and events-based
+ * behaviors and objects depend on their extension.
+ *
+ * The graph is built once with AnalyzeWholeProject. Then, when a part of the
+ * project is modified, it must be analyzed again with the corresponding
+ * `Update*` method (and removed with the corresponding `Remove*` method).
+ * Each update increases the version of the graph, so that the nodes
+ * affected by the changes made since a given version can be retrieved with
+ * GetDirtyNodesSince.
+ *
+ * \see gd::DependenciesAnalyzer
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ProjectDependencyGraph {
+ public:
+  ProjectDependencyGraph() : version(0){};
+  virtual ~ProjectDependencyGraph(){};
+
+  /**
+   * \brief Clear the graph and analyze all the parts of the project.
+   */
+  void AnalyzeWholeProject(gd::Project& project);
+
+  /**
+   * \brief Analyze again the objects, the layers and the events of a layout.
+   */
+  void UpdateLayout(gd::Project& project, gd::Layout& layout);
+
+  /**
+   * \brief Analyze again an external layout.
+   */
+  void UpdateExternalLayout(gd::Project& project,
+                            gd::ExternalLayout& externalLayout);
+
+  /**
+   * \brief Analyze again the events of external events.
+   */
+  void UpdateExternalEvents(gd::Project& project,
+                            gd::ExternalEvents& externalEvents);
+
+  /**
+   * \brief Analyze again an extension and its events-based behaviors and
+   * objects.
+   */
+  void UpdateEventsFunctionsExtension(
+      gd::Project& project,
+      gd::EventsFunctionsExtension& eventsFunctionsExtension);
+
+  void RemoveLayout(const gd::String& layoutName);
+  void RemoveExternalLayout(const gd::String& externalLayoutName);
+  void RemoveExternalEvents(const gd::String& externalEventsName);
+  void RemoveEventsFunctionsExtension(const gd::String& extensionName);
+
+  /**
+   * \brief Mark a node as modified without analyzing it again, for instance
+   * when the file of a resource was changed.
+   */
+  void MarkAsModified(const gd::ProjectDependencyNode& node);
+
+  /**
+   * \brief Remove everything from the graph.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the version of the graph, increased each time a node is
+   * updated, removed or marked as modified.
+   */
+  std::size_t GetVersion() const { return version; }
+
+  /**
+   * \brief Return true if the node is a part of the project analyzed in the
+   * graph or is used by one of them.
+   */
+  bool HasNode(const gd::ProjectDependencyNode& node) const;
+
+  /**
+   * \brief Return the nodes directly used by a node.
+   */
+  const std::set<gd::ProjectDependencyNode>& GetDependencies(
+      const gd::ProjectDependencyNode& node) const;
+
+  /**
+   * \brief Return the nodes directly using a node.
+   */
+  const std::set<gd::ProjectDependencyNode>& GetDependents(
+      const gd::ProjectDependencyNode& node) const;
+
+  /**
+   * \brief Return all the nodes, each one being after all the nodes it
+   * depends on.
+   *
+   * \note Nodes that are part of a cycle (layouts linking to each other for
+   * instance) are put at the end, sorted by type and name.
+   */
+  std::vector<gd::ProjectDependencyNode> GetTopologicalOrder() const;
+
+  /**
+   * \brief Return the nodes modified since the given version and all the
+   * nodes depending on them, directly or not, in topological order.
+   */
+  std::vector<gd::ProjectDependencyNode> GetDirtyNodesSince(
+      std::size_t sinceVersion) const;
+
+  /**
+   * \brief Return the names of the nodes of the given type returned by
+   * GetDirtyNodesSince.
+   */
+  std::vector<gd::String> GetDirtyNamesSince(
+      gd::ProjectDependencyNode::Type type, std::size_t sinceVersion) const;
+
+ private:
+  typedef std::set<gd::ProjectDependencyNode> NodesSet;
+
+  void SetDependencies(const gd::ProjectDependencyNode& node,
+                       const NodesSet& dependencies);
+  void RemoveNode(const gd::ProjectDependencyNode& node);
+  void AddResourcesDependencies(ResourceUser::PartType partType,
+                                const gd::String& partName,
+                                NodesSet& dependencies) const;
+
+  /**
+   * Nodes used by each analyzed part of the project.
+   */
+  std::map<gd::ProjectDependencyNode, NodesSet> dependenciesByNode;
+  /**
+   * Nodes using each node (reverse of dependenciesByNode).
+   */
+  std::map<gd::ProjectDependencyNode, NodesSet> dependentsByNode;
+  /**
+   * Version of the last modification of each node, including removed ones.
+   */
+  std::map<gd::ProjectDependencyNode, std::size_t> modificationVersions;
+  std::size_t version;
+
+  gd::ResourcesUsageIndex resourcesUsageIndex;
+};
+
+}  // namespace gd
@@ -0,0 +1,47 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/RefactoringChangeset.h"
+
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gd {
+
+RefactoringChangeset &RefactoringChangeset::AddVariablesContainerChanges(
+    gd::VariablesContainer &variablesContainer,
+    const gd::VariablesChangeset &changeset,
+    const gd::SerializerElement &originalSerializedVariables) {
+  variablesContainersChanges.push_back(VariablesContainerChanges{
+      &variablesContainer, changeset, originalSerializedVariables});
+  return *this;
+}
+
+RefactoringChangeset &RefactoringChangeset::AddObjectOrGroupRenamedInScene(
+    gd::Layout &scene, const gd::String &oldName, const gd::String &newName,
+    bool isObjectGroup) {
+  if (oldName == newName || newName.empty() || oldName.empty()) return *this;
+
+  objectOrGroupRenamings.push_back(
+      SceneElementRenaming{&scene, oldName, newName, isObjectGroup});
+  return *this;
+}
+
+RefactoringChangeset &RefactoringChangeset::AddLayerRenamedInScene(
+    gd::Layout &scene, const gd::String &oldName, const gd::String &newName) {
+  if (oldName == newName || newName.empty() || oldName.empty()) return *this;
+
+  layerRenamings.push_back(
+      SceneElementRenaming{&scene, oldName, newName, false});
+  return *this;
+}
+
+void RefactoringChangeset::Clear() {
+  variablesContainersChanges.clear();
+  objectOrGroupRenamings.clear();
+  layerRenamings.clear();
+}
+
+}  // namespace gd
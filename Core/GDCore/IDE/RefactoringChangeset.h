@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class Layout;
+class VariablesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A set of changes made to a project (renaming or removal of variables,
+ * renaming of objects, groups or layers) to be refactored all at once.
+ *
+ * The events of the project are browsed only once when the changeset is
+ * applied, instead of once for each change.
+ *
+ * \see gd::WholeProjectRefactorer::ApplyRefactoringChangeset
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API RefactoringChangeset {
+ public:
+  /**
+   * \brief Changes made to the variables of a container.
+   */
+  struct VariablesContainerChanges {
+    gd::VariablesContainer *variablesContainer;
+    gd::VariablesChangeset changeset;
+    gd::SerializerElement originalSerializedVariables;
+  };
+
+  /**
+   * \brief The renaming of an element (object, group or layer) of a scene.
+   */
+  struct SceneElementRenaming {
+    gd::Layout *scene;
+    gd::String oldName;
+    gd::String newName;
+    bool isObjectGroup;
+  };
+
+  RefactoringChangeset(){};
+  virtual ~RefactoringChangeset(){};
+
+  /**
+   * \brief Add the changes (renaming, deletion or type change) made to
+   * variables.
+   *
+   * \note A variables container must only be added once.
+   * \see gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainer
+   */
+  RefactoringChangeset &AddVariablesContainerChanges(
+      gd::VariablesContainer &variablesContainer,
+      const gd::VariablesChangeset &changeset,
+      const gd::SerializerElement &originalSerializedVariables);
+
+  /**
+   * \brief Add the renaming of an object or a group of a scene.
+   *
+   * \see gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene
+   */
+  RefactoringChangeset &AddObjectOrGroupRenamedInScene(
+      gd::Layout &scene, const gd::String &oldName, const gd::String &newName,
+      bool isObjectGroup);
+
+  /**
+   * \brief Add the renaming of a layer of a scene.
+   *
+   * \see gd::WholeProjectRefactorer::RenameLayerInScene
+   */
+  RefactoringChangeset &AddLayerRenamedInScene(gd::Layout &scene,
+                                               const gd::String &oldName,
+                                               const gd::String &newName);
+
+  /**
+   * \brief Return true if there is no change.
+   */
+  bool IsEmpty() const {
+    return variablesContainersChanges.empty() &&
+           objectOrGroupRenamings.empty() && layerRenamings.empty();
+  };
+
+  /**
+   * \brief Remove all the changes.
+   */
+  void Clear();
+
+  const std::vector<VariablesContainerChanges> &
+  GetVariablesContainersChanges() const {
+    return variablesContainersChanges;
+  };
+
+  const std::vector<SceneElementRenaming> &GetObjectOrGroupRenamings() const {
+    return objectOrGroupRenamings;
+  };
+
+  const std::vector<SceneElementRenaming> &GetLayerRenamings() const {
+    return layerRenamings;
+  };
+
+ private:
+  std::vector<VariablesContainerChanges> variablesContainersChanges;
+  std::vector<SceneElementRenaming> objectOrGroupRenamings;
+  std::vector<SceneElementRenaming> layerRenamings;
+};
+
+}  // namespace gd
@@ -19,6 +19,7 @@
 #include "GDCore/IDE/Events/BehaviorTypeRenamer.h"
 #include "GDCore/IDE/Events/CustomObjectTypeRenamer.h"
 #include "GDCore/IDE/Events/EventsBehaviorRenamer.h"
+#include "GDCore/IDE/Events/EventsObjectReplacer.h"
 #include "GDCore/IDE/Events/EventsParameterReplacer.h"
 #include "GDCore/IDE/Events/EventsPropertyReplacer.h"
 #include "GDCore/IDE/Events/EventsRefactorer.h"
@@ -26,6 +27,7 @@
 #include "GDCore/IDE/Events/EventsVariableReplacer.h"
 #include "GDCore/IDE/Events/ExpressionsParameterMover.h"
 #include "GDCore/IDE/Events/ExpressionsRenamer.h"
+#include "GDCore/IDE/Events/FusedEventsWorker.h"
 #include "GDCore/IDE/Events/InstructionsParameterMover.h"
 #include "GDCore/IDE/Events/InstructionsTypeRenamer.h"
 #include "GDCore/IDE/Events/LinkEventTargetRenamer.h"
@@ -38,6 +40,7 @@
 #include "GDCore/IDE/Project/RequiredBehaviorRenamer.h"
 #include "GDCore/IDE/ProjectBrowser.h"
 #include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/IDE/RefactoringChangeset.h"
 #include "GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h"
 #include "GDCore/IDE/WholeProjectBrowser.h"
 #include "GDCore/Project/Behavior.h"
@@ -55,6 +58,7 @@
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 namespace gd {
 
@@ -333,6 +337,48 @@ void WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
       project, eventsVariableInstructionTypeSwitcher);
 }
 
+void WholeProjectRefactorer::ApplyRefactoringForVariablesContainerInParallel(
+    gd::Project &project, gd::VariablesContainer &variablesContainer,
+    const gd::VariablesChangeset &changeset,
+    const gd::SerializerElement &originalSerializedVariables,
+    std::size_t threadsCount) {
+  const gd::Platform &platform = project.GetCurrentPlatform();
+
+  // Revert changes
+  gd::SerializerElement editedSerializedVariables;
+  variablesContainer.SerializeTo(editedSerializedVariables);
+  variablesContainer.UnserializeFrom(originalSerializedVariables);
+
+  // Rename and remove variables
+  try {
+    gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+        project,
+        [&]() {
+          return gd::make_unique<gd::EventsVariableReplacer>(
+              platform, changeset, changeset.removedVariableNames,
+              variablesContainer);
+        },
+        threadsCount);
+  } catch (...) {
+    variablesContainer.UnserializeFrom(editedSerializedVariables);
+    throw;
+  }
+
+  // Apply back changes
+  variablesContainer.UnserializeFrom(editedSerializedVariables);
+
+  // Switch types of instructions
+  if (changeset.typeChangedVariableNames.empty()) return;
+
+  gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+      project,
+      [&]() {
+        return gd::make_unique<gd::EventsVariableInstructionTypeSwitcher>(
+            platform, changeset.typeChangedVariableNames, variablesContainer);
+      },
+      threadsCount);
+}
+
 void WholeProjectRefactorer::ApplyRefactoringForGroupVariablesContainer(
     gd::Project &project, gd::ObjectsContainer &globalObjectsContainer,
     gd::ObjectsContainer &objectsContainer,
@@ -347,7 +393,10 @@ void WholeProjectRefactorer::ApplyRefactoringForGroupVariablesContainer(
   // trigger any refactoring.
   std::unordered_set<gd::String> removedVariableNames;
 
-  // Rename variables in events for the objects of the group.
+  // Rename variables in events for the objects of the group and for the
+  // group, browsing the events only once.
+  std::vector<std::unique_ptr<gd::EventsVariableReplacer>>
+      eventsVariableReplacers;
   for (const gd::String &objectName : objectGroup.GetAllObjectsNames()) {
     const bool hasObject = objectsContainer.HasObjectNamed(objectName);
     if (!hasObject && !globalObjectsContainer.HasObjectNamed(objectName)) {
@@ -357,17 +406,17 @@ void WholeProjectRefactorer::ApplyRefactoringForGroupVariablesContainer(
                              : globalObjectsContainer.GetObject(objectName);
     auto &variablesContainer = object.GetVariables();
 
-    gd::EventsVariableReplacer eventsVariableReplacer(
+    eventsVariableReplacers.push_back(gd::make_unique<gd::EventsVariableReplacer>(
         project.GetCurrentPlatform(), changeset,
-        removedVariableNames, variablesContainer);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project,
-                                                  eventsVariableReplacer);
+        removedVariableNames, variablesContainer));
   }
-
-  // Rename variables in events for the group.
-  gd::EventsVariableReplacer eventsVariableReplacer(
+  eventsVariableReplacers.push_back(gd::make_unique<gd::EventsVariableReplacer>(
       project.GetCurrentPlatform(), changeset, removedVariableNames,
-      objectGroup.GetName());
+      objectGroup.GetName()));
+
+  gd::FusedEventsWorker eventsVariableReplacer;
+  for (auto &worker : eventsVariableReplacers)
+    eventsVariableReplacer.AddWorker(*worker);
   gd::ProjectBrowserHelper::ExposeProjectEvents(project,
                                                 eventsVariableReplacer);
 
@@ -381,7 +430,9 @@ void WholeProjectRefactorer::ApplyRefactoringForGroupVariablesContainer(
       globalObjectsContainer, objectsContainer, groupVariablesContainer,
       objectGroup, changeset);
 
-  // Switch types of instructions for the group objects.
+  // Switch types of instructions for the group objects and for the group.
+  std::vector<std::unique_ptr<gd::EventsVariableInstructionTypeSwitcher>>
+      eventsVariableInstructionTypeSwitchers;
   for (const gd::String &objectName : objectGroup.GetAllObjectsNames()) {
     const bool hasObject = objectsContainer.HasObjectNamed(objectName);
     if (!hasObject && !globalObjectsContainer.HasObjectNamed(objectName)) {
@@ -391,23 +442,175 @@ void WholeProjectRefactorer::ApplyRefactoringForGroupVariablesContainer(
                              : globalObjectsContainer.GetObject(objectName);
     auto &variablesContainer = object.GetVariables();
 
-    gd::EventsVariableInstructionTypeSwitcher
-        eventsVariableInstructionTypeSwitcher(
+    eventsVariableInstructionTypeSwitchers.push_back(
+        gd::make_unique<gd::EventsVariableInstructionTypeSwitcher>(
             project.GetCurrentPlatform(), changeset.typeChangedVariableNames,
-            variablesContainer);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(
-        project, eventsVariableInstructionTypeSwitcher);
+            variablesContainer));
   }
+  eventsVariableInstructionTypeSwitchers.push_back(
+      gd::make_unique<gd::EventsVariableInstructionTypeSwitcher>(
+          project.GetCurrentPlatform(), changeset.typeChangedVariableNames,
+          objectGroup.GetName()));
 
-  // Switch types of instructions for the group.
-  gd::EventsVariableInstructionTypeSwitcher
-      eventsVariableInstructionTypeSwitcher(project.GetCurrentPlatform(),
-                                            changeset.typeChangedVariableNames,
-                                            objectGroup.GetName());
+  gd::FusedEventsWorker eventsVariableInstructionTypeSwitcher;
+  for (auto &worker : eventsVariableInstructionTypeSwitchers)
+    eventsVariableInstructionTypeSwitcher.AddWorker(*worker);
   gd::ProjectBrowserHelper::ExposeProjectEvents(
       project, eventsVariableInstructionTypeSwitcher);
 }
 
+void WholeProjectRefactorer::ApplyRefactoringChangeset(
+    gd::Project &project, const gd::RefactoringChangeset &changeset) {
+  const gd::Platform &platform = project.GetCurrentPlatform();
+  const auto &variablesContainersChanges =
+      changeset.GetVariablesContainersChanges();
+  const auto &objectOrGroupRenamings = changeset.GetObjectOrGroupRenamings();
+  const auto &layerRenamings = changeset.GetLayerRenamings();
+
+  if (!variablesContainersChanges.empty()) {
+    // Revert changes
+    std::vector<gd::SerializerElement> editedSerializedVariables(
+        variablesContainersChanges.size());
+    for (std::size_t i = 0; i < variablesContainersChanges.size(); ++i) {
+      auto &variablesContainer =
+          *variablesContainersChanges[i].variablesContainer;
+      variablesContainer.SerializeTo(editedSerializedVariables[i]);
+      variablesContainer.UnserializeFrom(
+          variablesContainersChanges[i].originalSerializedVariables);
+    }
+
+    // Rename and remove variables
+    std::vector<std::unique_ptr<gd::EventsVariableReplacer>>
+        eventsVariableReplacers;
+    for (const auto &changes : variablesContainersChanges) {
+      eventsVariableReplacers.push_back(
+          gd::make_unique<gd::EventsVariableReplacer>(
+              platform, changes.changeset,
+              changes.changeset.removedVariableNames,
+              *changes.variablesContainer));
+    }
+    ExposeProjectEventsToFusedWorkers(
+        project, [&](gd::FusedEventsWorker &worker, const gd::Layout *scene) {
+          for (auto &replacer : eventsVariableReplacers)
+            worker.AddWorker(*replacer);
+        });
+
+    // Apply back changes
+    for (std::size_t i = 0; i < variablesContainersChanges.size(); ++i) {
+      variablesContainersChanges[i].variablesContainer->UnserializeFrom(
+          editedSerializedVariables[i]);
+    }
+  }
+
+  // Switch types of instructions, then rename objects and layers (variables of
+  // objects are found with the old object names).
+  std::vector<std::unique_ptr<gd::EventsVariableInstructionTypeSwitcher>>
+      eventsVariableInstructionTypeSwitchers;
+  for (const auto &changes : variablesContainersChanges) {
+    if (changes.changeset.typeChangedVariableNames.empty()) continue;
+
+    eventsVariableInstructionTypeSwitchers.push_back(
+        gd::make_unique<gd::EventsVariableInstructionTypeSwitcher>(
+            platform, changes.changeset.typeChangedVariableNames,
+            *changes.variablesContainer));
+  }
+  std::vector<std::unique_ptr<gd::EventsObjectReplacer>> eventsObjectReplacers;
+  for (const auto &renaming : objectOrGroupRenamings) {
+    eventsObjectReplacers.push_back(gd::make_unique<gd::EventsObjectReplacer>(
+        platform, renaming.scene->GetObjects(), renaming.oldName,
+        renaming.newName));
+  }
+  std::vector<std::unique_ptr<gd::ProjectElementRenamer>> layerRenamers;
+  for (const auto &renaming : layerRenamings) {
+    layerRenamers.push_back(gd::make_unique<gd::ProjectElementRenamer>(
+        platform, "layer", renaming.oldName, renaming.newName));
+  }
+  ExposeProjectEventsToFusedWorkers(
+      project, [&](gd::FusedEventsWorker &worker, const gd::Layout *scene) {
+        for (auto &switcher : eventsVariableInstructionTypeSwitchers)
+          worker.AddWorker(*switcher);
+        for (std::size_t i = 0; i < objectOrGroupRenamings.size(); ++i) {
+          if (objectOrGroupRenamings[i].scene == scene)
+            worker.AddWorker(*eventsObjectReplacers[i]);
+        }
+        for (std::size_t i = 0; i < layerRenamings.size(); ++i) {
+          if (layerRenamings[i].scene == scene)
+            worker.AddWorker(*layerRenamers[i]);
+        }
+      });
+
+  // Rename objects in groups and instances (object groups can't have
+  // instances or be in other groups).
+  for (const auto &renaming : objectOrGroupRenamings) {
+    if (renaming.isObjectGroup) continue;
+
+    gd::Layout &scene = *renaming.scene;
+    auto &groups = scene.GetObjects().GetObjectGroups();
+    scene.GetInitialInstances().RenameInstancesOfObject(renaming.oldName,
+                                                        renaming.newName);
+    for (std::size_t g = 0; g < groups.size(); ++g) {
+      groups[g].RenameObject(renaming.oldName, renaming.newName);
+    }
+    for (gd::String name : GetAssociatedExternalLayouts(project, scene)) {
+      project.GetExternalLayout(name).GetInitialInstances()
+          .RenameInstancesOfObject(renaming.oldName, renaming.newName);
+    }
+  }
+
+  // Move instances to the renamed layers.
+  for (const auto &renaming : layerRenamings) {
+    gd::Layout &scene = *renaming.scene;
+    scene.GetInitialInstances().MoveInstancesToLayer(renaming.oldName,
+                                                     renaming.newName);
+    for (gd::String name : GetAssociatedExternalLayouts(project, scene)) {
+      project.GetExternalLayout(name).GetInitialInstances()
+          .MoveInstancesToLayer(renaming.oldName, renaming.newName);
+    }
+  }
+}
+
+void WholeProjectRefactorer::ExposeProjectEventsToFusedWorkers(
+    gd::Project &project,
+    const std::function<void(gd::FusedEventsWorker &worker,
+                             const gd::Layout *scene)> &addWorkers) {
+  // Same events lists as gd::ProjectBrowserHelper::ExposeProjectEvents.
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    auto &layout = project.GetLayout(s);
+    gd::FusedEventsWorker worker;
+    addWorkers(worker, &layout);
+    if (worker.IsEmpty()) continue;
+
+    auto projectScopedContainers = gd::ProjectScopedContainers::
+        MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+    worker.Launch(layout.GetEvents(), projectScopedContainers);
+  }
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    auto &externalEvents = project.GetExternalEvents(s);
+    const gd::String &associatedLayout = externalEvents.GetAssociatedLayout();
+    if (!project.HasLayoutNamed(associatedLayout)) continue;
+
+    auto &layout = project.GetLayout(associatedLayout);
+    gd::FusedEventsWorker worker;
+    addWorkers(worker, &layout);
+    if (worker.IsEmpty()) continue;
+
+    auto projectScopedContainers = gd::ProjectScopedContainers::
+        MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+    worker.Launch(externalEvents.GetEvents(), projectScopedContainers);
+  }
+
+  gd::FusedEventsWorker worker;
+  addWorkers(worker, nullptr);
+  if (worker.IsEmpty()) return;
+
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto &eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    gd::ProjectBrowserHelper::ExposeEventsFunctionsExtensionEvents(
+        project, eventsFunctionsExtension, worker);
+  }
+}
+
 void WholeProjectRefactorer::UpdateExtensionNameInEventsBasedBehavior(
     gd::Project &project,
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
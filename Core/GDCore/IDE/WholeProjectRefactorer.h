@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <functional>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
@@ -32,6 +33,8 @@ class UnfilledRequiredBehaviorPropertyProblem;
 class ProjectBrowser;
 class SerializerElement;
 class ProjectScopedContainers;
+class RefactoringChangeset;
+class FusedEventsWorker;
 struct VariablesRenamingChangesetNode;
 }  // namespace gd
 
@@ -87,6 +90,25 @@ class GD_CORE_API WholeProjectRefactorer {
       const gd::VariablesChangeset &changeset,
       const gd::SerializerElement &originalSerializedVariables);
 
+  /**
+   * \brief Refactor the project according to the changes (renaming or deletion)
+   * made to variables, like ApplyRefactoringForVariablesContainer, spreading
+   * the layouts, external events and extensions on the given number of
+   * threads.
+   *
+   * If refactoring some events throws, the variables container is left with
+   * the changes and the exception of the first events (in the order of
+   * ApplyRefactoringForVariablesContainer) is thrown once all the other
+   * events are refactored.
+   *
+   * \see gd::ProjectBrowserHelper::ExposeProjectEventsInParallel
+   */
+  static void ApplyRefactoringForVariablesContainerInParallel(
+      gd::Project &project, gd::VariablesContainer &variablesContainer,
+      const gd::VariablesChangeset &changeset,
+      const gd::SerializerElement &originalSerializedVariables,
+      std::size_t threadsCount);
+
   /**
    * \brief Refactor the project according to the changes (renaming or deletion)
    * made to variables of a group.
@@ -99,6 +121,23 @@ class GD_CORE_API WholeProjectRefactorer {
       const gd::VariablesChangeset &changeset,
       const gd::SerializerElement &originalSerializedVariables);
 
+  /**
+   * \brief Refactor the project according to all the changes of the
+   * changeset, as ApplyRefactoringForVariablesContainer,
+   * ObjectOrGroupRenamedInScene and RenameLayerInScene would do for each
+   * change.
+   *
+   * Whatever the number of changes, the events are browsed at most twice: once
+   * to rename and remove variables (with the original variables) and once to
+   * switch the types of instructions (with the edited variables) and rename
+   * objects, groups and layers.
+   *
+   * \note Like for ObjectOrGroupRenamedInScene, objects and groups must still
+   * have their old name.
+   */
+  static void ApplyRefactoringChangeset(
+      gd::Project &project, const gd::RefactoringChangeset &changeset);
+
   /**
    * \brief Refactor the project **before** an events function extension is
    * renamed.
@@ -680,6 +719,15 @@ class GD_CORE_API WholeProjectRefactorer {
   GetAssociatedExternalEvents(gd::Project &project,
                                const gd::String &layoutName);
 
+  /**
+   * \brief Launch on each events list of the project a worker made of the
+   * workers added by the callback (the scene is null for extensions).
+   */
+  static void ExposeProjectEventsToFusedWorkers(
+      gd::Project &project,
+      const std::function<void(gd::FusedEventsWorker &worker,
+                               const gd::Layout *scene)> &addWorkers);
+
   static void DoRenameEventsFunction(gd::Project& project,
                                      const gd::EventsFunction& eventsFunction,
                                      const gd::String& oldFullType,
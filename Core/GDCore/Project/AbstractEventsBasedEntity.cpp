@@ -34,7 +34,7 @@ void AbstractEventsBasedEntity::SerializeTo(SerializerElement& element) const {
 void AbstractEventsBasedEntity::UnserializeFrom(
     gd::Project& project, const SerializerElement& element) {
   description = element.GetStringAttribute("description");
-  name = element.GetStringAttribute("name");
+  SetName(element.GetStringAttribute("name"));
   fullName = element.GetStringAttribute("fullName");
 
   const gd::SerializerElement& eventsFunctionsElement =
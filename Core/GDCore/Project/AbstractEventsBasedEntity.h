@@ -11,6 +11,7 @@
 #include "GDCore/Project/PropertiesContainer.h"
 #include "GDCore/Project/EventsFunctionsContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class SerializerElement;
 class Project;
@@ -63,6 +64,7 @@ class GD_CORE_API AbstractEventsBasedEntity {
    * \brief Set the internal name of the behavior or object.
    */
   AbstractEventsBasedEntity& SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexLink.NotifyRenamed();
     name = name_;
     return *this;
   }
@@ -145,7 +147,12 @@ class GD_CORE_API AbstractEventsBasedEntity {
   ///@}
 
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   gd::String name;
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
   gd::String fullName;
   gd::String description;
   gd::EventsFunctionsContainer eventsFunctionsContainer;
@@ -6,11 +6,13 @@
 #include "CustomConfigurationHelper.h"
 
 #include <map>
+#include <vector>
 
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertiesContainer.h"
+#include "GDCore/Project/PropertiesSchema.h"
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Serialization/SerializerElement.h"
@@ -20,17 +22,17 @@ using namespace gd;
 void CustomConfigurationHelper::InitializeContent(
     const gd::PropertiesContainer &properties,
     gd::SerializerElement &configurationContent) {
+  // The schema is not used as contents are initialized while layouts are
+  // unserialized, possibly on several threads.
   for (auto &&property : properties.GetInternalVector()) {
     auto &element = configurationContent.AddChild(property->GetName());
-    auto propertyType = property->GetType();
+    auto valueType = gd::PropertiesSchema::GetValueType(property->GetType());
 
-    if (propertyType == "String" || propertyType == "Choice" ||
-        propertyType == "Color" || propertyType == "Behavior" ||
-        propertyType == "Resource" || propertyType == "LeaderboardId") {
+    if (valueType == gd::PropertiesSchema::StringValue) {
       element.SetStringValue(property->GetValue());
-    } else if (propertyType == "Number") {
+    } else if (valueType == gd::PropertiesSchema::NumberValue) {
       element.SetDoubleValue(property->GetValue().To<double>());
-    } else if (propertyType == "Boolean") {
+    } else if (valueType == gd::PropertiesSchema::BooleanValue) {
       element.SetBoolValue(property->GetValue() == "true");
     }
   }
@@ -41,33 +43,32 @@ std::map<gd::String, gd::PropertyDescriptor> CustomConfigurationHelper::GetPrope
     const gd::SerializerElement &configurationContent) {
   auto objectProperties = std::map<gd::String, gd::PropertyDescriptor>();
 
-  for (auto &property : properties.GetInternalVector()) {
-    const auto &propertyName = property->GetName();
-    const auto &propertyType = property->GetType();
-
-    // Copy the property
-    objectProperties[propertyName] = *property;
+  const auto &schema = properties.GetSchema();
+  std::vector<gd::PropertyDescriptor *> propertiesBySlot;
+  propertiesBySlot.reserve(schema.GetSlotsCount());
+  for (std::size_t slot = 0; slot < schema.GetSlotsCount(); ++slot) {
+    // Copy the property. If no value was serialized for this property,
+    // it will have the default value coming from the descriptor.
+    auto &newProperty = objectProperties[schema.GetSlotName(slot)];
+    newProperty = schema.GetSlotDescriptor(slot);
+    propertiesBySlot.push_back(&newProperty);
+  }
 
-    auto &newProperty = objectProperties[propertyName];
+  // Children are iterated once, instead of searching each property by name.
+  std::vector<bool> hasValue(schema.GetSlotsCount(), false);
+  for (const auto &child : configurationContent.GetAllChildren()) {
+    std::size_t slot = schema.GetSlot(child.first);
+    if (slot == gd::String::npos || hasValue[slot]) continue;
+    hasValue[slot] = true;
 
-    if (configurationContent.HasChild(propertyName)) {
-      if (propertyType == "String" || propertyType == "Choice" ||
-          propertyType == "Color" || propertyType == "Behavior" ||
-          propertyType == "Resource" || propertyType == "LeaderboardId") {
-        newProperty.SetValue(
-            configurationContent.GetChild(propertyName).GetStringValue());
-      } else if (propertyType == "Number") {
-        newProperty.SetValue(gd::String::From(
-            configurationContent.GetChild(propertyName).GetDoubleValue()));
-      } else if (propertyType == "Boolean") {
-        newProperty.SetValue(
-            configurationContent.GetChild(propertyName).GetBoolValue()
-                ? "true"
-                : "false");
-      }
-    } else {
-      // No value was serialized for this property. `newProperty`
-      // will have the default value coming from `enumeratedProperty`.
+    auto &newProperty = *propertiesBySlot[slot];
+    auto valueType = schema.GetSlotValueType(slot);
+    if (valueType == gd::PropertiesSchema::StringValue) {
+      newProperty.SetValue(child.second->GetStringValue());
+    } else if (valueType == gd::PropertiesSchema::NumberValue) {
+      newProperty.SetValue(gd::String::From(child.second->GetDoubleValue()));
+    } else if (valueType == gd::PropertiesSchema::BooleanValue) {
+      newProperty.SetValue(child.second->GetBoolValue() ? "true" : "false");
     }
   }
 
@@ -79,23 +80,22 @@ bool CustomConfigurationHelper::UpdateProperty(
     gd::SerializerElement &configurationContent,
     const gd::String &propertyName,
     const gd::String &newValue) {
-  if (!properties.Has(propertyName)) {
+  const auto &schema = properties.GetSchema();
+  std::size_t slot = schema.GetSlot(propertyName);
+  if (slot == gd::String::npos) {
     return false;
   }
-  const auto &property = properties.Get(propertyName);
 
   auto &element = configurationContent.AddChild(propertyName);
-  const gd::String &propertyType = property.GetType();
+  auto valueType = schema.GetSlotValueType(slot);
 
-  if (propertyType == "String" || propertyType == "Choice" ||
-      propertyType == "Color" || propertyType == "Behavior" ||
-      propertyType == "Resource" || propertyType == "LeaderboardId") {
+  if (valueType == gd::PropertiesSchema::StringValue) {
     element.SetStringValue(newValue);
-  } else if (propertyType == "Number") {
+  } else if (valueType == gd::PropertiesSchema::NumberValue) {
     element.SetDoubleValue(newValue.To<double>());
-  } else if (propertyType == "Boolean") {
+  } else if (valueType == gd::PropertiesSchema::BooleanValue) {
     element.SetBoolValue(newValue == "1");
   }
 
   return true;
-}
\ No newline at end of file
+}
@@ -7,6 +7,7 @@
 #include "EventsFunction.h"
 #include <vector>
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/ContentHash.h"
 #include "GDCore/Project/EventsFunctionsContainer.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadata.h"
 
@@ -57,6 +58,18 @@ const gd::ParameterMetadataContainer &EventsFunction::GetParametersForEvents(
 }
 
 void EventsFunction::SerializeTo(SerializerElement& element) const {
+  SerializeTo(element, true);
+}
+
+std::uint64_t EventsFunction::GetContentHash() const {
+  SerializerElement element;
+  SerializeTo(element, false);
+  return gd::ContentHash::Combine(gd::ContentHash::Of(element),
+                                  events.GetContentHash());
+}
+
+void EventsFunction::SerializeTo(SerializerElement& element,
+                                 bool withEvents) const {
   element.SetAttribute("name", name);
   element.SetAttribute("fullName", fullName);
   if (!description.empty()) {
@@ -75,7 +88,7 @@ void EventsFunction::SerializeTo(SerializerElement& element) const {
   if (isAsync) {
     element.SetBoolAttribute("async", isAsync);
   }
-  events.SerializeTo(element.AddChild("events"));
+  if (withEvents) events.SerializeTo(element.AddChild("events"));
 
   gd::String functionTypeStr = "Action";
   if (functionType == Condition)
@@ -108,7 +121,7 @@ void EventsFunction::SerializeTo(SerializerElement& element) const {
 
 void EventsFunction::UnserializeFrom(gd::Project& project,
                                      const SerializerElement& element) {
-  name = element.GetStringAttribute("name");
+  SetName(element.GetStringAttribute("name"));
   fullName = element.GetStringAttribute("fullName");
   description = element.GetStringAttribute("description");
   sentence = element.GetStringAttribute("sentence");
@@ -5,12 +5,14 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/ParameterMetadataContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 #include "GDCore/Extensions/Metadata/ValueTypeMetadata.h"
 // TODO: In theory (for separation of concerns between Project and
 // extensions/events), this include should be removed and gd::ParameterMetadata
@@ -71,6 +73,7 @@ class GD_CORE_API EventsFunction {
    * action/condition/expression name.
    */
   EventsFunction& SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexLink.NotifyRenamed();
     name = name_;
     return *this;
   }
@@ -289,8 +292,25 @@ class GD_CORE_API EventsFunction {
                        const gd::SerializerElement& element);
   ///@}
 
+  /**
+   * \brief Return a hash of the function, including its events.
+   *
+   * The declaration of the function is hashed at each call, the hash of the
+   * events is cached by the events list.
+   *
+   * \see gd::ContentHash
+   */
+  std::uint64_t GetContentHash() const;
+
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
+  void SerializeTo(gd::SerializerElement& element, bool withEvents) const;
+
   gd::String name;
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
   gd::String fullName;
   gd::String description;
   gd::String sentence;
@@ -9,6 +9,7 @@
 #include "EventsBasedObject.h"
 #include "EventsFunction.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/ContentHash.h"
 #include "GDCore/Tools/MakeUnique.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 
@@ -35,11 +36,12 @@ EventsFunctionsExtension& EventsFunctionsExtension::operator=(
 }
 
 void EventsFunctionsExtension::Init(const gd::EventsFunctionsExtension& other) {
+  MarkAsModified();
   version = other.version;
   extensionNamespace = other.extensionNamespace;
   shortDescription = other.shortDescription;
   description = other.description;
-  name = other.name;
+  SetName(other.name);
   fullName = other.fullName;
   category = other.category;
   tags = other.tags;
@@ -56,6 +58,12 @@ void EventsFunctionsExtension::Init(const gd::EventsFunctionsExtension& other) {
 }
 
 void EventsFunctionsExtension::SerializeTo(SerializerElement& element) const {
+  SerializeTo(element, true);
+}
+
+void EventsFunctionsExtension::SerializeTo(
+    SerializerElement& element,
+    bool withVariablesFunctionsBehaviorsAndObjects) const {
   element.SetAttribute("version", version);
   element.SetAttribute("extensionNamespace", extensionNamespace);
   element.SetAttribute("shortDescription", shortDescription);
@@ -87,6 +95,8 @@ void EventsFunctionsExtension::SerializeTo(SerializerElement& element) const {
   for (auto& dependency : dependencies)
     SerializeDependencyTo(dependency, dependenciesElement.AddChild(""));
 
+  if (!withVariablesFunctionsBehaviorsAndObjects) return;
+
   GetGlobalVariables().SerializeTo(element.AddChild("globalVariables"));
   GetSceneVariables().SerializeTo(element.AddChild("sceneVariables"));
 
@@ -97,6 +107,30 @@ void EventsFunctionsExtension::SerializeTo(SerializerElement& element) const {
       "eventsBasedObject", element.AddChild("eventsBasedObjects"));
 }
 
+std::uint64_t EventsFunctionsExtension::GetContentHash() const {
+  if (isContentHashOutdated) {
+    SerializerElement element;
+    eventsBasedBehaviors.SerializeElementsTo(
+        "eventsBasedBehavior", element.AddChild("eventsBasedBehaviors"));
+    eventsBasedObjects.SerializeElementsTo(
+        "eventsBasedObject", element.AddChild("eventsBasedObjects"));
+    behaviorsAndObjectsContentHash = gd::ContentHash::Of(element);
+    isContentHashOutdated = false;
+  }
+
+  SerializerElement declarationElement;
+  SerializeTo(declarationElement, false);
+  std::uint64_t hash = gd::ContentHash::Combine(
+      gd::ContentHash::Of(declarationElement), globalVariables.GetContentHash());
+  hash = gd::ContentHash::Combine(hash, sceneVariables.GetContentHash());
+  hash = gd::ContentHash::Combine(hash, GetEventsFunctionsCount());
+  for (std::size_t i = 0; i < GetEventsFunctionsCount(); ++i) {
+    hash = gd::ContentHash::Combine(hash,
+                                    GetEventsFunction(i).GetContentHash());
+  }
+  return gd::ContentHash::Combine(hash, behaviorsAndObjectsContentHash);
+}
+
 void EventsFunctionsExtension::UnserializeFrom(
     gd::Project& project, const SerializerElement& element) {
   // Unserialize first the "declaration" (everything but objects content)
@@ -108,11 +142,12 @@ void EventsFunctionsExtension::UnserializeFrom(
 
 void EventsFunctionsExtension::UnserializeExtensionDeclarationFrom(
     gd::Project& project, const SerializerElement& element) {
+  MarkAsModified();
   version = element.GetStringAttribute("version");
   extensionNamespace = element.GetStringAttribute("extensionNamespace");
   shortDescription = element.GetStringAttribute("shortDescription");
   description = element.GetChild("description").GetMultilineStringValue();
-  name = element.GetStringAttribute("name");
+  SetName(element.GetStringAttribute("name"));
   fullName = element.GetStringAttribute("fullName");
   category = element.GetStringAttribute("category");
   author = element.GetStringAttribute("author");
@@ -187,6 +222,7 @@ void EventsFunctionsExtension::UnserializeExtensionDeclarationFrom(
 void EventsFunctionsExtension::UnserializeExtensionImplementationFrom(
     gd::Project& project,
     const SerializerElement& element) {
+  MarkAsModified();
   UnserializeEventsFunctionsFrom(project, element.GetChild("eventsFunctions"));
   eventsBasedBehaviors.UnserializeElementsFrom(
       "eventsBasedBehavior", project, element.GetChild("eventsBasedBehaviors"));
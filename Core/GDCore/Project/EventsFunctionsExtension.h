@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
@@ -13,6 +14,7 @@
 #include "GDCore/Project/EventsFunctionsContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 #include "GDCore/Tools/SerializableWithNameList.h"
 namespace gd {
 class SerializerElement;
@@ -77,6 +79,7 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
 
   const gd::String& GetName() const { return name; };
   EventsFunctionsExtension& SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexLink.NotifyRenamed();
     name = name_;
     return *this;
   }
@@ -137,6 +140,7 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
    * \brief Return a reference to the list of the events based behaviors.
    */
   gd::SerializableWithNameList<EventsBasedBehavior>& GetEventsBasedBehaviors() {
+    MarkAsModified();
     return eventsBasedBehaviors;
   }
 
@@ -152,6 +156,7 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
    * \brief Return a reference to the list of the events based objects.
    */
   gd::SerializableWithNameList<EventsBasedObject>& GetEventsBasedObjects() {
+    MarkAsModified();
     return eventsBasedObjects;
   }
 
@@ -289,13 +294,40 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
       const gd::String& eventsFunctionName);
   ///@}
 
+  /**
+   * \brief Return a hash of the extension, including its variables, free
+   * functions, behaviors and objects.
+   *
+   * The declaration of the extension is hashed at each call. The hash of the
+   * behaviors and objects is only computed again after they were modified
+   * through the methods of the extension (getting them with a non-const
+   * accessor counts as a modification). The hashes of the variables and of
+   * the events of free functions are cached by themselves.
+   *
+   * \see gd::ContentHash
+   */
+  std::uint64_t GetContentHash() const;
+
+  /**
+   * \brief Mark the behaviors and objects of the extension as modified, so
+   * that their hash is computed again. To be called after modifying them
+   * through references obtained before the last call to GetContentHash.
+   */
+  void MarkAsModified() { isContentHashOutdated = true; }
+
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   /**
    * Initialize object using another object. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
    */
   void Init(const gd::EventsFunctionsExtension& other);
 
+  void SerializeTo(gd::SerializerElement& element,
+                   bool withVariablesFunctionsBehaviorsAndObjects) const;
+
   void SerializeDependencyTo(const gd::DependencyMetadata& dependency,
                              gd::SerializerElement& serializer) const {
     serializer.SetStringAttribute("type", dependency.GetDependencyType());
@@ -322,6 +354,8 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
   gd::String shortDescription;
   gd::String description;
   gd::String name;
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
   gd::String fullName;
   gd::String category;
   std::vector<gd::String> tags;
@@ -339,6 +373,10 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
   
   gd::VariablesContainer globalVariables;
   gd::VariablesContainer sceneVariables;
+
+  mutable std::uint64_t
+      behaviorsAndObjectsContentHash = 0;     ///< \see GetContentHash
+  mutable bool isContentHashOutdated = true;  ///< \see GetContentHash
 };
 
 }  // namespace gd
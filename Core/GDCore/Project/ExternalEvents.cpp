@@ -36,7 +36,7 @@ void ExternalEvents::SerializeTo(SerializerElement& element) const {
 
 void ExternalEvents::UnserializeFrom(gd::Project& project,
                                      const SerializerElement& element) {
-  name = element.GetStringAttribute("name", "", "Name");
+  SetName(element.GetStringAttribute("name", "", "Name"));
   associatedScene =
       element.GetStringAttribute("associatedLayout", "", "AssociatedScene");
   gd::EventsListSerialization::UnserializeEventsFrom(
@@ -11,6 +11,7 @@
 
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class BaseEvent;
 }
@@ -48,7 +49,10 @@ class GD_CORE_API ExternalEvents {
   /**
    * \brief Change external events name
    */
-  virtual void SetName(const gd::String& name_) { name = name_; };
+  virtual void SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexLink.NotifyRenamed();
+    name = name_;
+  };
 
   /**
    * \brief Get the layout associated with external events.
@@ -89,7 +93,12 @@ class GD_CORE_API ExternalEvents {
                                const SerializerElement& element);
 
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   gd::String name;
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
   gd::String associatedScene;
   gd::EventsList events;       ///< List of events
 
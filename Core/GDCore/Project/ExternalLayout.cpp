@@ -13,7 +13,7 @@
 namespace gd {
 
 void ExternalLayout::UnserializeFrom(const SerializerElement& element) {
-  name = element.GetStringAttribute("name", "", "Name");
+  SetName(element.GetStringAttribute("name", "", "Name"));
   instances.UnserializeFrom(element.GetChild("instances", 0, "Instances"));
   editorSettings.UnserializeFrom(element.GetChild("editionSettings"));
   associatedLayout = element.GetStringAttribute("associatedLayout");
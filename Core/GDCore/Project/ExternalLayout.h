@@ -10,6 +10,7 @@
 
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -39,7 +40,10 @@ class GD_CORE_API ExternalLayout {
   /**
    * \brief Change the name of the external layout.
    */
-  void SetName(const gd::String& name_) { name = name_; }
+  void SetName(const gd::String& name_) {
+    if (name_ != name) nameIndexLink.NotifyRenamed();
+    name = name_;
+  }
 
   /**
    * \brief Return the container storing initial instances.
@@ -90,7 +94,12 @@ class GD_CORE_API ExternalLayout {
   ///@}
 
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   gd::String name;
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
   gd::InitialInstancesContainer instances;
   gd::EditorSettings editorSettings;
   gd::String associatedLayout;
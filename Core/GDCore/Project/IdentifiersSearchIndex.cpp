@@ -0,0 +1,240 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/IdentifiersSearchIndex.h"
+
+#include <algorithm>
+
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace {
+
+bool IsAsciiLetterOrDigit(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9');
+}
+
+bool IsAsciiLowerCase(char c) { return c >= 'a' && c <= 'z'; }
+
+bool IsAsciiUpperCase(char c) { return c >= 'A' && c <= 'Z'; }
+
+/**
+ * Check if a word starts at the given position of the name: after a character
+ * which is not a letter or a digit (like an underscore) or at an uppercase
+ * letter following a lowercase letter ("camelCase").
+ *
+ * \param name The name, with the same bytes as the folded name except for the
+ * case (this is only true for ASCII names, otherwise the folded name itself
+ * must be given).
+ */
+bool IsWordStart(const std::string& name, std::size_t offset) {
+  char previous = name[offset - 1];
+  if (!IsAsciiLetterOrDigit(previous) &&
+      static_cast<unsigned char>(previous) < 0x80)
+    return true;
+
+  return IsAsciiLowerCase(previous) && IsAsciiUpperCase(name[offset]);
+}
+
+}  // namespace
+
+namespace gd {
+
+void IdentifiersSearchIndex::IndexObjectsContainer(
+    const gd::ObjectsContainer& objectsContainer) {
+  NamesIndex& namesIndex = objectsContainersNames[&objectsContainer];
+  namesIndex = NamesIndex();
+  for (const auto& object : objectsContainer.GetObjects())
+    namesIndex.Add(object->GetName(), &object->GetConfiguration());
+
+  const gd::ObjectGroupsContainer& groups =
+      objectsContainer.GetObjectGroups();
+  for (std::size_t i = 0; i < groups.size(); ++i)
+    namesIndex.Add(groups[i].GetName(), nullptr);
+
+  namesIndex.SortSuffixes();
+}
+
+void IdentifiersSearchIndex::IndexVariablesContainer(
+    const gd::VariablesContainer& variablesContainer) {
+  NamesIndex& namesIndex = variablesContainersNames[&variablesContainer];
+  namesIndex = NamesIndex();
+  for (std::size_t i = 0; i < variablesContainer.Count(); ++i) {
+    namesIndex.Add(variablesContainer.GetNameAt(i),
+                   &variablesContainer.Get(i));
+  }
+
+  namesIndex.SortSuffixes();
+}
+
+void IdentifiersSearchIndex::RemoveObjectsContainer(
+    const gd::ObjectsContainer& objectsContainer) {
+  objectsContainersNames.erase(&objectsContainer);
+}
+
+void IdentifiersSearchIndex::RemoveVariablesContainer(
+    const gd::VariablesContainer& variablesContainer) {
+  variablesContainersNames.erase(&variablesContainer);
+}
+
+void IdentifiersSearchIndex::Clear() {
+  objectsContainersNames.clear();
+  variablesContainersNames.clear();
+}
+
+void IdentifiersSearchIndex::ForEachNameMatchingSearch(
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::String& search,
+    std::function<void(const gd::String& name,
+                       const gd::ObjectConfiguration* objectConfiguration)> fn)
+    const {
+  auto it = objectsContainersNames.find(&objectsContainer);
+  if (it == objectsContainersNames.end()) {
+    for (const auto& object : objectsContainer.GetObjects()) {
+      if (object->GetName().FindCaseInsensitive(search) != gd::String::npos)
+        fn(object->GetName(), &object->GetConfiguration());
+    }
+    objectsContainer.GetObjectGroups().ForEachNameMatchingSearch(
+        search, [&](const gd::String& name) { fn(name, nullptr); });
+    return;
+  }
+
+  it->second.ForEachNameMatchingSearch(
+      search.CaseFold().Raw(),
+      [&](const gd::String& name, const void* element) {
+        fn(name, static_cast<const gd::ObjectConfiguration*>(element));
+      });
+}
+
+void IdentifiersSearchIndex::ForEachVariableMatchingSearch(
+    const gd::VariablesContainer& variablesContainer,
+    const gd::String& search,
+    std::function<void(const gd::String& name, const gd::Variable& variable)>
+        fn) const {
+  auto it = variablesContainersNames.find(&variablesContainer);
+  if (it == variablesContainersNames.end()) {
+    variablesContainer.ForEachVariableMatchingSearch(search, fn);
+    return;
+  }
+
+  it->second.ForEachNameMatchingSearch(
+      search.CaseFold().Raw(),
+      [&](const gd::String& name, const void* element) {
+        fn(name, *static_cast<const gd::Variable*>(element));
+      });
+}
+
+void IdentifiersSearchIndex::NamesIndex::Add(const gd::String& name,
+                                             const void* element) {
+  names.push_back(Name{name, name.CaseFold().Raw(), element});
+}
+
+void IdentifiersSearchIndex::NamesIndex::SortSuffixes() {
+  suffixes.clear();
+  for (std::uint32_t nameIndex = 0; nameIndex < names.size(); ++nameIndex) {
+    const std::string& foldedName = names[nameIndex].foldedName;
+    // Word starts are found using the case of the name, if its bytes are the
+    // same as the folded name (except for the case).
+    const std::string& casedName =
+        names[nameIndex].name.Raw().size() == foldedName.size()
+            ? names[nameIndex].name.Raw()
+            : foldedName;
+
+    for (std::uint32_t offset = 0; offset < foldedName.size(); ++offset) {
+      // Only index the suffixes starting at a character (not in the middle of
+      // an UTF-8 sequence).
+      if ((static_cast<unsigned char>(foldedName[offset]) & 0xC0) == 0x80)
+        continue;
+
+      Relevance relevance = offset == 0 ? Prefix
+                            : IsWordStart(casedName, offset) ? WordStart
+                                                             : Inside;
+      suffixes.push_back(Suffix{nameIndex, offset, relevance});
+    }
+  }
+
+  std::sort(suffixes.begin(),
+            suffixes.end(),
+            [this](const Suffix& suffix1, const Suffix& suffix2) {
+              return names[suffix1.nameIndex].foldedName.compare(
+                         suffix1.offset,
+                         std::string::npos,
+                         names[suffix2.nameIndex].foldedName,
+                         suffix2.offset,
+                         std::string::npos) < 0;
+            });
+}
+
+void IdentifiersSearchIndex::NamesIndex::ForEachNameMatchingSearch(
+    const std::string& foldedSearch,
+    std::function<void(const gd::String& name, const void* element)> fn)
+    const {
+  if (foldedSearch.empty()) {
+    for (const auto& name : names) fn(name.name, name.element);
+    return;
+  }
+
+  // Find the suffixes starting with the search: they are all consecutive.
+  auto it = std::lower_bound(
+      suffixes.begin(),
+      suffixes.end(),
+      foldedSearch,
+      [this](const Suffix& suffix, const std::string& search) {
+        return names[suffix.nameIndex].foldedName.compare(
+                   suffix.offset, std::string::npos, search) < 0;
+      });
+
+  struct Match {
+    std::uint32_t nameIndex;
+    Relevance relevance;
+  };
+  std::vector<Match> matches;
+  for (; it != suffixes.end(); ++it) {
+    const std::string& foldedName = names[it->nameIndex].foldedName;
+    if (foldedName.compare(it->offset, foldedSearch.size(), foldedSearch) != 0)
+      break;
+
+    matches.push_back(Match{it->nameIndex,
+                            foldedName.size() == foldedSearch.size()
+                                ? Exact
+                                : it->relevance});
+  }
+
+  // Keep the most relevant match of each name.
+  std::sort(matches.begin(),
+            matches.end(),
+            [](const Match& match1, const Match& match2) {
+              return match1.nameIndex != match2.nameIndex
+                         ? match1.nameIndex < match2.nameIndex
+                         : match1.relevance < match2.relevance;
+            });
+  matches.erase(std::unique(matches.begin(),
+                            matches.end(),
+                            [](const Match& match1, const Match& match2) {
+                              return match1.nameIndex == match2.nameIndex;
+                            }),
+                matches.end());
+
+  std::stable_sort(
+      matches.begin(),
+      matches.end(),
+      [this](const Match& match1, const Match& match2) {
+        if (match1.relevance != match2.relevance)
+          return match1.relevance < match2.relevance;
+        return names[match1.nameIndex].foldedName.size() <
+               names[match2.nameIndex].foldedName.size();
+      });
+
+  for (const auto& match : matches) {
+    const Name& name = names[match.nameIndex];
+    fn(name.name, name.element);
+  }
+}
+
+}  // namespace gd
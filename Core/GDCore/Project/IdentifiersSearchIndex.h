@@ -0,0 +1,156 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectConfiguration;
+class ObjectsContainer;
+class Variable;
+class VariablesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of the names of the objects, groups and variables of some
+ * containers, used to find the names matching a search (for autocompletion
+ * of expressions) without checking every name in scope.
+ *
+ * For each indexed container, all the suffixes of the case folded names are
+ * sorted: the names containing the search (ignoring the case, like
+ * gd::String::FindCaseInsensitive) are found by a binary search, in a time
+ * proportional to the number of matching names.
+ *
+ * Matching names are given from the most relevant: the name equal to the
+ * search, then the names starting with the search, then the names having a
+ * word (after an underscore or a lowercase to uppercase change) starting with
+ * the search and finally the other names. Shorter names come first.
+ *
+ * The index is not updated automatically: after adding, removing or renaming
+ * objects, groups or variables of a container, it must be indexed again. A
+ * container must be removed from the index before being destroyed. Containers
+ * that are not indexed are searched by checking all their names.
+ *
+ * \see gd::ProjectScopedContainers::SetIdentifiersSearchIndex
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API IdentifiersSearchIndex {
+ public:
+  IdentifiersSearchIndex(){};
+  virtual ~IdentifiersSearchIndex(){};
+
+  /**
+   * \brief Index (or index again) the names of the objects and groups of the
+   * container.
+   */
+  void IndexObjectsContainer(const gd::ObjectsContainer& objectsContainer);
+
+  /**
+   * \brief Index (or index again) the names of the variables of the
+   * container.
+   */
+  void IndexVariablesContainer(
+      const gd::VariablesContainer& variablesContainer);
+
+  /**
+   * \brief Remove the container from the index.
+   */
+  void RemoveObjectsContainer(const gd::ObjectsContainer& objectsContainer);
+
+  /**
+   * \brief Remove the container from the index.
+   */
+  void RemoveVariablesContainer(
+      const gd::VariablesContainer& variablesContainer);
+
+  /**
+   * \brief Remove all the containers from the index.
+   */
+  void Clear();
+
+  bool HasObjectsContainer(const gd::ObjectsContainer& objectsContainer) const {
+    return objectsContainersNames.count(&objectsContainer) != 0;
+  };
+
+  bool HasVariablesContainer(
+      const gd::VariablesContainer& variablesContainer) const {
+    return variablesContainersNames.count(&variablesContainer) != 0;
+  };
+
+  /**
+   * \brief Call the callback for each object or group name of the container
+   * matching the search (the object configuration is null for groups).
+   */
+  void ForEachNameMatchingSearch(
+      const gd::ObjectsContainer& objectsContainer,
+      const gd::String& search,
+      std::function<void(const gd::String& name,
+                         const gd::ObjectConfiguration* objectConfiguration)>
+          fn) const;
+
+  /**
+   * \brief Call the callback for each variable of the container having a name
+   * matching the search.
+   */
+  void ForEachVariableMatchingSearch(
+      const gd::VariablesContainer& variablesContainer,
+      const gd::String& search,
+      std::function<void(const gd::String& name, const gd::Variable& variable)>
+          fn) const;
+
+ private:
+  /**
+   * \brief The sorted suffixes of the names of a container.
+   */
+  class NamesIndex {
+   public:
+    void Add(const gd::String& name, const void* element);
+    void SortSuffixes();
+
+    /**
+     * \brief Call the callback for each name containing the (case folded)
+     * search, from the most relevant.
+     */
+    void ForEachNameMatchingSearch(
+        const std::string& foldedSearch,
+        std::function<void(const gd::String& name, const void* element)> fn)
+        const;
+
+   private:
+    enum Relevance : std::uint8_t { Exact, Prefix, WordStart, Inside };
+
+    struct Name {
+      gd::String name;
+      std::string foldedName;
+      const void* element;
+    };
+
+    struct Suffix {
+      std::uint32_t nameIndex;
+      std::uint32_t offset;  ///< The offset of the suffix in the folded name.
+      Relevance relevance;
+    };
+
+    std::vector<Name> names;
+    std::vector<Suffix> suffixes;
+  };
+
+  std::unordered_map<const gd::ObjectsContainer*, NamesIndex>
+      objectsContainersNames;
+  std::unordered_map<const gd::VariablesContainer*, NamesIndex>
+      variablesContainersNames;
+};
+
+}  // namespace gd
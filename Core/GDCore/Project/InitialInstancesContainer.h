@@ -81,6 +81,18 @@ class GD_CORE_API InitialInstancesContainer {
    */
   std::size_t GetInstancesCount() const;
 
+  /**
+   * \brief Return the list of the instances.
+   */
+  const std::list<gd::InitialInstance> &GetInternalList() const {
+    return initialInstances;
+  }
+
+  /**
+   * \brief Return the list of the instances.
+   */
+  std::list<gd::InitialInstance> &GetInternalList() { return initialInstances; }
+
   /**
    * \brief Apply \a func to each instance of the container.
    * \see InitialInstanceFunctor
@@ -7,6 +7,7 @@
 #include "Layout.h"
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
@@ -27,11 +28,21 @@
 #include "GDCore/Project/QuickCustomization.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/ContentHash.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCore/Tools/PolymorphicClone.h"
 
 using namespace std;
 
+namespace {
+
+std::uint64_t NewElementsGeneration() {
+  static std::atomic<std::uint64_t> lastElementsGeneration{0};
+  return ++lastElementsGeneration;
+}
+
+}  // namespace
+
 namespace gd {
 
 gd::BehaviorsSharedData Layout::badBehaviorSharedData("", "");
@@ -57,11 +68,15 @@ Layout::Layout()
       standardSortMethod(true),
       disableInputWhenNotFocused(true),
       variables(gd::VariablesContainer::SourceType::Scene),
-      objectsContainer(gd::ObjectsContainer::SourceType::Scene) {}
+      objectsContainer(gd::ObjectsContainer::SourceType::Scene) {
+  elementsGeneration = NewElementsGeneration();
+}
 
 void Layout::SetName(const gd::String& name_) {
+  if (name_ != name) nameIndexLink.NotifyRenamed();
   name = name_;
   mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(name);
+  MarkAsModified();
 };
 
 bool Layout::HasBehaviorSharedData(const gd::String& behaviorName) {
@@ -86,6 +101,7 @@ const gd::BehaviorsSharedData& Layout::GetBehaviorSharedData(
 
 gd::BehaviorsSharedData& Layout::GetBehaviorSharedData(
     const gd::String& behaviorName) {
+  MarkAsModified();
   auto it = behaviorsSharedData.find(behaviorName);
   if (it != behaviorsSharedData.end()) return *it->second;
 
@@ -98,6 +114,7 @@ Layout::GetAllBehaviorSharedData() const {
 }
 
 gd::Layer& Layout::GetLayer(const gd::String& name) {
+  MarkAsModified();
   return layers.GetLayer(name);
 }
 
@@ -106,6 +123,7 @@ const gd::Layer& Layout::GetLayer(const gd::String& name) const {
 }
 
 gd::Layer& Layout::GetLayer(std::size_t index) {
+  MarkAsModified();
   return layers.GetLayer(index);
 }
 
@@ -124,24 +142,32 @@ std::size_t Layout::GetLayerPosition(const gd::String& name) const {
 
 void Layout::InsertNewLayer(const gd::String& name, std::size_t position) {
   layers.InsertNewLayer(name, position);
+  MarkAsModified();
 }
 
 void Layout::InsertLayer(const gd::Layer& layer, std::size_t position) {
   layers.InsertLayer(layer, position);
+  MarkAsModified();
 }
 
-void Layout::RemoveLayer(const gd::String& name) { layers.RemoveLayer(name); }
+void Layout::RemoveLayer(const gd::String& name) {
+  layers.RemoveLayer(name);
+  MarkAsModified();
+}
 
 void Layout::SwapLayers(std::size_t firstLayerIndex,
                         std::size_t secondLayerIndex) {
   layers.SwapLayers(firstLayerIndex, secondLayerIndex);
+  MarkAsModified();
 }
 
 void Layout::MoveLayer(std::size_t oldIndex, std::size_t newIndex) {
   layers.MoveLayer(oldIndex, newIndex);
+  MarkAsModified();
 }
 
 void Layout::UpdateBehaviorsSharedData(gd::Project& project) {
+  MarkAsModified();
   std::vector<gd::String> allBehaviorsTypes;
   std::vector<gd::String> allBehaviorsNames;
 
@@ -236,6 +262,15 @@ std::unique_ptr<gd::BehaviorsSharedData> Layout::CreateBehaviorsSharedData(
 }
 
 void Layout::SerializeTo(SerializerElement& element) const {
+  SerializeTo(element, true);
+}
+
+void Layout::SerializeSettingsTo(SerializerElement& element) const {
+  SerializeTo(element, false);
+}
+
+void Layout::SerializeTo(SerializerElement& element,
+                         bool withInstancesObjectsAndEvents) const {
   element.SetAttribute("name", GetName());
   element.SetAttribute("mangledName", GetMangledName());
   element.SetAttribute("r", (int)GetBackgroundColorRed());
@@ -252,12 +287,16 @@ void Layout::SerializeTo(SerializerElement& element) const {
   objectsContainer.GetObjectGroups().SerializeTo(
       element.AddChild("objectsGroups"));
   GetVariables().SerializeTo(element.AddChild("variables"));
-  GetInitialInstances().SerializeTo(element.AddChild("instances"));
-  objectsContainer.SerializeObjectsTo(element.AddChild("objects"));
+  if (withInstancesObjectsAndEvents) {
+    GetInitialInstances().SerializeTo(element.AddChild("instances"));
+    objectsContainer.SerializeObjectsTo(element.AddChild("objects"));
+  }
   objectsContainer.SerializeFoldersTo(
       element.AddChild("objectsFolderStructure"));
-  gd::EventsListSerialization::SerializeEventsTo(events,
-                                                 element.AddChild("events"));
+  if (withInstancesObjectsAndEvents) {
+    gd::EventsListSerialization::SerializeEventsTo(events,
+                                                   element.AddChild("events"));
+  }
 
   layers.SerializeLayersTo(element.AddChild("layers"));
 
@@ -297,6 +336,8 @@ void Layout::SerializeTo(SerializerElement& element) const {
 
 void Layout::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
+  MarkAsModified();
+  elementsGeneration = NewElementsGeneration();
   SetBackgroundColor(element.GetIntAttribute("r"),
                      element.GetIntAttribute("v"),
                      element.GetIntAttribute("b"));
@@ -383,7 +424,40 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
 }
 
+std::uint64_t Layout::GetContentHash() const {
+  // Groups and the folder structure of objects are part of the settings, so
+  // their hash is also computed again when the objects container changed.
+  if (isSettingsContentHashOutdated ||
+      settingsContentHashObjectsVersion != objectsContainer.GetVersion()) {
+    SerializerElement element;
+    SerializeSettingsTo(element);
+    // Variables have their own hash, which is cached.
+    element.RemoveChild("variables");
+    settingsContentHash = gd::ContentHash::Of(element);
+    settingsContentHashObjectsVersion = objectsContainer.GetVersion();
+    isSettingsContentHashOutdated = false;
+  }
+  if (isInstancesContentHashOutdated) {
+    SerializerElement element;
+    initialInstances.SerializeTo(element);
+    instancesContentHash = gd::ContentHash::Of(element);
+    isInstancesContentHashOutdated = false;
+  }
+
+  std::uint64_t hash = gd::ContentHash::Combine(settingsContentHash,
+                                                variables.GetContentHash());
+  hash = gd::ContentHash::Combine(hash, instancesContentHash);
+  hash = gd::ContentHash::Combine(hash, objectsContainer.GetObjectsCount());
+  for (std::size_t i = 0; i < objectsContainer.GetObjectsCount(); ++i) {
+    hash = gd::ContentHash::Combine(
+        hash, objectsContainer.GetObject(i).GetContentHash());
+  }
+  return gd::ContentHash::Combine(hash, events.GetContentHash());
+}
+
 void Layout::Init(const Layout& other) {
+  MarkAsModified();
+  elementsGeneration = NewElementsGeneration();
   SetName(other.name);
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
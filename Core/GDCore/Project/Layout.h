@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 
 namespace gd {
 class BaseEvent;
@@ -76,6 +78,7 @@ class GD_CORE_API Layout {
     backgroundColorR = r;
     backgroundColorG = g;
     backgroundColorB = b;
+    MarkAsModified();
   }
 
   /**
@@ -101,7 +104,10 @@ class GD_CORE_API Layout {
   /**
    * Set scene window default title
    */
-  void SetWindowDefaultTitle(const gd::String& title_) { title = title_; };
+  void SetWindowDefaultTitle(const gd::String& title_) {
+    title = title_;
+    MarkAsModified();
+  };
 
   ///@}
 
@@ -139,6 +145,7 @@ class GD_CORE_API Layout {
    * Return the container storing initial instances.
    */
   gd::InitialInstancesContainer& GetInitialInstances() {
+    isInstancesContentHashOutdated = true;
     return initialInstances;
   }
   ///@}
@@ -195,7 +202,10 @@ class GD_CORE_API Layout {
   /**
    * \brief Get the layers of the scene.
    */
-  gd::LayersContainer& GetLayers() { return layers; }
+  gd::LayersContainer& GetLayers() {
+    MarkAsModified();
+    return layers;
+  }
 
   /**
    * @deprecated
@@ -308,7 +318,10 @@ class GD_CORE_API Layout {
    * Return the settings associated to the layout.
    * \see gd::EditorSettings
    */
-  gd::EditorSettings& GetAssociatedEditorSettings() { return editorSettings; }
+  gd::EditorSettings& GetAssociatedEditorSettings() {
+    MarkAsModified();
+    return editorSettings;
+  }
 
   /** \name Other properties
    */
@@ -318,6 +331,7 @@ class GD_CORE_API Layout {
    */
   void DisableInputWhenFocusIsLost(bool disable = true) {
     disableInputWhenNotFocused = disable;
+    MarkAsModified();
   }
 
   /**
@@ -330,6 +344,7 @@ class GD_CORE_API Layout {
    */
   void SetStandardSortMethod(bool enable = true) {
     standardSortMethod = enable;
+    MarkAsModified();
   }
 
   /**
@@ -342,6 +357,7 @@ class GD_CORE_API Layout {
    */
   void SetStopSoundsOnStartup(bool enable = true) {
     stopSoundsOnStartup = enable;
+    MarkAsModified();
   }
 
   /**
@@ -360,14 +376,60 @@ class GD_CORE_API Layout {
    */
   void SerializeTo(SerializerElement& element) const;
 
+  /**
+   * \brief Serialize the layout, except its initial instances, objects and
+   * events.
+   *
+   * \see gd::LayoutSnapshot
+   */
+  void SerializeSettingsTo(SerializerElement& element) const;
+
   /**
    * \brief Unserialize the layout.
    */
   void UnserializeFrom(gd::Project& project, const SerializerElement& element);
+
+  /**
+   * \brief Return a number identifying the current events, objects and
+   * initial instances of the layout. It changes when they are all recreated,
+   * i.e: when the layout is unserialized or copied.
+   *
+   * \see gd::LayoutSnapshot
+   */
+  std::uint64_t GetElementsGeneration() const { return elementsGeneration; }
   ///@}
 
+  /**
+   * \brief Return a hash of the layout, including its variables, objects,
+   * initial instances and events.
+   *
+   * The hashes of the settings and of the initial instances are only
+   * computed again after they were modified through the methods of the
+   * layout. Getting them with a non-const accessor counts as a modification.
+   * The hashes of the variables, objects and events are cached by themselves.
+   *
+   * \see gd::ContentHash
+   */
+  std::uint64_t GetContentHash() const;
+
+  /**
+   * \brief Mark the settings and the initial instances of the layout as
+   * modified, so that their hash is computed again. To be called after
+   * modifying them through references obtained before the last call to
+   * GetContentHash.
+   */
+  void MarkAsModified() {
+    isSettingsContentHashOutdated = true;
+    isInstancesContentHashOutdated = true;
+  }
+
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   gd::String name;         ///< Scene name
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
   gd::String mangledName;  ///< The scene name mangled by SceneNameMangler
   unsigned int backgroundColorR = 0;     ///< Background color Red component
   unsigned int backgroundColorG = 0;     ///< Background color Green component
@@ -393,12 +455,24 @@ class GD_CORE_API Layout {
   EventsList events;  ///< Scene events
   gd::EditorSettings editorSettings;
 
+  mutable std::uint64_t settingsContentHash = 0;  ///< \see GetContentHash
+  mutable std::size_t settingsContentHashObjectsVersion =
+      0;  ///< Version of the objects container (for the groups and the
+          ///< folders) when settingsContentHash was computed.
+  mutable bool isSettingsContentHashOutdated = true;  ///< \see GetContentHash
+  mutable std::uint64_t instancesContentHash = 0;     ///< \see GetContentHash
+  mutable bool isInstancesContentHashOutdated = true;  ///< \see GetContentHash
+  std::uint64_t elementsGeneration = 0;  ///< \see GetElementsGeneration
+
   /**
    * Initialize from another layout. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
    */
   void Init(const gd::Layout& other);
 
+  void SerializeTo(SerializerElement& element,
+                   bool withInstancesObjectsAndEvents) const;
+
   std::unique_ptr<gd::BehaviorsSharedData> CreateBehaviorsSharedData(
       gd::Project& project,
       const gd::String& name,
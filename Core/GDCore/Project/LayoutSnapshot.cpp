@@ -0,0 +1,155 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/LayoutSnapshot.h"
+
+#include <unordered_map>
+
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+/**
+ * Find the elements of the previous snapshot that can be reused. Elements are
+ * usually at the same position as in the previous snapshot, so the index of
+ * the entries is only built when an element was moved, inserted or removed.
+ */
+template <typename Entry>
+class PreviousEntries {
+ public:
+  PreviousEntries(const std::vector<Entry>& entries_) : entries(entries_){};
+
+  std::shared_ptr<gd::SerializerElement> Find(std::size_t index,
+                                              const void* source) {
+    if (index < entries.size() && entries[index].source == source)
+      return entries[index].element;
+
+    if (entriesBySource.empty()) {
+      for (const auto& entry : entries)
+        entriesBySource[entry.source] = &entry.element;
+    }
+    auto it = entriesBySource.find(source);
+    return it != entriesBySource.end() ? *it->second : nullptr;
+  }
+
+ private:
+  const std::vector<Entry>& entries;
+  std::unordered_map<const void*, const std::shared_ptr<gd::SerializerElement>*>
+      entriesBySource;
+};
+
+void AddSharedChildren(gd::SerializerElement& element,
+                       const gd::String& childrenName,
+                       const std::vector<std::shared_ptr<gd::SerializerElement>>&
+                           children) {
+  element.ConsiderAsArrayOf(childrenName);
+  for (const auto& child : children)
+    element.AddSharedChild(childrenName, child);
+}
+
+}  // namespace
+
+namespace gd {
+
+LayoutSnapshot LayoutSnapshot::Take(const gd::Layout& layout) {
+  return Take(layout, LayoutSnapshot(), LayoutChanges());
+}
+
+LayoutSnapshot LayoutSnapshot::Take(const gd::Layout& layout,
+                                    const LayoutSnapshot& previousSnapshot,
+                                    const LayoutChanges& changes) {
+  LayoutSnapshot snapshot;
+  snapshot.layout = &layout;
+  snapshot.elementsGeneration = layout.GetElementsGeneration();
+  snapshot.name = layout.GetName();
+  snapshot.settings = std::make_shared<gd::SerializerElement>();
+  layout.SerializeSettingsTo(*snapshot.settings);
+
+  // Addresses of elements can only be compared if the elements were not all
+  // recreated since the previous snapshot (by restoring a snapshot, for
+  // example), as new elements can reuse the addresses of the old ones.
+  const LayoutSnapshot emptySnapshot;
+  const LayoutSnapshot& sharedSnapshot =
+      previousSnapshot.layout == &layout &&
+              previousSnapshot.elementsGeneration ==
+                  layout.GetElementsGeneration()
+          ? previousSnapshot
+          : emptySnapshot;
+
+  PreviousEntries<Entry> previousEvents(sharedSnapshot.events);
+  const gd::EventsList& events = layout.GetEvents();
+  snapshot.events.reserve(events.GetEventsCount());
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent& event = events.GetEvent(i);
+    auto element = changes.HasEvent(event) ? nullptr
+                                           : previousEvents.Find(i, &event);
+    if (!element) {
+      element = std::make_shared<gd::SerializerElement>();
+      gd::EventsListSerialization::SerializeEventTo(event, *element);
+    }
+    snapshot.events.push_back(Entry{&event, element});
+  }
+
+  PreviousEntries<Entry> previousObjects(sharedSnapshot.objects);
+  const gd::ObjectsContainer& objects = layout.GetObjects();
+  snapshot.objects.reserve(objects.GetObjectsCount());
+  for (std::size_t i = 0; i < objects.GetObjectsCount(); ++i) {
+    const gd::Object& object = objects.GetObject(i);
+    auto element = changes.HasObject(object) ? nullptr
+                                             : previousObjects.Find(i, &object);
+    if (!element) {
+      element = std::make_shared<gd::SerializerElement>();
+      object.SerializeTo(*element);
+    }
+    snapshot.objects.push_back(Entry{&object, element});
+  }
+
+  PreviousEntries<Entry> previousInstances(sharedSnapshot.instances);
+  const gd::InitialInstancesContainer& instances = layout.GetInitialInstances();
+  snapshot.instances.reserve(instances.GetInstancesCount());
+  std::size_t i = 0;
+  for (const gd::InitialInstance& instance : instances.GetInternalList()) {
+    auto element = changes.HasInstance(instance)
+                       ? nullptr
+                       : previousInstances.Find(i, &instance);
+    if (!element) {
+      element = std::make_shared<gd::SerializerElement>();
+      instance.SerializeTo(*element);
+    }
+    snapshot.instances.push_back(Entry{&instance, element});
+    ++i;
+  }
+
+  return snapshot;
+}
+
+void LayoutSnapshot::RestoreTo(gd::Project& project,
+                               gd::Layout& layout) const {
+  if (!settings) return;
+
+  auto getElements = [](const std::vector<Entry>& entries) {
+    std::vector<std::shared_ptr<gd::SerializerElement>> elements;
+    elements.reserve(entries.size());
+    for (const auto& entry : entries) elements.push_back(entry.element);
+    return elements;
+  };
+
+  gd::SerializerElement element(*settings);
+  AddSharedChildren(element.AddChild("events"), "event", getElements(events));
+  AddSharedChildren(
+      element.AddChild("objects"), "object", getElements(objects));
+  AddSharedChildren(
+      element.AddChild("instances"), "instance", getElements(instances));
+
+  layout.UnserializeFrom(project, element);
+}
+
+}  // namespace gd
@@ -0,0 +1,178 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class InitialInstance;
+class Layout;
+class Object;
+class Project;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The elements of a layout that were inserted or modified since a
+ * snapshot was taken.
+ *
+ * \see gd::LayoutSnapshot
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API LayoutChanges {
+ public:
+  LayoutChanges(){};
+
+  /**
+   * \brief Mark a top-level event of the layout as inserted or modified
+   * (including when one of its sub-events was modified).
+   */
+  LayoutChanges& MarkEvent(const gd::BaseEvent& event) {
+    events.insert(&event);
+    return *this;
+  };
+
+  /**
+   * \brief Mark an object of the layout as inserted or modified.
+   */
+  LayoutChanges& MarkObject(const gd::Object& object) {
+    objects.insert(&object);
+    return *this;
+  };
+
+  /**
+   * \brief Mark an initial instance of the layout as inserted or modified.
+   */
+  LayoutChanges& MarkInstance(const gd::InitialInstance& instance) {
+    instances.insert(&instance);
+    return *this;
+  };
+
+  bool HasEvent(const gd::BaseEvent& event) const {
+    return events.count(&event) != 0;
+  };
+  bool HasObject(const gd::Object& object) const {
+    return objects.count(&object) != 0;
+  };
+  bool HasInstance(const gd::InitialInstance& instance) const {
+    return instances.count(&instance) != 0;
+  };
+
+ private:
+  std::unordered_set<const gd::BaseEvent*> events;
+  std::unordered_set<const gd::Object*> objects;
+  std::unordered_set<const gd::InitialInstance*> instances;
+};
+
+/**
+ * \brief An immutable copy of a layout, which can be restored later (to
+ * undo changes for example).
+ *
+ * Each top-level event, object and initial instance is stored in its own
+ * serialized element. A snapshot taken after another one shares with it the
+ * elements of everything that was not changed in the meantime, so that taking
+ * a snapshot after a small edit only serializes the changed elements (and the
+ * layout settings, like layers and variables).
+ *
+ * Elements are recognized by their address in the layout: the elements
+ * inserted or modified since the previous snapshot must be given in a
+ * gd::LayoutChanges (including elements inserted at the address of removed
+ * ones). Elements removed from the layout are simply not part of the new
+ * snapshot. When the elements of the layout were all recreated since the
+ * previous snapshot (see gd::Layout::GetElementsGeneration), nothing is
+ * shared.
+ *
+ * Snapshots are cheap to copy: copies share all their elements.
+ *
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API LayoutSnapshot {
+ public:
+  /**
+   * \brief Create an empty snapshot.
+   */
+  LayoutSnapshot(){};
+
+  /**
+   * \brief Take a snapshot of the whole layout.
+   */
+  static LayoutSnapshot Take(const gd::Layout& layout);
+
+  /**
+   * \brief Take a snapshot of the layout, sharing with the previous snapshot
+   * (taken from the same layout) the elements that are not part of the
+   * changes.
+   */
+  static LayoutSnapshot Take(const gd::Layout& layout,
+                             const LayoutSnapshot& previousSnapshot,
+                             const LayoutChanges& changes);
+
+  /**
+   * \brief Restore the layout as it was when the snapshot was taken.
+   *
+   * \note Elements of the layout are recreated, so the snapshots taken after
+   * a restoration don't share elements with the snapshots taken before.
+   */
+  void RestoreTo(gd::Project& project, gd::Layout& layout) const;
+
+  /**
+   * \brief Return the name of the layout when the snapshot was taken.
+   */
+  const gd::String& GetName() const { return name; };
+
+  std::size_t GetEventsCount() const { return events.size(); };
+  std::size_t GetObjectsCount() const { return objects.size(); };
+  std::size_t GetInstancesCount() const { return instances.size(); };
+
+  /**
+   * \brief Return the serialized top-level event at the given position.
+   */
+  const gd::SerializerElement& GetEventElement(std::size_t index) const {
+    return *events[index].element;
+  };
+
+  /**
+   * \brief Return the serialized object at the given position.
+   */
+  const gd::SerializerElement& GetObjectElement(std::size_t index) const {
+    return *objects[index].element;
+  };
+
+  /**
+   * \brief Return the serialized initial instance at the given position.
+   */
+  const gd::SerializerElement& GetInstanceElement(std::size_t index) const {
+    return *instances[index].element;
+  };
+
+ private:
+  struct Entry {
+    const void* source;  ///< The element of the layout which was serialized.
+    std::shared_ptr<gd::SerializerElement> element;
+  };
+
+  const gd::Layout* layout = nullptr;  ///< The layout the snapshot was taken
+                                       ///< from.
+  std::uint64_t elementsGeneration = 0;  ///< The generation of the elements
+                                         ///< of the layout, when the snapshot
+                                         ///< was taken.
+  gd::String name;
+  std::shared_ptr<gd::SerializerElement> settings;
+  std::vector<Entry> events;
+  std::vector<Entry> objects;
+  std::vector<Entry> instances;
+};
+
+}  // namespace gd
@@ -20,7 +20,7 @@ void NamedPropertyDescriptor::SerializeTo(SerializerElement& element) const {
 void NamedPropertyDescriptor::UnserializeFrom(
     const SerializerElement& element) {
   PropertyDescriptor::UnserializeFrom(element);
-  name = element.GetChild("name").GetStringValue();
+  SetName(element.GetChild("name").GetStringValue());
 }
 
 void NamedPropertyDescriptor::SerializeValuesTo(SerializerElement& element) const {
@@ -30,7 +30,7 @@ void NamedPropertyDescriptor::SerializeValuesTo(SerializerElement& element) cons
 
 void NamedPropertyDescriptor::UnserializeValuesFrom(const SerializerElement& element) {
   PropertyDescriptor::UnserializeValuesFrom(element);
-  name = element.GetChild("name").GetStringValue();
+  SetName(element.GetChild("name").GetStringValue());
 }
 
 }  // namespace gd
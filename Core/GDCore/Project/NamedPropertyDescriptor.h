@@ -8,6 +8,7 @@
 #include <vector>
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -37,6 +38,7 @@ class GD_CORE_API NamedPropertyDescriptor : public PropertyDescriptor {
    * to use any rename method provided by it (as it can ensure uniqueness).
    */
   NamedPropertyDescriptor& SetName(gd::String newName) {
+    if (newName != name) nameIndexLink.NotifyRenamed();
     name = newName;
     return *this;
   }
@@ -71,7 +73,12 @@ class GD_CORE_API NamedPropertyDescriptor : public PropertyDescriptor {
   ///@}
 
  private:
+  template <typename T>
+  friend class gd::NameIndex;
+
   gd::String name;  ///< The name of the property.
+  gd::NameIndexLink nameIndexLink;  ///< Tells the index of the list storing
+                                    ///< the element when it's renamed.
 };
 
 }  // namespace gd
@@ -15,6 +15,7 @@
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/QuickCustomization.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/ContentHash.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCore/Tools/UUID/UUID.h"
 
@@ -46,6 +47,8 @@ void Object::Init(const gd::Object& object) {
   assetStoreId = object.assetStoreId;
   objectVariables = object.objectVariables;
   effectsContainer = object.effectsContainer;
+  contentHash = object.contentHash;
+  isContentHashOutdated = object.isContentHashOutdated;
 
   behaviors.clear();
   for (auto& it : object.behaviors) {
@@ -55,7 +58,10 @@ void Object::Init(const gd::Object& object) {
   configuration = object.configuration->Clone();
 }
 
-gd::ObjectConfiguration& Object::GetConfiguration() { return *configuration; }
+gd::ObjectConfiguration& Object::GetConfiguration() {
+  MarkAsModified();
+  return *configuration;
+}
 
 const gd::ObjectConfiguration& Object::GetConfiguration() const {
   return *configuration;
@@ -69,7 +75,10 @@ std::vector<gd::String> Object::GetAllBehaviorNames() const {
   return allNameIdentifiers;
 }
 
-void Object::RemoveBehavior(const gd::String& name) { behaviors.erase(name); }
+void Object::RemoveBehavior(const gd::String& name) {
+  behaviors.erase(name);
+  MarkAsModified();
+}
 
 bool Object::RenameBehavior(const gd::String& name, const gd::String& newName) {
   if (behaviors.find(name) == behaviors.end() ||
@@ -80,11 +89,13 @@ bool Object::RenameBehavior(const gd::String& name, const gd::String& newName) {
   behaviors.erase(name);
   behaviors[newName] = std::move(aut);
   behaviors[newName]->SetName(newName);
+  MarkAsModified();
 
   return true;
 }
 
 gd::Behavior& Object::GetBehavior(const gd::String& name) {
+  MarkAsModified();
   return *behaviors.find(name)->second;
 }
 
@@ -103,6 +114,7 @@ gd::Behavior* Object::AddNewBehavior(const gd::Project& project,
                            &name](std::unique_ptr<gd::Behavior> behavior) {
     behavior->InitializeContent();
     this->behaviors[name] = std::move(behavior);
+    this->MarkAsModified();
     return this->behaviors[name].get();
   };
 
@@ -129,6 +141,7 @@ gd::Behavior* Object::AddNewBehavior(const gd::Project& project,
 
 void Object::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
+  MarkAsModified();
   persistentUuid = element.GetStringAttribute("persistentUuid");
 
   SetType(element.GetStringAttribute("type"));
@@ -268,6 +281,20 @@ void Object::SerializeTo(SerializerElement& element) const {
   configuration->SerializeTo(element);
 }
 
+std::uint64_t Object::GetContentHash() const {
+  if (isContentHashOutdated) {
+    SerializerElement element;
+    SerializeTo(element);
+    // Variables have their own hash, which is cached.
+    element.RemoveChild("variables");
+    contentHash = gd::ContentHash::Of(element);
+    isContentHashOutdated = false;
+  }
+
+  return gd::ContentHash::Combine(contentHash,
+                                  objectVariables.GetContentHash());
+}
+
 Object& Object::ResetPersistentUuid() {
   persistentUuid = UUID::MakeUuid4();
   objectVariables.ResetPersistentUuid();
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <vector>
@@ -96,7 +97,10 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_) {
+    name = name_;
+    MarkAsModified();
+  };
 
   /** \brief Return the name of the object.
    */
@@ -106,6 +110,7 @@ class GD_CORE_API Object {
    */
   void SetAssetStoreId(const gd::String& assetStoreId_) {
     assetStoreId = assetStoreId_;
+    MarkAsModified();
   };
 
   /** \brief Return the asset store id of the object.
@@ -114,7 +119,10 @@ class GD_CORE_API Object {
 
   /** \brief Change the type of the object.
    */
-  void SetType(const gd::String& type_) { configuration->SetType(type_); }
+  void SetType(const gd::String& type_) {
+    configuration->SetType(type_);
+    MarkAsModified();
+  }
 
   /** \brief Return the type of the object.
    */
@@ -214,7 +222,10 @@ class GD_CORE_API Object {
    * \brief Provide access to the gd::EffectsContainer member containing the
    * effects.
    */
-  gd::EffectsContainer& GetEffects() { return effectsContainer; }
+  gd::EffectsContainer& GetEffects() {
+    MarkAsModified();
+    return effectsContainer;
+  }
   ///@}
 
   /** \name Serialization
@@ -246,6 +257,27 @@ class GD_CORE_API Object {
   Object& ClearPersistentUuid();
   ///@}
 
+  /**
+   * \brief Return a hash of the object, including its configuration,
+   * behaviors, effects and variables.
+   *
+   * The hash of the object (without its variables) is only computed again
+   * after the object was modified through its methods. Getting the
+   * configuration, a behavior or the effects with a non-const accessor counts
+   * as a modification. The hash of the variables is cached by the variables
+   * container.
+   *
+   * \see gd::ContentHash
+   */
+  std::uint64_t GetContentHash() const;
+
+  /**
+   * \brief Mark the object as modified, so that its hash is computed again.
+   * To be called after modifying the object through references obtained
+   * before the last call to GetContentHash.
+   */
+  void MarkAsModified() { isContentHashOutdated = true; }
+
  protected:
   gd::String name;          ///< The full name of the object
   gd::String assetStoreId;  ///< The ID of the asset if the object comes from
@@ -261,6 +293,8 @@ class GD_CORE_API Object {
       effectsContainer;  ///< The effects container for the object.
   mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
                                       ///< useful for computing changesets.
+  mutable std::uint64_t contentHash = 0;      ///< \see GetContentHash
+  mutable bool isContentHashOutdated = true;  ///< \see GetContentHash
 
   /**
    * Initialize object using another object. Used by copy-ctor and assign-op.
@@ -16,6 +16,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/StringAtom.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
@@ -62,12 +63,12 @@ class GD_CORE_API ObjectConfiguration {
   /** \brief Change the type of the object.
    */
   void SetType(const gd::String& type_) {
-    type = type_;
+    type = gd::StringAtom(type_);
   }
 
   /** \brief Return the type of the object.
    */
-  const gd::String& GetType() const { return type; }
+  const gd::String& GetType() const { return type.GetString(); }
 
   /** \name Object properties
    * Reading and updating object configuration properties
@@ -195,8 +196,8 @@ class GD_CORE_API ObjectConfiguration {
   ///@}
 
 protected:
-  gd::String type; ///< Which type of object is represented by this
-                   ///< configuration.
+  gd::StringAtom type; ///< Which type of object is represented by this
+                       ///< configuration (interned).
 
   /**
    * \brief Derived object configuration can redefine this method to load
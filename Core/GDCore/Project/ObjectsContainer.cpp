@@ -6,6 +6,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 
 #include <algorithm>
+#include <atomic>
 
 #include "GDCore/Tools/PolymorphicClone.h"
 #include "GDCore/Extensions/Platform.h"
@@ -14,12 +15,17 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Serialization/SerializerElement.h"
 
+namespace {
+std::atomic<std::size_t> lastObjectsContainerVersion(0);
+}
+
 namespace gd {
 
 ObjectsContainer::ObjectsContainer(
     const ObjectsContainer::SourceType sourceType_)
     : sourceType(sourceType_) {
   rootFolder = gd::make_unique<gd::ObjectFolderOrObject>("__ROOT");
+  MarkAsModified();
 }
 
 ObjectsContainer::~ObjectsContainer() {}
@@ -35,7 +41,12 @@ ObjectsContainer& ObjectsContainer::operator=(
   return *this;
 }
 
+void ObjectsContainer::MarkAsModified() {
+  version = ++lastObjectsContainerVersion;
+}
+
 void ObjectsContainer::Init(const gd::ObjectsContainer& other) {
+  MarkAsModified();
   sourceType = other.sourceType;
   initialObjects = gd::Clone(other.initialObjects);
   objectGroups = other.objectGroups;
@@ -69,6 +80,7 @@ void ObjectsContainer::AddMissingObjectsInRootFolder() {
 
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
+  MarkAsModified();
   initialObjects.clear();
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
@@ -95,6 +107,7 @@ bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
                   }) != initialObjects.end());
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
+  MarkAsModified();
   return *(*find_if(initialObjects.begin(),
                     initialObjects.end(),
                     [&](const std::unique_ptr<gd::Object>& object) {
@@ -109,6 +122,7 @@ const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
                     }));
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
+  MarkAsModified();
   return *initialObjects[index];
 }
 const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
@@ -127,6 +141,7 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
+  MarkAsModified();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
@@ -143,6 +158,7 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
     const gd::String& name,
     gd::ObjectFolderOrObject& objectFolderOrObject,
     std::size_t position) {
+  MarkAsModified();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       initialObjects.end(), project.CreateObject(objectType, name))));
 
@@ -153,6 +169,7 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
+  MarkAsModified();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
@@ -164,6 +181,7 @@ gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
 void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   if (oldIndex >= initialObjects.size() || newIndex >= initialObjects.size())
     return;
+  MarkAsModified();
 
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
@@ -178,6 +196,7 @@ void ObjectsContainer::RemoveObject(const gd::String& name) {
                 return object->GetName() == name;
               });
   if (objectIt == initialObjects.end()) return;
+  MarkAsModified();
 
   rootFolder->RemoveRecursivelyObjectNamed(name);
 
@@ -199,6 +218,9 @@ void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
       });
   if (objectIt == initialObjects.end()) return;
 
+  MarkAsModified();
+  newContainer.MarkAsModified();
+
   std::unique_ptr<gd::Object> object = std::move(*objectIt);
   initialObjects.erase(objectIt);
 
@@ -55,6 +55,25 @@ class GD_CORE_API ObjectsContainer {
 
   SourceType GetSourceType() const { return sourceType; }
 
+  /**
+   * \brief Return a number changed each time the objects or the groups of the
+   * container may have been modified.
+   *
+   * It's changed by the methods modifying the container, but also by the
+   * methods giving a non-const access to its objects, folders or groups (as
+   * they can be modified through it). Versions are never shared by two
+   * containers.
+   *
+   * \see gd::ObjectsContainersList
+   */
+  std::size_t GetVersion() const { return version; }
+
+  /**
+   * \brief Change the version of the container. To be called after modifying
+   * one of its objects or groups through a reference obtained before.
+   */
+  void MarkAsModified();
+
   /** \name Objects management
    * Members functions related to objects management.
    */
@@ -170,6 +189,7 @@ class GD_CORE_API ObjectsContainer {
    * Provide a raw access to the vector containing the objects
    */
   std::vector<std::unique_ptr<gd::Object> >& GetObjects() {
+    MarkAsModified();
     return initialObjects;
   }
 
@@ -191,6 +211,7 @@ class GD_CORE_API ObjectsContainer {
   std::vector<const ObjectFolderOrObject*> GetAllObjectFolderOrObjects() const;
 
   gd::ObjectFolderOrObject& GetRootFolder() {
+      MarkAsModified();
       return *rootFolder;
   }
 
@@ -230,7 +251,10 @@ class GD_CORE_API ObjectsContainer {
   /**
    * \brief Return a reference to the project's objects groups.
    */
-  ObjectGroupsContainer& GetObjectGroups() { return objectGroups; }
+  ObjectGroupsContainer& GetObjectGroups() {
+    MarkAsModified();
+    return objectGroups;
+  }
 
   /**
    * \brief Return a const reference to the project's objects groups.
@@ -247,6 +271,7 @@ class GD_CORE_API ObjectsContainer {
  private:
   SourceType sourceType = Unknown;
   std::unique_ptr<gd::ObjectFolderOrObject> rootFolder;
+  std::size_t version = 0;  ///< \see GetVersion
 
   /**
    * Initialize from another variables container, copying elements. Used by
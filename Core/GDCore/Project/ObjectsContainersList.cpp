@@ -1,7 +1,10 @@
 #include "ObjectsContainersList.h"
 
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include "GDCore/Project/IdentifiersSearchIndex.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectsContainer.h"
@@ -10,8 +13,102 @@
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
 
+namespace {
+
+const gd::ObjectsContainer& GetEmptyObjectsContainer() {
+  static const gd::ObjectsContainer emptyObjectsContainer(
+      gd::ObjectsContainer::SourceType::Unknown);
+  return emptyObjectsContainer;
+}
+
+}  // namespace
+
 namespace gd {
 
+struct ObjectsContainersList::ResolvedBehavior {
+  bool isInObjectOrGroup;
+  gd::String type;
+};
+
+/**
+ * \brief What is known about an object or group name. Each information is
+ * computed the first time it's asked.
+ */
+struct ObjectsContainersList::ResolvedName {
+  bool isKindResolved = false;
+  bool isObject = false;
+  bool isObjectOrGroup = false;
+
+  bool isTypeResolved = false;
+  gd::String type;
+
+  bool areBehaviorsResolved = false;
+  std::vector<gd::String> behaviors;
+
+  std::unordered_map<gd::String, ResolvedBehavior> resolvedBehaviors;
+};
+
+struct ObjectsContainersList::ResolutionCache {
+  std::mutex mutex;
+  std::vector<std::size_t> containersVersions;
+  std::unordered_map<gd::String, ResolvedName> resolvedNames;
+};
+
+ObjectsContainersList::ObjectsContainersList()
+    : resolutionCache(std::make_shared<ResolutionCache>()) {}
+
+void ObjectsContainersList::WithResolvedName(
+    const gd::String& name,
+    const std::function<void(ResolvedName&)>& fn) const {
+  std::lock_guard<std::mutex> lock(resolutionCache->mutex);
+
+  auto& containersVersions = resolutionCache->containersVersions;
+  bool isCacheUpToDate = containersVersions.size() == objectsContainers.size();
+  for (std::size_t i = 0; i < objectsContainers.size() && isCacheUpToDate;
+       ++i) {
+    isCacheUpToDate =
+        containersVersions[i] == objectsContainers[i]->GetVersion();
+  }
+  if (!isCacheUpToDate) {
+    resolutionCache->resolvedNames.clear();
+    containersVersions.clear();
+    for (const auto* objectsContainer : objectsContainers)
+      containersVersions.push_back(objectsContainer->GetVersion());
+  }
+
+  ResolvedName& resolvedName = resolutionCache->resolvedNames[name];
+  if (!resolvedName.isKindResolved) {
+    for (const auto* objectsContainer : objectsContainers) {
+      if (objectsContainer->HasObjectNamed(name)) {
+        resolvedName.isObject = true;
+        resolvedName.isObjectOrGroup = true;
+        break;
+      }
+      if (objectsContainer->GetObjectGroups().Has(name))
+        resolvedName.isObjectOrGroup = true;
+    }
+    resolvedName.isKindResolved = true;
+  }
+
+  fn(resolvedName);
+}
+
+const ObjectsContainersList::ResolvedBehavior&
+ObjectsContainersList::ResolveBehavior(ResolvedName& resolvedName,
+                                       const gd::String& objectOrGroupName,
+                                       const gd::String& behaviorName) const {
+  auto it = resolvedName.resolvedBehaviors.find(behaviorName);
+  if (it != resolvedName.resolvedBehaviors.end()) return it->second;
+
+  return resolvedName.resolvedBehaviors
+      .emplace(behaviorName,
+               ResolvedBehavior{HasBehaviorInObjectOrGroupWithoutCache(
+                                    objectOrGroupName, behaviorName),
+                                GetTypeOfBehaviorInObjectOrGroupWithoutCache(
+                                    objectOrGroupName, behaviorName, true)})
+      .first->second;
+}
+
 ObjectsContainersList
 ObjectsContainersList::MakeNewEmptyObjectsContainersList() {
   ObjectsContainersList objectsContainersList;
@@ -55,22 +152,19 @@ ObjectsContainersList::MakeNewObjectsContainersListForContainer(
 
 bool ObjectsContainersList::HasObjectOrGroupNamed(
     const gd::String& name) const {
-  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
-       ++it) {
-    if ((*it)->HasObjectNamed(name) || (*it)->GetObjectGroups().Has(name))
-      return true;
-  }
-
-  return false;
+  bool isObjectOrGroup = false;
+  WithResolvedName(name, [&](ResolvedName& resolvedName) {
+    isObjectOrGroup = resolvedName.isObjectOrGroup;
+  });
+  return isObjectOrGroup;
 }
 
 bool ObjectsContainersList::HasObjectNamed(const gd::String& name) const {
-  for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
-       ++it) {
-    if ((*it)->HasObjectNamed(name)) return true;
-  }
-
-  return false;
+  bool isObject = false;
+  WithResolvedName(name, [&](ResolvedName& resolvedName) {
+    isObject = resolvedName.isObject;
+  });
+  return isObject;
 }
 
 const gd::Object* ObjectsContainersList::GetObject(const gd::String& name) const {
@@ -275,13 +369,17 @@ void ObjectsContainersList::ForEachObjectOrGroupVariableMatchingSearch(
     const gd::String& objectOrGroupName,
     const gd::String& search,
     std::function<void(const gd::String& variableName,
-                       const gd::Variable& variable)> fn) const {
+                       const gd::Variable& variable)> fn,
+    const gd::IdentifiersSearchIndex* index) const {
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
     if ((*it)->HasObjectNamed(objectOrGroupName)) {
       const auto& variables =
           (*it)->GetObject(objectOrGroupName).GetVariables();
-      variables.ForEachVariableMatchingSearch(search, fn);
+      if (index)
+        index->ForEachVariableMatchingSearch(variables, search, fn);
+      else
+        variables.ForEachVariableMatchingSearch(search, fn);
     }
     if ((*it)->GetObjectGroups().Has(objectOrGroupName)) {
       // This could be adapted if objects groups have variables in the future.
@@ -309,7 +407,8 @@ void ObjectsContainersList::ForEachObjectOrGroupVariableMatchingSearch(
             // This variable is shared by all objects in the group. Note that
             // other objects can have it with a different type - we allow this.
             fn(variableName, variable);
-          });
+          },
+          index);
     }
   }
 }
@@ -318,13 +417,17 @@ void ObjectsContainersList::ForEachObjectVariableMatchingSearch(
     const gd::String& objectOrGroupName,
     const gd::String& search,
     std::function<void(const gd::String& variableName,
-                       const gd::Variable& variable)> fn) const {
+                       const gd::Variable& variable)> fn,
+    const gd::IdentifiersSearchIndex* index) const {
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
     if ((*it)->HasObjectNamed(objectOrGroupName)) {
       const auto& variables =
           (*it)->GetObject(objectOrGroupName).GetVariables();
-      variables.ForEachVariableMatchingSearch(search, fn);
+      if (index)
+        index->ForEachVariableMatchingSearch(variables, search, fn);
+      else
+        variables.ForEachVariableMatchingSearch(search, fn);
     }
   }
 }
@@ -332,10 +435,15 @@ void ObjectsContainersList::ForEachObjectVariableMatchingSearch(
 void ObjectsContainersList::ForEachNameMatchingSearch(
     const gd::String& search,
     std::function<void(const gd::String& name,
-                       const gd::ObjectConfiguration* objectConfiguration)> fn)
-    const {
+                       const gd::ObjectConfiguration* objectConfiguration)> fn,
+    const gd::IdentifiersSearchIndex* index) const {
   for (auto it = objectsContainers.rbegin(); it != objectsContainers.rend();
        ++it) {
+    if (index) {
+      index->ForEachNameMatchingSearch(**it, search, fn);
+      continue;
+    }
+
     for (const auto& object : (*it)->GetObjects()) {
       if (object->GetName().FindCaseInsensitive(search) != gd::String::npos)
         fn(object->GetName(), &object->GetConfiguration());
@@ -401,6 +509,19 @@ void ObjectsContainersList::ForEachObject(
 
 gd::String ObjectsContainersList::GetTypeOfObject(
     const gd::String& objectName) const {
+  gd::String type;
+  WithResolvedName(objectName, [&](ResolvedName& resolvedName) {
+    if (!resolvedName.isTypeResolved) {
+      resolvedName.type = GetTypeOfObjectWithoutCache(objectName);
+      resolvedName.isTypeResolved = true;
+    }
+    type = resolvedName.type;
+  });
+  return type;
+}
+
+gd::String ObjectsContainersList::GetTypeOfObjectWithoutCache(
+    const gd::String& objectName) const {
   if (objectsContainers.size() > 2) {
     std::cout << this << std::endl;
     std::cout << objectsContainers.size() << std::endl;
@@ -416,8 +537,8 @@ gd::String ObjectsContainersList::GetTypeOfObject(
     return "";
   }
   if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
+    const gd::ObjectsContainer& emptyObjectsContainer =
+        GetEmptyObjectsContainer();
     return gd::GetTypeOfObject(emptyObjectsContainer, *objectsContainers[0],
                                objectName, true);
   }
@@ -427,6 +548,17 @@ gd::String ObjectsContainersList::GetTypeOfObject(
 
 bool ObjectsContainersList::HasBehaviorInObjectOrGroup(
     const gd::String& objectOrGroupName, const gd::String& behaviorName) const {
+  bool isInObjectOrGroup = false;
+  WithResolvedName(objectOrGroupName, [&](ResolvedName& resolvedName) {
+    isInObjectOrGroup =
+        ResolveBehavior(resolvedName, objectOrGroupName, behaviorName)
+            .isInObjectOrGroup;
+  });
+  return isInObjectOrGroup;
+}
+
+bool ObjectsContainersList::HasBehaviorInObjectOrGroupWithoutCache(
+    const gd::String& objectOrGroupName, const gd::String& behaviorName) const {
   if (objectsContainers.size() > 2) {
     // TODO: rework forwarded methods so they can work with any number of
     // containers.
@@ -440,8 +572,8 @@ bool ObjectsContainersList::HasBehaviorInObjectOrGroup(
     return false;
   }
   if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
+    const gd::ObjectsContainer& emptyObjectsContainer =
+        GetEmptyObjectsContainer();
     return gd::HasBehaviorInObjectOrGroup(
         emptyObjectsContainer, *objectsContainers[0], objectOrGroupName,
         behaviorName, true);
@@ -457,6 +589,22 @@ gd::String ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroup(
     const gd::String& objectOrGroupName,
     const gd::String& behaviorName,
     bool searchInGroups) const {
+  if (!searchInGroups) {
+    return GetTypeOfBehaviorInObjectOrGroupWithoutCache(
+        objectOrGroupName, behaviorName, searchInGroups);
+  }
+
+  gd::String type;
+  WithResolvedName(objectOrGroupName, [&](ResolvedName& resolvedName) {
+    type = ResolveBehavior(resolvedName, objectOrGroupName, behaviorName).type;
+  });
+  return type;
+}
+
+gd::String ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroupWithoutCache(
+    const gd::String& objectOrGroupName,
+    const gd::String& behaviorName,
+    bool searchInGroups) const {
   if (objectsContainers.size() > 2) {
     // TODO: rework forwarded methods so they can work with any number of
     // containers.
@@ -470,8 +618,8 @@ gd::String ObjectsContainersList::GetTypeOfBehaviorInObjectOrGroup(
     return "";
   }
   if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
+    const gd::ObjectsContainer& emptyObjectsContainer =
+        GetEmptyObjectsContainer();
     return gd::GetTypeOfBehaviorInObjectOrGroup(
         emptyObjectsContainer, *objectsContainers[0], objectOrGroupName,
         behaviorName, searchInGroups);
@@ -498,8 +646,8 @@ gd::String ObjectsContainersList::GetTypeOfBehavior(
     return "";
   }
   if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
+    const gd::ObjectsContainer& emptyObjectsContainer =
+        GetEmptyObjectsContainer();
     return gd::GetTypeOfBehavior(emptyObjectsContainer, *objectsContainers[0],
                                  behaviorName, searchInGroups);
   }
@@ -511,6 +659,23 @@ gd::String ObjectsContainersList::GetTypeOfBehavior(
 
 std::vector<gd::String> ObjectsContainersList::GetBehaviorsOfObject(
     const gd::String& objectName, bool searchInGroups) const {
+  if (!searchInGroups)
+    return GetBehaviorsOfObjectWithoutCache(objectName, searchInGroups);
+
+  std::vector<gd::String> behaviors;
+  WithResolvedName(objectName, [&](ResolvedName& resolvedName) {
+    if (!resolvedName.areBehaviorsResolved) {
+      resolvedName.behaviors =
+          GetBehaviorsOfObjectWithoutCache(objectName, searchInGroups);
+      resolvedName.areBehaviorsResolved = true;
+    }
+    behaviors = resolvedName.behaviors;
+  });
+  return behaviors;
+}
+
+std::vector<gd::String> ObjectsContainersList::GetBehaviorsOfObjectWithoutCache(
+    const gd::String& objectName, bool searchInGroups) const {
   if (objectsContainers.size() > 2) {
     // TODO: rework forwarded methods so they can work with any number of
     // containers.
@@ -525,8 +690,8 @@ std::vector<gd::String> ObjectsContainersList::GetBehaviorsOfObject(
     return behaviors;
   }
   if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
+    const gd::ObjectsContainer& emptyObjectsContainer =
+        GetEmptyObjectsContainer();
     return gd::GetBehaviorsOfObject(emptyObjectsContainer,
                                     *objectsContainers[0], objectName,
                                     searchInGroups);
@@ -551,8 +716,8 @@ std::vector<gd::String> ObjectsContainersList::GetBehaviorNamesInObjectOrGroup(
     return behaviors;
   }
   if (objectsContainers.size() == 1) {
-    gd::ObjectsContainer emptyObjectsContainer(
-        gd::ObjectsContainer::SourceType::Unknown);
+    const gd::ObjectsContainer& emptyObjectsContainer =
+        GetEmptyObjectsContainer();
     return gd::GetBehaviorNamesInObjectOrGroup(emptyObjectsContainer,
                                     *objectsContainers[0], objectOrGroupName, behaviorType,
                                     searchInGroups);
@@ -1,4 +1,6 @@
 #pragma once
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "Variable.h"
@@ -11,6 +13,7 @@ class Layout;
 class VariablesContainer;
 class Object;
 class ObjectConfiguration;
+class IdentifiersSearchIndex;
 }  // namespace gd
 
 namespace gd {
@@ -19,6 +22,11 @@ namespace gd {
  * \brief A list of objects containers, useful for accessing objects in a
  * scoped way, along with methods to access them.
  *
+ * The kind, the type and the behaviors of the objects and groups are cached
+ * (as they are asked for each parameter of instructions and expressions), so
+ * the cache is emptied when the version of one of the containers changes (see
+ * gd::ObjectsContainer::GetVersion). Copies of a list share the same cache.
+ *
  * \see gd::Object
  * \see gd::ObjectsContainer
  * \see gd::Project
@@ -173,22 +181,30 @@ class GD_CORE_API ObjectsContainersList {
   /**
    * \brief Call the callback for each object or group name matching the
    * search passed in parameter.
+   *
+   * \param index If not null, the index used to find the names matching the
+   * search in the indexed containers.
    */
   void ForEachNameMatchingSearch(
       const gd::String& search,
       std::function<void(const gd::String& name,
                          const gd::ObjectConfiguration* objectConfiguration)>
-          fn) const;
+          fn,
+      const gd::IdentifiersSearchIndex* index = nullptr) const;
 
   /**
    * \brief Call the callback for each variable of the object (or group)
    * matching the search passed in parameter.
+   *
+   * \param index If not null, the index used to find the names matching the
+   * search in the indexed variables containers.
    */
   void ForEachObjectOrGroupVariableMatchingSearch(
       const gd::String& objectOrGroupName,
       const gd::String& search,
       std::function<void(const gd::String& variableName,
-                         const gd::Variable& variable)> fn) const;
+                         const gd::Variable& variable)> fn,
+      const gd::IdentifiersSearchIndex* index = nullptr) const;
 
   /**
    * \brief Return the source type of the container for the specified object or
@@ -222,7 +238,7 @@ class GD_CORE_API ObjectsContainersList {
 
   /** Do not use - should be private but accessible to let Emscripten create a
    * temporary. */
-  ObjectsContainersList(){};
+  ObjectsContainersList();
 
  private:
   const gd::Object* GetObject(const gd::String& name) const;
@@ -243,13 +259,45 @@ class GD_CORE_API ObjectsContainersList {
       const gd::String& objectOrGroupName,
       const gd::String& search,
       std::function<void(const gd::String& variableName,
-                         const gd::Variable& variable)> fn) const;
+                         const gd::Variable& variable)> fn,
+      const gd::IdentifiersSearchIndex* index) const;
+
+  gd::String GetTypeOfObjectWithoutCache(const gd::String& objectName) const;
+
+  bool HasBehaviorInObjectOrGroupWithoutCache(
+      const gd::String& objectOrGroupName,
+      const gd::String& behaviorName) const;
+
+  gd::String GetTypeOfBehaviorInObjectOrGroupWithoutCache(
+      const gd::String& objectOrGroupName,
+      const gd::String& behaviorName,
+      bool searchInGroups) const;
+
+  std::vector<gd::String> GetBehaviorsOfObjectWithoutCache(
+      const gd::String& objectName, bool searchInGroups) const;
+
+  struct ResolvedBehavior;
+  struct ResolvedName;
+  struct ResolutionCache;
+
+  /**
+   * \brief Call the function with what is cached about the object or group
+   * name (after emptying the cache if a container was modified).
+   */
+  void WithResolvedName(const gd::String& name,
+                        const std::function<void(ResolvedName&)>& fn) const;
+
+  const ResolvedBehavior& ResolveBehavior(
+      ResolvedName& resolvedName,
+      const gd::String& objectOrGroupName,
+      const gd::String& behaviorName) const;
 
   void Add(const gd::ObjectsContainer& objectsContainer) {
     objectsContainers.push_back(&objectsContainer);
   };
 
   std::vector<const gd::ObjectsContainer*> objectsContainers;
+  std::shared_ptr<ResolutionCache> resolutionCache;
 };
 
 }  // namespace gd
\ No newline at end of file
@@ -9,8 +9,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cctype>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -36,6 +38,7 @@
 #include "GDCore/String.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/ParallelTasks.h"
 #include "GDCore/Tools/PolymorphicClone.h"
 #include "GDCore/Tools/UUID/UUID.h"
 #include "GDCore/Tools/VersionWrapper.h"
@@ -299,33 +302,24 @@ bool Project::RemovePlatform(const gd::String& platformName) {
 }
 
 bool Project::HasLayoutNamed(const gd::String& name) const {
-  return (find_if(scenes.begin(),
-                  scenes.end(),
-                  [&name](const std::unique_ptr<gd::Layout>& layout) {
-                    return layout->GetName() == name;
-                  }) != scenes.end());
+  return layoutsIndex.Find(scenes, name) != gd::String::npos;
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
-        return layout->GetName() == name;
-      }));
+  return GetLayout(layoutsIndex.Find(scenes, name));
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
-        return layout->GetName() == name;
-      }));
+  return GetLayout(layoutsIndex.Find(scenes, name));
+}
+gd::Layout& Project::GetLayout(std::size_t index) {
+  EnsureLayoutLoaded(index);
+  return *scenes[index];
 }
-gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
+  EnsureLayoutLoaded(index);
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < scenes.size(); ++i) {
-    if (scenes[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return layoutsIndex.Find(scenes, name);
 }
 std::size_t Project::GetLayoutsCount() const { return scenes.size(); }
 
@@ -333,15 +327,18 @@ void Project::SwapLayouts(std::size_t first, std::size_t second) {
   if (first >= scenes.size() || second >= scenes.size()) return;
 
   std::iter_swap(scenes.begin() + first, scenes.begin() + second);
+  layoutsIndex.Update(scenes, first, first);
+  layoutsIndex.Update(scenes, second, second);
 }
 
 gd::Layout& Project::InsertNewLayout(const gd::String& name,
                                      std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout())));
+  if (position > scenes.size()) position = scenes.size();
+  gd::Layout& newlyInsertedLayout =
+      *(*(scenes.emplace(scenes.begin() + position, new Layout())));
 
   newlyInsertedLayout.SetName(name);
+  layoutsIndex.Update(scenes, position);
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 
   return newlyInsertedLayout;
@@ -349,46 +346,70 @@ gd::Layout& Project::InsertNewLayout(const gd::String& name,
 
 gd::Layout& Project::InsertLayout(const gd::Layout& layout,
                                   std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout(layout))));
+  if (position > scenes.size()) position = scenes.size();
+  gd::Layout& newlyInsertedLayout =
+      *(*(scenes.emplace(scenes.begin() + position, new Layout(layout))));
 
+  layoutsIndex.Update(scenes, position);
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 
   return newlyInsertedLayout;
 }
 
 void Project::RemoveLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Layout> >::iterator scene =
-      find_if(scenes.begin(), scenes.end(), [&name](const std::unique_ptr<gd::Layout>& layout) {
-        return layout->GetName() == name;
-      });
-  if (scene == scenes.end()) return;
+  std::size_t position = layoutsIndex.Find(scenes, name);
+  if (position == gd::String::npos) return;
+
+  layoutsIndex.Remove(name);
+  {
+    std::lock_guard<std::mutex> lock(layoutsLoadingMutex);
+    layoutsElementsToLoad.erase(scenes[position].get());
+    hasLayoutsToLoad = !layoutsElementsToLoad.empty();
+  }
+  scenes.erase(scenes.begin() + position);
+  layoutsIndex.Update(scenes, position);
+}
+
+bool Project::IsLayoutLoaded(const gd::String& name) const {
+  std::size_t position = layoutsIndex.Find(scenes, name);
+  if (position == gd::String::npos) return false;
+  if (!hasLayoutsToLoad) return true;
+
+  std::lock_guard<std::mutex> lock(layoutsLoadingMutex);
+  return layoutsElementsToLoad.find(scenes[position].get()) ==
+         layoutsElementsToLoad.end();
+}
 
-  scenes.erase(scene);
+void Project::LoadAllLayouts() const {
+  for (std::size_t i = 0; i < scenes.size() && hasLayoutsToLoad; ++i)
+    EnsureLayoutLoaded(i);
+}
+
+void Project::EnsureLayoutLoaded(std::size_t index) const {
+  if (!hasLayoutsToLoad) return;
+
+  // Other threads accessing the same layout wait for it to be loaded.
+  std::lock_guard<std::mutex> lock(layoutsLoadingMutex);
+  auto it = layoutsElementsToLoad.find(scenes[index].get());
+  if (it == layoutsElementsToLoad.end()) return;
+
+  // The layout is not const (it's owned through a unique_ptr). The project
+  // is only given to find the metadata of objects and behaviors, like when
+  // layouts are unserialized in parallel by UnserializeFrom.
+  scenes[index]->UnserializeFrom(const_cast<gd::Project&>(*this), *it->second);
+  layoutsElementsToLoad.erase(it);
+  hasLayoutsToLoad = !layoutsElementsToLoad.empty();
 }
 
 bool Project::HasExternalEventsNamed(const gd::String& name) const {
-  return (find_if(externalEvents.begin(),
-                  externalEvents.end(),
-                  [&name](const std::unique_ptr<gd::ExternalEvents>& externalEvents) {
-                    return externalEvents->GetName() == name;
-                  }) != externalEvents.end());
+  return externalEventsIndex.Find(externalEvents, name) != gd::String::npos;
 }
 gd::ExternalEvents& Project::GetExternalEvents(const gd::String& name) {
-  return *(*find_if(externalEvents.begin(),
-                    externalEvents.end(),
-                    [&name](const std::unique_ptr<gd::ExternalEvents>& externalEvents) {
-                      return externalEvents->GetName() == name;
-                    }));
+  return *externalEvents[externalEventsIndex.Find(externalEvents, name)];
 }
 const gd::ExternalEvents& Project::GetExternalEvents(
     const gd::String& name) const {
-  return *(*find_if(externalEvents.begin(),
-                    externalEvents.end(),
-                    [&name](const std::unique_ptr<gd::ExternalEvents>& externalEvents) {
-                      return externalEvents->GetName() == name;
-                    }));
+  return *externalEvents[externalEventsIndex.Find(externalEvents, name)];
 }
 gd::ExternalEvents& Project::GetExternalEvents(std::size_t index) {
   return *externalEvents[index];
@@ -397,10 +418,7 @@ const gd::ExternalEvents& Project::GetExternalEvents(std::size_t index) const {
   return *externalEvents[index];
 }
 std::size_t Project::GetExternalEventsPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < externalEvents.size(); ++i) {
-    if (externalEvents[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return externalEventsIndex.Find(externalEvents, name);
 }
 std::size_t Project::GetExternalEventsCount() const {
   return externalEvents.size();
@@ -408,36 +426,33 @@ std::size_t Project::GetExternalEventsCount() const {
 
 gd::ExternalEvents& Project::InsertNewExternalEvents(const gd::String& name,
                                                      std::size_t position) {
+  if (position > externalEvents.size()) position = externalEvents.size();
   gd::ExternalEvents& newlyInsertedExternalEvents = *(*(externalEvents.emplace(
-      position < externalEvents.size() ? externalEvents.begin() + position
-                                       : externalEvents.end(),
-      new gd::ExternalEvents())));
+      externalEvents.begin() + position, new gd::ExternalEvents())));
 
   newlyInsertedExternalEvents.SetName(name);
+  externalEventsIndex.Update(externalEvents, position);
 
   return newlyInsertedExternalEvents;
 }
 
 gd::ExternalEvents& Project::InsertExternalEvents(
     const gd::ExternalEvents& events, std::size_t position) {
+  if (position > externalEvents.size()) position = externalEvents.size();
   gd::ExternalEvents& newlyInsertedExternalEvents = *(*(externalEvents.emplace(
-      position < externalEvents.size() ? externalEvents.begin() + position
-                                       : externalEvents.end(),
-      new gd::ExternalEvents(events))));
+      externalEvents.begin() + position, new gd::ExternalEvents(events))));
 
+  externalEventsIndex.Update(externalEvents, position);
   return newlyInsertedExternalEvents;
 }
 
 void Project::RemoveExternalEvents(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::ExternalEvents> >::iterator events =
-      find_if(externalEvents.begin(),
-              externalEvents.end(),
-              [&name](const std::unique_ptr<gd::ExternalEvents>& externalEvents) {
-                return externalEvents->GetName() == name;
-              });
-  if (events == externalEvents.end()) return;
+  std::size_t position = externalEventsIndex.Find(externalEvents, name);
+  if (position == gd::String::npos) return;
 
-  externalEvents.erase(events);
+  externalEventsIndex.Remove(name);
+  externalEvents.erase(externalEvents.begin() + position);
+  externalEventsIndex.Update(externalEvents, position);
 }
 
 void Project::MoveLayout(std::size_t oldIndex, std::size_t newIndex) {
@@ -446,6 +461,8 @@ void Project::MoveLayout(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Layout> scene = std::move(scenes[oldIndex]);
   scenes.erase(scenes.begin() + oldIndex);
   scenes.insert(scenes.begin() + newIndex, std::move(scene));
+  layoutsIndex.Update(
+      scenes, std::min(oldIndex, newIndex), std::max(oldIndex, newIndex));
 };
 
 void Project::MoveExternalEvents(std::size_t oldIndex, std::size_t newIndex) {
@@ -457,6 +474,9 @@ void Project::MoveExternalEvents(std::size_t oldIndex, std::size_t newIndex) {
   externalEvents.erase(externalEvents.begin() + oldIndex);
   externalEvents.insert(externalEvents.begin() + newIndex,
                         std::move(externalEventsItem));
+  externalEventsIndex.Update(externalEvents,
+                             std::min(oldIndex, newIndex),
+                             std::max(oldIndex, newIndex));
 };
 
 void Project::MoveExternalLayout(std::size_t oldIndex, std::size_t newIndex) {
@@ -468,6 +488,9 @@ void Project::MoveExternalLayout(std::size_t oldIndex, std::size_t newIndex) {
   externalLayouts.erase(externalLayouts.begin() + oldIndex);
   externalLayouts.insert(externalLayouts.begin() + newIndex,
                          std::move(externalLayout));
+  externalLayoutsIndex.Update(externalLayouts,
+                              std::min(oldIndex, newIndex),
+                              std::max(oldIndex, newIndex));
 };
 
 void Project::MoveEventsFunctionsExtension(std::size_t oldIndex,
@@ -481,6 +504,9 @@ void Project::MoveEventsFunctionsExtension(std::size_t oldIndex,
   eventsFunctionsExtensions.erase(eventsFunctionsExtensions.begin() + oldIndex);
   eventsFunctionsExtensions.insert(eventsFunctionsExtensions.begin() + newIndex,
                                    std::move(eventsFunctionsExtension));
+  eventsFunctionsExtensionsIndex.Update(eventsFunctionsExtensions,
+                                        std::min(oldIndex, newIndex),
+                                        std::max(oldIndex, newIndex));
 };
 
 void Project::SwapExternalEvents(std::size_t first, std::size_t second) {
@@ -488,6 +514,8 @@ void Project::SwapExternalEvents(std::size_t first, std::size_t second) {
 
   std::iter_swap(externalEvents.begin() + first,
                  externalEvents.begin() + second);
+  externalEventsIndex.Update(externalEvents, first, first);
+  externalEventsIndex.Update(externalEvents, second, second);
 }
 
 void Project::SwapExternalLayouts(std::size_t first, std::size_t second) {
@@ -496,28 +524,18 @@ void Project::SwapExternalLayouts(std::size_t first, std::size_t second) {
 
   std::iter_swap(externalLayouts.begin() + first,
                  externalLayouts.begin() + second);
+  externalLayoutsIndex.Update(externalLayouts, first, first);
+  externalLayoutsIndex.Update(externalLayouts, second, second);
 }
 bool Project::HasExternalLayoutNamed(const gd::String& name) const {
-  return (find_if(externalLayouts.begin(),
-                  externalLayouts.end(),
-                  [&name](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
-                    return externalLayout->GetName() == name;
-                  }) != externalLayouts.end());
+  return externalLayoutsIndex.Find(externalLayouts, name) != gd::String::npos;
 }
 gd::ExternalLayout& Project::GetExternalLayout(const gd::String& name) {
-  return *(*find_if(externalLayouts.begin(),
-                    externalLayouts.end(),
-                    [&name](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
-                      return externalLayout->GetName() == name;
-                    }));
+  return *externalLayouts[externalLayoutsIndex.Find(externalLayouts, name)];
 }
 const gd::ExternalLayout& Project::GetExternalLayout(
     const gd::String& name) const {
-  return *(*find_if(externalLayouts.begin(),
-                    externalLayouts.end(),
-                    [&name](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
-                      return externalLayout->GetName() == name;
-                    }));
+  return *externalLayouts[externalLayoutsIndex.Find(externalLayouts, name)];
 }
 gd::ExternalLayout& Project::GetExternalLayout(std::size_t index) {
   return *externalLayouts[index];
@@ -526,10 +544,7 @@ const gd::ExternalLayout& Project::GetExternalLayout(std::size_t index) const {
   return *externalLayouts[index];
 }
 std::size_t Project::GetExternalLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < externalLayouts.size(); ++i) {
-    if (externalLayouts[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return externalLayoutsIndex.Find(externalLayouts, name);
 }
 
 std::size_t Project::GetExternalLayoutsCount() const {
@@ -538,35 +553,32 @@ std::size_t Project::GetExternalLayoutsCount() const {
 
 gd::ExternalLayout& Project::InsertNewExternalLayout(const gd::String& name,
                                                      std::size_t position) {
+  if (position > externalLayouts.size()) position = externalLayouts.size();
   gd::ExternalLayout& newlyInsertedExternalLayout = *(*(externalLayouts.emplace(
-      position < externalLayouts.size() ? externalLayouts.begin() + position
-                                        : externalLayouts.end(),
-      new gd::ExternalLayout())));
+      externalLayouts.begin() + position, new gd::ExternalLayout())));
 
   newlyInsertedExternalLayout.SetName(name);
+  externalLayoutsIndex.Update(externalLayouts, position);
   return newlyInsertedExternalLayout;
 }
 
 gd::ExternalLayout& Project::InsertExternalLayout(
     const gd::ExternalLayout& layout, std::size_t position) {
+  if (position > externalLayouts.size()) position = externalLayouts.size();
   gd::ExternalLayout& newlyInsertedExternalLayout = *(*(externalLayouts.emplace(
-      position < externalLayouts.size() ? externalLayouts.begin() + position
-                                        : externalLayouts.end(),
-      new gd::ExternalLayout(layout))));
+      externalLayouts.begin() + position, new gd::ExternalLayout(layout))));
 
+  externalLayoutsIndex.Update(externalLayouts, position);
   return newlyInsertedExternalLayout;
 }
 
 void Project::RemoveExternalLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::ExternalLayout> >::iterator externalLayout =
-      find_if(externalLayouts.begin(),
-              externalLayouts.end(),
-              [&name](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
-                return externalLayout->GetName() == name;
-              });
-  if (externalLayout == externalLayouts.end()) return;
+  std::size_t position = externalLayoutsIndex.Find(externalLayouts, name);
+  if (position == gd::String::npos) return;
 
-  externalLayouts.erase(externalLayout);
+  externalLayoutsIndex.Remove(name);
+  externalLayouts.erase(externalLayouts.begin() + position);
+  externalLayoutsIndex.Update(externalLayouts, position);
 }
 
 void Project::SwapEventsFunctionsExtensions(std::size_t first,
@@ -577,34 +589,23 @@ void Project::SwapEventsFunctionsExtensions(std::size_t first,
 
   std::iter_swap(eventsFunctionsExtensions.begin() + first,
                  eventsFunctionsExtensions.begin() + second);
+  eventsFunctionsExtensionsIndex.Update(eventsFunctionsExtensions, first, first);
+  eventsFunctionsExtensionsIndex.Update(
+      eventsFunctionsExtensions, second, second);
 }
 bool Project::HasEventsFunctionsExtensionNamed(const gd::String& name) const {
-  return (
-      find_if(
-          eventsFunctionsExtensions.begin(),
-          eventsFunctionsExtensions.end(),
-          [&name](
-              const std::unique_ptr<gd::EventsFunctionsExtension>& extension) {
-            return extension->GetName() == name;
-          }) != eventsFunctionsExtensions.end());
+  return eventsFunctionsExtensionsIndex.Find(eventsFunctionsExtensions, name) !=
+         gd::String::npos;
 }
 gd::EventsFunctionsExtension& Project::GetEventsFunctionsExtension(
     const gd::String& name) {
-  return *(*find_if(
-      eventsFunctionsExtensions.begin(),
-      eventsFunctionsExtensions.end(),
-      [&name](const std::unique_ptr<gd::EventsFunctionsExtension>& extension) {
-        return extension->GetName() == name;
-      }));
+  return *eventsFunctionsExtensions[eventsFunctionsExtensionsIndex.Find(
+      eventsFunctionsExtensions, name)];
 }
 const gd::EventsFunctionsExtension& Project::GetEventsFunctionsExtension(
     const gd::String& name) const {
-  return *(*find_if(
-      eventsFunctionsExtensions.begin(),
-      eventsFunctionsExtensions.end(),
-      [&name](const std::unique_ptr<gd::EventsFunctionsExtension>& extension) {
-        return extension->GetName() == name;
-      }));
+  return *eventsFunctionsExtensions[eventsFunctionsExtensionsIndex.Find(
+      eventsFunctionsExtensions, name)];
 }
 gd::EventsFunctionsExtension& Project::GetEventsFunctionsExtension(
     std::size_t index) {
@@ -616,10 +617,7 @@ const gd::EventsFunctionsExtension& Project::GetEventsFunctionsExtension(
 }
 std::size_t Project::GetEventsFunctionsExtensionPosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < eventsFunctionsExtensions.size(); ++i) {
-    if (eventsFunctionsExtensions[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return eventsFunctionsExtensionsIndex.Find(eventsFunctionsExtensions, name);
 }
 
 std::size_t Project::GetEventsFunctionsExtensionsCount() const {
@@ -628,44 +626,43 @@ std::size_t Project::GetEventsFunctionsExtensionsCount() const {
 
 gd::EventsFunctionsExtension& Project::InsertNewEventsFunctionsExtension(
     const gd::String& name, std::size_t position) {
+  if (position > eventsFunctionsExtensions.size())
+    position = eventsFunctionsExtensions.size();
   gd::EventsFunctionsExtension& newlyInsertedEventsFunctionsExtension =
       *(*(eventsFunctionsExtensions.emplace(
-          position < eventsFunctionsExtensions.size()
-              ? eventsFunctionsExtensions.begin() + position
-              : eventsFunctionsExtensions.end(),
+          eventsFunctionsExtensions.begin() + position,
           new gd::EventsFunctionsExtension())));
 
   newlyInsertedEventsFunctionsExtension.SetName(name);
+  eventsFunctionsExtensionsIndex.Update(eventsFunctionsExtensions, position);
   return newlyInsertedEventsFunctionsExtension;
 }
 
 gd::EventsFunctionsExtension& Project::InsertEventsFunctionsExtension(
     const gd::EventsFunctionsExtension& extension, std::size_t position) {
+  if (position > eventsFunctionsExtensions.size())
+    position = eventsFunctionsExtensions.size();
   gd::EventsFunctionsExtension& newlyInsertedEventsFunctionsExtension =
       *(*(eventsFunctionsExtensions.emplace(
-          position < eventsFunctionsExtensions.size()
-              ? eventsFunctionsExtensions.begin() + position
-              : eventsFunctionsExtensions.end(),
+          eventsFunctionsExtensions.begin() + position,
           new gd::EventsFunctionsExtension(extension))));
 
+  eventsFunctionsExtensionsIndex.Update(eventsFunctionsExtensions, position);
   return newlyInsertedEventsFunctionsExtension;
 }
 
 void Project::RemoveEventsFunctionsExtension(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::EventsFunctionsExtension> >::iterator
-      eventsFunctionExtension = find_if(
-          eventsFunctionsExtensions.begin(),
-          eventsFunctionsExtensions.end(),
-          [&name](
-              const std::unique_ptr<gd::EventsFunctionsExtension>& extension) {
-            return extension->GetName() == name;
-          });
-  if (eventsFunctionExtension == eventsFunctionsExtensions.end()) return;
-
-  eventsFunctionsExtensions.erase(eventsFunctionExtension);
+  std::size_t position =
+      eventsFunctionsExtensionsIndex.Find(eventsFunctionsExtensions, name);
+  if (position == gd::String::npos) return;
+
+  eventsFunctionsExtensionsIndex.Remove(name);
+  eventsFunctionsExtensions.erase(eventsFunctionsExtensions.begin() + position);
+  eventsFunctionsExtensionsIndex.Update(eventsFunctionsExtensions, position);
 }
 void Project::ClearEventsFunctionsExtensions() {
   eventsFunctionsExtensions.clear();
+  eventsFunctionsExtensionsIndex.Clear();
 }
 
 void Project::UnserializeFrom(const SerializerElement& element) {
@@ -861,7 +858,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   if (currentPlatform == NULL && !platforms.empty())
     currentPlatform = platforms.back();
 
-  eventsFunctionsExtensions.clear();
+  ClearEventsFunctionsExtensions();
   const SerializerElement& eventsFunctionsExtensionsElement =
       element.GetChild("eventsFunctionsExtensions");
   UnserializeAndInsertExtensionsFrom(eventsFunctionsExtensionsElement);
@@ -878,7 +875,14 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
+  // Layouts and external events only depend on the extensions and the global
+  // objects: they are unserialized after being all inserted, possibly on
+  // several threads.
+  std::vector<std::function<void()>> unserializationTasks;
+
   scenes.clear();
+  layoutsIndex.Clear();
+  layoutsElementsToLoad.clear();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -887,11 +891,19 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
     gd::Layout& layout = InsertNewLayout(
         layoutElement.GetStringAttribute("name", "", "nom"), -1);
-    layout.UnserializeFrom(*this, layoutElement);
+    if (lazyLayoutsLoading) {
+      layoutsElementsToLoad[&layout] = layoutsElement.GetSharedChild(i);
+    } else {
+      unserializationTasks.push_back([this, &layout, &layoutElement]() {
+        layout.UnserializeFrom(*this, layoutElement);
+      });
+    }
   }
+  hasLayoutsToLoad = !layoutsElementsToLoad.empty();
   SetFirstLayout(element.GetChild("firstLayout").GetStringValue());
 
   externalEvents.clear();
+  externalEventsIndex.Clear();
   const SerializerElement& externalEventsElement =
       element.GetChild("externalEvents", 0, "ExternalEvents");
   externalEventsElement.ConsiderAsArrayOf("externalEvents", "ExternalEvents");
@@ -902,10 +914,25 @@ void Project::UnserializeFrom(const SerializerElement& element) {
     gd::ExternalEvents& externalEvents = InsertNewExternalEvents(
         externalEventElement.GetStringAttribute("name", "", "Name"),
         GetExternalEventsCount());
-    externalEvents.UnserializeFrom(*this, externalEventElement);
+    unserializationTasks.push_back(
+        [this, &externalEvents, &externalEventElement]() {
+          externalEvents.UnserializeFrom(*this, externalEventElement);
+        });
+  }
+  // Indexes are rebuilt before the parallel unserialization, so that lookups
+  // done by the tasks never have to rebuild them.
+  layoutsIndex.Rebuild(scenes);
+  externalEventsIndex.Rebuild(externalEvents);
+  eventsFunctionsExtensionsIndex.Rebuild(eventsFunctionsExtensions);
+  if (unserializationThreadsCount > 1) {
+    // Deferred extensions are declared while searching for metadata, which
+    // must not happen on several threads at the same time.
+    for (auto platform : platforms) platform->DeclareAllExtensions();
   }
+  gd::ParallelTasks::Run(unserializationTasks, unserializationThreadsCount);
 
   externalLayouts.clear();
+  externalLayoutsIndex.Clear();
   const SerializerElement& externalLayoutsElement =
       element.GetChild("externalLayouts", 0, "ExternalLayouts");
   externalLayoutsElement.ConsiderAsArrayOf("externalLayout", "ExternalLayout");
@@ -917,6 +944,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
         InsertNewExternalLayout("", GetExternalLayoutsCount());
     newExternalLayout.UnserializeFrom(externalLayoutElement);
   }
+  externalLayoutsIndex.Rebuild(externalLayouts);
 
   externalSourceFiles.clear();
   const SerializerElement& externalSourceFilesElement =
@@ -1148,8 +1176,19 @@ void Project::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("firstLayout", firstLayout);
   gd::SerializerElement& layoutsElement = element.AddChild("layouts");
   layoutsElement.ConsiderAsArrayOf("layout");
-  for (std::size_t i = 0; i < GetLayoutsCount(); i++)
-    GetLayout(i).SerializeTo(layoutsElement.AddChild("layout"));
+  for (std::size_t i = 0; i < GetLayoutsCount(); i++) {
+    // Layouts not loaded yet are unchanged: their element is reused as is.
+    std::shared_ptr<const gd::SerializerElement> layoutElementToLoad;
+    if (hasLayoutsToLoad) {
+      std::lock_guard<std::mutex> lock(layoutsLoadingMutex);
+      auto it = layoutsElementsToLoad.find(scenes[i].get());
+      if (it != layoutsElementsToLoad.end()) layoutElementToLoad = it->second;
+    }
+    if (layoutElementToLoad)
+      layoutsElement.AddChild("layout") = *layoutElementToLoad;
+    else
+      GetLayout(i).SerializeTo(layoutsElement.AddChild("layout"));
+  }
 
   SerializerElement& externalEventsElement = element.AddChild("externalEvents");
   externalEventsElement.ConsiderAsArrayOf("externalEvents");
@@ -1335,11 +1374,27 @@ void Project::Init(const gd::Project& game) {
   objectsContainer = game.objectsContainer;
 
   scenes = gd::Clone(game.scenes);
+  layoutsIndex.Rebuild(scenes);
+  lazyLayoutsLoading = game.lazyLayoutsLoading;
+  unserializationThreadsCount = game.unserializationThreadsCount;
+  {
+    std::lock_guard<std::mutex> lock(game.layoutsLoadingMutex);
+    layoutsElementsToLoad.clear();
+    for (std::size_t i = 0; i < game.scenes.size(); ++i) {
+      auto it = game.layoutsElementsToLoad.find(game.scenes[i].get());
+      if (it != game.layoutsElementsToLoad.end())
+        layoutsElementsToLoad[scenes[i].get()] = it->second;
+    }
+    hasLayoutsToLoad = !layoutsElementsToLoad.empty();
+  }
 
   externalEvents = gd::Clone(game.externalEvents);
+  externalEventsIndex.Rebuild(externalEvents);
 
   externalLayouts = gd::Clone(game.externalLayouts);
+  externalLayoutsIndex.Rebuild(externalLayouts);
   eventsFunctionsExtensions = gd::Clone(game.eventsFunctionsExtensions);
+  eventsFunctionsExtensionsIndex.Rebuild(eventsFunctionsExtensions);
 
   useExternalSourceFiles = game.useExternalSourceFiles;
 
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
@@ -19,6 +22,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/Project/Watermark.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class Platform;
 class Layout;
@@ -619,8 +623,63 @@ class GD_CORE_API Project {
    */
   void RemoveLayout(const gd::String& name);
 
+  /**
+   * \brief Set if the layouts must be unserialized only when they are
+   * accessed for the first time (with GetLayout), instead of in
+   * UnserializeFrom.
+   *
+   * Until then, the element of each layout is kept in memory and only the
+   * name of the layout is available (HasLayoutNamed, GetLayoutPosition...).
+   * The elements are shared with the element given to UnserializeFrom (they
+   * are not copied), so this element must not be modified afterwards.
+   * This must be set before calling UnserializeFrom.
+   */
+  void SetLazyLayoutsLoading(bool enable) { lazyLayoutsLoading = enable; }
+
+  /**
+   * \brief Return true if the layouts are unserialized when they are accessed
+   * for the first time.
+   *
+   * \see gd::Project::SetLazyLayoutsLoading
+   */
+  bool IsLazyLayoutsLoadingEnabled() const { return lazyLayoutsLoading; }
+
+  /**
+   * \brief Return true if the layout called "name" was unserialized (always
+   * true when lazy loading is not enabled).
+   */
+  bool IsLayoutLoaded(const gd::String& name) const;
+
+  /**
+   * \brief Unserialize all the layouts that were not accessed yet.
+   *
+   * Layouts can be loaded from several threads, but only one at a time:
+   * call this before browsing the project on several threads so that they
+   * don't wait for each other.
+   */
+  void LoadAllLayouts() const;
+
   ///@}
 
+  /**
+   * \brief Set the number of threads used by UnserializeFrom to unserialize
+   * the layouts and the external events, which are independent from each
+   * other once the extensions and the global objects are unserialized.
+   *
+   * With 1 (the default), everything is unserialized on the calling thread.
+   * Threads are not used in the web build (Emscripten).
+   */
+  void SetUnserializationThreadsCount(std::size_t count) {
+    unserializationThreadsCount = count;
+  }
+
+  /**
+   * \brief Return the number of threads used by UnserializeFrom.
+   */
+  std::size_t GetUnserializationThreadsCount() const {
+    return unserializationThreadsCount;
+  }
+
   /**
    * \brief Unserialize the project from an element.
    */
@@ -1080,6 +1139,12 @@ class GD_CORE_API Project {
    */
   void Init(const gd::Project& project);
 
+  /**
+   * Unserialize the layout if it was not accessed since the project was
+   * unserialized with lazy layouts loading.
+   */
+  void EnsureLayoutLoaded(std::size_t index) const;
+
   /**
    * @brief Get the project extensions names in the order they have to be
    * unserialized.
@@ -1128,12 +1193,29 @@ class GD_CORE_API Project {
               ///< found on the layer at the scene
               ///< startup.
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
+  gd::NameIndex<gd::Layout> layoutsIndex;
+  bool lazyLayoutsLoading = false;  ///< If true, layouts are unserialized
+                                    ///< when accessed for the first time.
+  mutable std::unordered_map<const gd::Layout*,
+                             std::shared_ptr<const gd::SerializerElement> >
+      layoutsElementsToLoad;  ///< The elements of the layouts not
+                              ///< unserialized yet.
+  mutable std::mutex
+      layoutsLoadingMutex;  ///< Protects layoutsElementsToLoad, as layouts
+                            ///< can be loaded from const methods called on
+                            ///< several threads.
+  mutable std::atomic<bool> hasLayoutsToLoad{
+      false};  ///< True if layoutsElementsToLoad is not empty, to avoid
+               ///< locking the mutex once all layouts are loaded.
+  std::size_t unserializationThreadsCount = 1;
   gd::VariablesContainer variables;  ///< Initial global variables
   gd::ObjectsContainer objectsContainer;
   std::vector<std::unique_ptr<gd::ExternalLayout> >
       externalLayouts;  ///< List of all externals layouts
+  gd::NameIndex<gd::ExternalLayout> externalLayoutsIndex;
   std::vector<std::unique_ptr<gd::EventsFunctionsExtension> >
       eventsFunctionsExtensions;
+  gd::NameIndex<gd::EventsFunctionsExtension> eventsFunctionsExtensionsIndex;
   gd::ResourcesManager
       resourcesManager;  ///< Contains all resources used by the project
   std::vector<gd::Platform*>
@@ -1171,6 +1253,7 @@ class GD_CORE_API Project {
   gd::Watermark watermark;
   std::vector<std::unique_ptr<gd::ExternalEvents> >
       externalEvents;  ///< List of all externals events
+  gd::NameIndex<gd::ExternalEvents> externalEventsIndex;
   ExtensionProperties
       extensionProperties;  ///< The properties of the extensions.
   gd::WholeProjectDiagnosticReport wholeProjectDiagnosticReport;
@@ -17,6 +17,7 @@ class EventsFunctionsExtension;
 class EventsFunction;
 class EventsBasedBehavior;
 class EventsBasedObject;
+class IdentifiersSearchIndex;
 } // namespace gd
 
 namespace gd {
@@ -43,7 +44,8 @@ class ProjectScopedContainers {
         variablesContainersList(variablesContainersList_),
         legacyGlobalVariables(legacyGlobalVariables_),
         legacySceneVariables(legacySceneVariables_),
-        propertiesContainersList(propertiesContainersList_){};
+        propertiesContainersList(propertiesContainersList_),
+        identifiersSearchIndex(nullptr){};
   virtual ~ProjectScopedContainers(){};
 
   static ProjectScopedContainers
@@ -114,6 +116,27 @@ class ProjectScopedContainers {
     return *this;
   }
 
+  /**
+   * \brief Set the index used to find the objects, groups and variables
+   * matching a search (see ForEachIdentifierMatchingSearch), instead of
+   * checking all the names in scope.
+   *
+   * \see gd::IdentifiersSearchIndex
+   */
+  ProjectScopedContainers &SetIdentifiersSearchIndex(
+      const gd::IdentifiersSearchIndex &index) {
+    identifiersSearchIndex = &index;
+
+    return *this;
+  }
+
+  /**
+   * \brief Return the index used to find the names matching a search, if any.
+   */
+  const gd::IdentifiersSearchIndex *GetIdentifiersSearchIndex() const {
+    return identifiersSearchIndex;
+  };
+
   template <class ReturnType>
   ReturnType MatchIdentifierWithName(
       const gd::String &name,
@@ -155,14 +178,17 @@ class ProjectScopedContainers {
             namesAlreadySeen.insert(name);
             objectCallback(name, objectConfiguration);
           }
-        });
+        },
+        identifiersSearchIndex);
     variablesContainersList.ForEachVariableMatchingSearch(
-        search, [&](const gd::String &name, const gd::Variable &variable) {
+        search,
+        [&](const gd::String &name, const gd::Variable &variable) {
           if (namesAlreadySeen.count(name) == 0) {
             namesAlreadySeen.insert(name);
             variableCallback(name, variable);
           }
-        });
+        },
+        identifiersSearchIndex);
     gd::ParameterMetadataTools::ForEachParameterMatchingSearch(
         parametersVectorsList,
         search,
@@ -226,7 +252,9 @@ class ProjectScopedContainers {
   /** Do not use - should be private but accessible to let Emscripten create a
    * temporary. */
   ProjectScopedContainers()
-      : legacyGlobalVariables(nullptr), legacySceneVariables(nullptr){};
+      : legacyGlobalVariables(nullptr),
+        legacySceneVariables(nullptr),
+        identifiersSearchIndex(nullptr){};
 
 private:
   gd::ObjectsContainersList objectsContainersList;
@@ -235,6 +263,7 @@ private:
   const gd::VariablesContainer *legacySceneVariables;
   gd::PropertiesContainersList propertiesContainersList;
   std::vector<const ParameterMetadataContainer *> parametersVectorsList;
+  const gd::IdentifiersSearchIndex *identifiersSearchIndex;  ///< Can be null.
 };
 
 }  // namespace gd
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "EventsFunctionsContainer.h"
+#include "GDCore/Project/PropertiesSchema.h"
 #include "GDCore/Tools/SerializableWithNameList.h"
 #include "NamedPropertyDescriptor.h"
 
@@ -43,8 +44,25 @@ class PropertiesContainer
 
   EventsFunctionsContainer::FunctionOwner GetOwner() const { return owner; }
 
+  /**
+   * \brief Return the compiled schema of the properties, giving a slot to each
+   * property.
+   *
+   * The schema is compiled again only if properties were changed since the
+   * last call.
+   *
+   * \warning The schema is cached, so this must not be called by several
+   * threads at the same time.
+   */
+  const gd::PropertiesSchema& GetSchema() const {
+    if (!schema.IsUpToDate(*this)) schema = gd::PropertiesSchema(*this);
+    return schema;
+  }
+
  private:
   EventsFunctionsContainer::FunctionOwner owner;
+  mutable gd::PropertiesSchema schema;  ///< Cache of the compiled properties,
+                                        ///< not copied.
 };
 
 }  // namespace gd
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/PropertiesSchema.h"
+
+#include "GDCore/Project/NamedPropertyDescriptor.h"
+#include "GDCore/Project/PropertiesContainer.h"
+
+namespace gd {
+
+PropertiesSchema::PropertiesSchema(const gd::PropertiesContainer& properties) {
+  slots.reserve(properties.GetCount());
+  for (const auto& property : properties.GetInternalVector()) {
+    Slot slot;
+    slot.descriptor = property.get();
+    slot.name = property->GetName();
+    slot.type = property->GetType();
+    slot.defaultValue = property->GetValue();
+    slot.valueType = GetValueType(slot.type);
+
+    // Keep the first property if names are duplicated.
+    slotsByName.emplace(slot.name, slots.size());
+    slots.push_back(std::move(slot));
+  }
+}
+
+PropertiesSchema::ValueType PropertiesSchema::GetValueType(
+    const gd::String& propertyType) {
+  if (propertyType == "String" || propertyType == "Choice" ||
+      propertyType == "Color" || propertyType == "Behavior" ||
+      propertyType == "Resource" || propertyType == "LeaderboardId")
+    return StringValue;
+  if (propertyType == "Number") return NumberValue;
+  if (propertyType == "Boolean") return BooleanValue;
+
+  return NoValue;
+}
+
+bool PropertiesSchema::IsUpToDate(
+    const gd::PropertiesContainer& properties) const {
+  const auto& descriptors = properties.GetInternalVector();
+  if (descriptors.size() != slots.size()) return false;
+
+  for (std::size_t i = 0; i < slots.size(); ++i) {
+    const auto& slot = slots[i];
+    const auto& descriptor = *descriptors[i];
+    if (slot.descriptor != &descriptor || slot.name != descriptor.GetName() ||
+        slot.type != descriptor.GetType() ||
+        slot.defaultValue != descriptor.GetValue())
+      return false;
+  }
+
+  return true;
+}
+
+}  // namespace gd
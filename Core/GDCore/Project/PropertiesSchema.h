@@ -0,0 +1,122 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class NamedPropertyDescriptor;
+class PropertiesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The compiled form of the properties of an events-based behavior or
+ * object.
+ *
+ * Each property is given a slot index and the type of its value, so that the
+ * values stored in the content of a behavior or an object can be read without
+ * going through the property descriptors.
+ *
+ * \see gd::PropertiesContainer::GetSchema
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API PropertiesSchema {
+ public:
+  /**
+   * \brief The type of the value stored for a property.
+   */
+  enum ValueType {
+    StringValue,   ///< "String", "Choice", "Color", "Behavior", "Resource"...
+    NumberValue,   ///< "Number"
+    BooleanValue,  ///< "Boolean"
+    NoValue        ///< Any other type: the value is not stored.
+  };
+
+  PropertiesSchema(){};
+
+  /**
+   * \brief Compile the schema of the given properties.
+   */
+  PropertiesSchema(const gd::PropertiesContainer& properties);
+
+  virtual ~PropertiesSchema(){};
+
+  /**
+   * \brief Return the type of value stored for a property type.
+   */
+  static ValueType GetValueType(const gd::String& propertyType);
+
+  /**
+   * \brief Return true if the schema still describes the given properties,
+   * i.e: no property was added, removed, renamed or had its type or default
+   * value changed.
+   */
+  bool IsUpToDate(const gd::PropertiesContainer& properties) const;
+
+  /**
+   * \brief Return the number of slots, i.e: the number of properties.
+   */
+  std::size_t GetSlotsCount() const { return slots.size(); }
+
+  /**
+   * \brief Return the slot of the property with the given name, or
+   * gd::String::npos if there is no such property.
+   */
+  std::size_t GetSlot(const gd::String& name) const {
+    auto it = slotsByName.find(name);
+    return it != slotsByName.end() ? it->second : gd::String::npos;
+  }
+
+  /**
+   * \brief Return the name of the property stored in the slot.
+   */
+  const gd::String& GetSlotName(std::size_t slot) const {
+    return slots[slot].name;
+  }
+
+  /**
+   * \brief Return the type of the value stored in the slot.
+   */
+  ValueType GetSlotValueType(std::size_t slot) const {
+    return slots[slot].valueType;
+  }
+
+  /**
+   * \brief Return the default value of the property stored in the slot.
+   */
+  const gd::String& GetSlotDefaultValue(std::size_t slot) const {
+    return slots[slot].defaultValue;
+  }
+
+  /**
+   * \brief Return the descriptor of the property stored in the slot.
+   *
+   * \warning The descriptor is owned by the gd::PropertiesContainer: the schema
+   * must be up to date.
+   */
+  const gd::NamedPropertyDescriptor& GetSlotDescriptor(std::size_t slot) const {
+    return *slots[slot].descriptor;
+  }
+
+ private:
+  struct Slot {
+    const gd::NamedPropertyDescriptor* descriptor;
+    gd::String name;
+    gd::String type;
+    gd::String defaultValue;
+    ValueType valueType;
+  };
+
+  std::vector<Slot> slots;
+  std::unordered_map<gd::String, std::size_t> slotsByName;
+};
+
+}  // namespace gd
@@ -6,9 +6,9 @@
 
 #include "GDCore/Project/ResourcesManager.h"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
-#include <unordered_set>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/Project.h"
@@ -32,6 +32,40 @@ namespace gd {
 
 gd::String Resource::badStr;
 
+Resource::Resource(const Resource& other)
+    : kind(other.kind),
+      name(other.name),
+      metadata(other.metadata),
+      originName(other.originName),
+      originIdentifier(other.originIdentifier),
+      userAdded(other.userAdded) {}
+
+Resource& Resource::operator=(const Resource& other) {
+  if (this != &other) {
+    kind = other.kind;
+    metadata = other.metadata;
+    originName = other.originName;
+    originIdentifier = other.originIdentifier;
+    userAdded = other.userAdded;
+    SetName(other.name);
+    NotifyFileChanged();
+  }
+
+  return *this;
+}
+
+void Resource::SetName(const gd::String& name_) {
+  if (name_ == name) return;
+
+  gd::String oldName = name;
+  name = name_;
+  if (manager) manager->OnResourceRenamed(*this, oldName);
+}
+
+void Resource::NotifyFileChanged() {
+  if (manager) manager->OnResourceFileChanged();
+}
+
 Resource ResourcesManager::badResource;
 gd::String ResourcesManager::badResourceName;
 ResourceFolder ResourcesManager::badFolder;
@@ -47,30 +81,111 @@ void ResourceFolder::Init(const ResourceFolder& other) {
 }
 
 void ResourcesManager::Init(const ResourcesManager& other) {
-  resources.clear();
+  ClearResourcesList();
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
-    resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
+    AddResourceToList(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
   folders.clear();
   for (std::size_t i = 0; i < other.folders.size(); ++i) {
     folders.push_back(other.folders[i]);
   }
+  RebuildResourcesIndex();
 }
 
-Resource& ResourcesManager::GetResource(const gd::String& name) {
+void ResourcesManager::AddResourceToList(
+    const std::shared_ptr<Resource>& resource) {
+  resource->manager = this;
+  resources.push_back(resource);
+}
+
+void ResourcesManager::ClearResourcesList() {
+  for (auto& resource : resources) {
+    if (resource && resource->manager == this) resource->manager = nullptr;
+  }
+  resources.clear();
+}
+
+void ResourcesManager::RebuildResourcesIndex() const {
+  resourcesPositionsByName.clear();
+  resourcesPositionsByName.reserve(resources.size());
+  hasResourcesWithSameName = false;
   for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+    if (resources[i] &&
+        !resourcesPositionsByName.emplace(resources[i]->GetName(), i).second)
+      hasResourcesWithSameName = true;
   }
 
-  return badResource;
+  resourcesIndexOutdated = false;
+  resourcesFilesIndexDirty = true;
 }
 
-const Resource& ResourcesManager::GetResource(const gd::String& name) const {
+void ResourcesManager::UpdateResourcesIndex(std::size_t from,
+                                            std::size_t to) const {
+  if (hasResourcesWithSameName) {
+    // Positions of the first resources with a name can't be known without
+    // going through the whole list.
+    resourcesIndexOutdated = true;
+    resourcesFilesIndexDirty = true;
+    return;
+  }
+
+  for (std::size_t i = from; i <= to && i < resources.size(); ++i) {
+    if (resources[i]) resourcesPositionsByName[resources[i]->GetName()] = i;
+  }
+
+  resourcesFilesIndexDirty = true;
+}
+
+void ResourcesManager::RebuildResourcesFilesIndex() const {
+  resourcesPositionsByFile.clear();
+  resourcesPositionsByFile.reserve(resources.size());
   for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+    if (resources[i])
+      resourcesPositionsByFile.emplace(
+          NormalizePathSeparator(resources[i]->GetFile()), i);
   }
 
-  return badResource;
+  resourcesFilesIndexDirty = false;
+}
+
+std::size_t ResourcesManager::FindResourcePosition(
+    const gd::String& name) const {
+  if (resourcesIndexOutdated) RebuildResourcesIndex();
+
+  auto it = resourcesPositionsByName.find(name);
+  return it != resourcesPositionsByName.end() ? it->second : gd::String::npos;
+}
+
+void ResourcesManager::OnResourceRenamed(const gd::Resource& resource,
+                                         const gd::String& oldName) {
+  if (resourcesIndexOutdated) return;
+
+  auto it = resourcesPositionsByName.find(oldName);
+  if (hasResourcesWithSameName || it == resourcesPositionsByName.end() ||
+      resources[it->second].get() != &resource ||
+      resourcesPositionsByName.find(resource.GetName()) !=
+          resourcesPositionsByName.end()) {
+    resourcesIndexOutdated = true;
+    return;
+  }
+
+  std::size_t position = it->second;
+  resourcesPositionsByName.erase(it);
+  resourcesPositionsByName.emplace(resource.GetName(), position);
+}
+
+Resource& ResourcesManager::GetResource(const gd::String& name) {
+  std::size_t position = FindResourcePosition(name);
+  if (position == gd::String::npos) return badResource;
+
+  return *resources[position];
+}
+
+const Resource& ResourcesManager::GetResource(const gd::String& name) const {
+  std::size_t position = FindResourcePosition(name);
+  if (position == gd::String::npos) return badResource;
+
+  return *resources[position];
 }
 
 std::shared_ptr<Resource> ResourcesManager::CreateResource(
@@ -103,11 +218,7 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return FindResourcePosition(name) != gd::String::npos;
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithOrigin(
@@ -126,12 +237,12 @@ const gd::String& ResourcesManager::GetResourceNameWithOrigin(
 
 const gd::String& ResourcesManager::GetResourceNameWithFile(
     const gd::String& file) const {
-  for (const auto& resource : resources) {
-    if (!resource) continue;
+  if (resourcesFilesIndexDirty) RebuildResourcesFilesIndex();
 
-    if (resource->GetFile() == file) {
-      return resource->GetName();
-    }
+  auto it = resourcesPositionsByFile.find(NormalizePathSeparator(file));
+  if (it != resourcesPositionsByFile.end() &&
+      resources[it->second]->GetFile() == file) {
+    return resources[it->second]->GetName();
   }
 
   return badResourceName;
@@ -147,15 +258,13 @@ std::vector<gd::String> ResourcesManager::GetAllResourceNames() const {
 
 std::vector<gd::String> ResourcesManager::FindFilesNotInResources(
     const std::vector<gd::String>& filePathsToCheck) const {
-  std::unordered_set<gd::String> resourceFilePaths;
-  for (const auto& resource : resources) {
-    resourceFilePaths.insert(NormalizePathSeparator(resource->GetFile()));
-  }
+  if (resourcesFilesIndexDirty) RebuildResourcesFilesIndex();
 
   std::vector<gd::String> filePathsNotInResources;
   for (const gd::String& file : filePathsToCheck) {
     gd::String normalizedPath = NormalizePathSeparator(file);
-    if (resourceFilePaths.find(normalizedPath) == resourceFilePaths.end())
+    if (resourcesPositionsByFile.find(normalizedPath) ==
+        resourcesPositionsByFile.end())
       filePathsNotInResources.push_back(file);
   }
 
@@ -223,7 +332,8 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
       std::shared_ptr<Resource>(resource.Clone());
   if (newResource == std::shared_ptr<Resource>()) return false;
 
-  resources.push_back(newResource);
+  AddResourceToList(newResource);
+  UpdateResourcesIndex(resources.size() - 1, resources.size() - 1);
   return true;
 }
 
@@ -236,7 +346,8 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetFile(filename);
   res->SetName(name);
 
-  resources.push_back(res);
+  AddResourceToList(res);
+  UpdateResourcesIndex(resources.size() - 1, resources.size() - 1);
 
   return true;
 }
@@ -313,19 +424,25 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
-  return gd::MoveResourceUpInList(resources, name);
+  std::size_t position = FindResourcePosition(name);
+  if (position == gd::String::npos || position == 0) return false;
+
+  MoveResource(position, position - 1);
+  return true;
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
-  return gd::MoveResourceDownInList(resources, name);
+  std::size_t position = FindResourcePosition(name);
+  if (position == gd::String::npos || position + 1 >= resources.size())
+    return false;
+
+  MoveResource(position, position + 1);
+  return true;
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return FindResourcePosition(name);
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -335,6 +452,8 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  UpdateResourcesIndex(std::min(oldIndex, newIndex),
+                       std::max(oldIndex, newIndex));
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -361,11 +480,10 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
+  std::size_t position = FindResourcePosition(name);
+  if (position == gd::String::npos) return std::shared_ptr<gd::Resource>();
 
-  return std::shared_ptr<gd::Resource>();
+  return resources[position];
 }
 
 bool ResourcesManager::HasFolder(const gd::String& name) const {
@@ -433,9 +551,11 @@ void ResourceFolder::AddResource(const gd::String& name,
 
 void ResourcesManager::RenameResource(const gd::String& oldName,
                                       const gd::String& newName) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == oldName) resources[i]->SetName(newName);
-  }
+  std::size_t position = FindResourcePosition(oldName);
+  if (position == gd::String::npos) return;
+
+  // The index is updated by the resource.
+  resources[position]->SetName(newName);
 }
 
 void ResourceFolder::RemoveResource(const gd::String& name) {
@@ -449,12 +569,19 @@ void ResourceFolder::RemoveResource(const gd::String& name) {
 }
 
 void ResourcesManager::RemoveResource(const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size();) {
-    if (resources[i] != std::shared_ptr<Resource>() &&
-        resources[i]->GetName() == name)
-      resources.erase(resources.begin() + i);
-    else
-      ++i;
+  std::size_t position = FindResourcePosition(name);
+  if (position != gd::String::npos) {
+    for (std::size_t i = position; i < resources.size();) {
+      if (resources[i] != std::shared_ptr<Resource>() &&
+          resources[i]->GetName() == name) {
+        resources[i]->manager = nullptr;
+        resources.erase(resources.begin() + i);
+      } else
+        ++i;
+    }
+
+    resourcesPositionsByName.erase(name);
+    UpdateResourcesIndex(position, resources.size() - 1);
   }
 
   for (std::size_t i = 0; i < folders.size(); ++i)
@@ -487,7 +614,7 @@ void ResourceFolder::SerializeTo(SerializerElement& element) const {
 }
 
 void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
-  resources.clear();
+  ClearResourcesList();
   const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
@@ -511,8 +638,9 @@ void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
     }
     resource->UnserializeFrom(resourceElement);
 
-    resources.push_back(resource);
+    AddResourceToList(resource);
   }
+  RebuildResourcesIndex();
 
   folders.clear();
   const SerializerElement& resourcesFoldersElement =
@@ -561,6 +689,7 @@ void ResourcesManager::SerializeResourceTo(gd::Resource &resource,
 
 void ImageResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void ImageResource::UnserializeFrom(const SerializerElement& element) {
@@ -577,6 +706,7 @@ void ImageResource::SerializeTo(SerializerElement& element) const {
 
 void AudioResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void AudioResource::UnserializeFrom(const SerializerElement& element) {
@@ -597,6 +727,7 @@ void AudioResource::SerializeTo(SerializerElement& element) const {
 
 void FontResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void FontResource::UnserializeFrom(const SerializerElement& element) {
@@ -611,6 +742,7 @@ void FontResource::SerializeTo(SerializerElement& element) const {
 
 void VideoResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void VideoResource::UnserializeFrom(const SerializerElement& element) {
@@ -625,6 +757,7 @@ void VideoResource::SerializeTo(SerializerElement& element) const {
 
 void JsonResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void JsonResource::UnserializeFrom(const SerializerElement& element) {
@@ -659,6 +792,7 @@ bool JsonResource::UpdateProperty(const gd::String& name,
 
 void TilemapResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void TilemapResource::UnserializeFrom(const SerializerElement& element) {
@@ -693,6 +827,7 @@ bool TilemapResource::UpdateProperty(const gd::String& name,
 
 void TilesetResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void TilesetResource::UnserializeFrom(const SerializerElement& element) {
@@ -727,6 +862,7 @@ bool TilesetResource::UpdateProperty(const gd::String& name,
 
 void BitmapFontResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void BitmapFontResource::UnserializeFrom(const SerializerElement& element) {
@@ -741,6 +877,7 @@ void BitmapFontResource::SerializeTo(SerializerElement& element) const {
 
 void Model3DResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void Model3DResource::UnserializeFrom(const SerializerElement& element) {
@@ -755,6 +892,7 @@ void Model3DResource::SerializeTo(SerializerElement& element) const {
 
 void AtlasResource::SetFile(const gd::String& newFile) {
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged();
 }
 
 void AtlasResource::UnserializeFrom(const SerializerElement& element) {
@@ -789,8 +927,6 @@ ResourcesManager::ResourcesManager() {
   // ctor
 }
 
-ResourcesManager::~ResourcesManager() {
-  // dtor
-}
+ResourcesManager::~ResourcesManager() { ClearResourcesList(); }
 
 }  // namespace gd
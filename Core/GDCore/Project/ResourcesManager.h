@@ -7,12 +7,14 @@
 #define GDCORE_RESOURCESMANAGER_H
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/String.h"
 namespace gd {
 class Project;
 class ResourceFolder;
+class ResourcesManager;
 class SerializerElement;
 class PropertyDescriptor;
 }  // namespace gd
@@ -27,12 +29,14 @@ namespace gd {
 class GD_CORE_API Resource {
  public:
   Resource(){};
+  Resource(const Resource& other);
+  Resource& operator=(const Resource& other);
   virtual ~Resource(){};
   virtual Resource* Clone() const { return new Resource(*this); }
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String& name_) { name = name_; }
+  virtual void SetName(const gd::String& name_);
 
   /** \brief Return the name of the resource.
    */
@@ -146,7 +150,16 @@ class GD_CORE_API Resource {
    */
   virtual void UnserializeFrom(const SerializerElement& element){};
 
+ protected:
+  /**
+   * \brief To be called by resources using a file when it's changed, so that
+   * the manager storing the resource can update its index of files.
+   */
+  void NotifyFileChanged();
+
  private:
+  friend class ResourcesManager;
+
   gd::String kind;
   gd::String name;
   gd::String metadata;
@@ -154,6 +167,9 @@ class GD_CORE_API Resource {
   gd::String originIdentifier;
   bool userAdded = false;  ///< True if the resource was added by the user, and not
                            ///< automatically by GDevelop.
+  gd::ResourcesManager* manager =
+      nullptr;  ///< The manager storing the resource, notified when the
+                ///< resource is renamed or its file changed. Not copied.
 
   static gd::String badStr;
 };
@@ -550,6 +566,13 @@ class GD_CORE_API AtlasResource : public Resource {
 /**
  * \brief Inventory all resources used by a project
  *
+ * Resources are stored in a list (the order is kept and shown to the user) and
+ * indexed by name so that lookups are done in constant time, even for projects
+ * with tens of thousands of resources.
+ *
+ * Resources stored in the manager notify it when they are renamed or when
+ * their file is changed, so that the indexes stay up to date.
+ *
  * \see Resource
  * \ingroup ResourcesManagement
  */
@@ -713,11 +736,80 @@ class GD_CORE_API ResourcesManager {
   void UnserializeFrom(const SerializerElement& element);
 
  private:
+  friend class Resource;
+
   void Init(const ResourcesManager& other);
 
+  /**
+   * \brief Return the position of the resource with the given name in the
+   * list, or gd::String::npos if not found.
+   *
+   * The position is read from the index, which is rebuilt first if it was
+   * marked as outdated.
+   */
+  std::size_t FindResourcePosition(const gd::String& name) const;
+
+  /**
+   * \brief Rebuild the index of the resources positions, by name, from
+   * the list.
+   */
+  void RebuildResourcesIndex() const;
+
+  /**
+   * \brief Store a resource in the list and make it notify this manager when
+   * it's renamed.
+   */
+  void AddResourceToList(const std::shared_ptr<Resource>& resource);
+
+  /**
+   * \brief Remove all the resources from the list (the index must be
+   * rebuilt or updated after).
+   */
+  void ClearResourcesList();
+
+  /**
+   * \brief Called by a resource of the manager after it was renamed, to
+   * update the index.
+   *
+   * If the index can't be updated in place (because several resources have
+   * the same name), it's marked as outdated and rebuilt at the next lookup.
+   */
+  void OnResourceRenamed(const gd::Resource& resource,
+                         const gd::String& oldName);
+
+  /**
+   * \brief Called by a resource of the manager after its file was changed.
+   */
+  void OnResourceFileChanged() { resourcesFilesIndexDirty = true; }
+
+  /**
+   * \brief Update the index of the resources positions for the resources
+   * between the given positions (included).
+   */
+  void UpdateResourcesIndex(std::size_t from, std::size_t to) const;
+
+  /**
+   * \brief Rebuild the index of the resources, by file (using normalized
+   * path separators), from the list.
+   */
+  void RebuildResourcesFilesIndex() const;
+
   std::vector<std::shared_ptr<Resource> > resources;
   std::vector<ResourceFolder> folders;
 
+  mutable std::unordered_map<gd::String, std::size_t>
+      resourcesPositionsByName;  ///< Position of the first resource with a
+                                 ///< given name in the list.
+  mutable std::unordered_map<gd::String, std::size_t>
+      resourcesPositionsByFile;  ///< Position of the first resource using a
+                                 ///< given (normalized) file. Lazily rebuilt.
+  mutable bool resourcesFilesIndexDirty = true;
+  mutable bool resourcesIndexOutdated =
+      false;  ///< True if the index by name must be rebuilt before use.
+  mutable bool hasResourcesWithSameName =
+      false;  ///< True if the index by name can't be updated in place, as
+              ///< several resources have the same name.
+
   static ResourceFolder badFolder;
   static Resource badResource;
   static gd::String badResourceName;
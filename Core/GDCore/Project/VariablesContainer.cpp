@@ -11,6 +11,7 @@
 #include "GDCore/Project/Variable.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/ContentHash.h"
 #include "GDCore/Tools/UUID/UUID.h"
 
 namespace gd {
@@ -49,6 +50,7 @@ bool VariablesContainer::Has(const gd::String& name) const {
 }
 
 Variable& VariablesContainer::Get(const gd::String& name) {
+  MarkAsModified();
   auto i =
       std::find_if(variables.begin(), variables.end(), VariableHasName(name));
   if (i != variables.end()) return *i->second;
@@ -65,6 +67,7 @@ const Variable& VariablesContainer::Get(const gd::String& name) const {
 }
 
 Variable& VariablesContainer::Get(std::size_t index) {
+  MarkAsModified();
   if (index < variables.size()) return *variables[index].second;
 
   return badVariable;
@@ -85,6 +88,7 @@ const gd::String& VariablesContainer::GetNameAt(std::size_t index) const {
 Variable& VariablesContainer::Insert(const gd::String& name,
                                      const gd::Variable& variable,
                                      std::size_t position) {
+  MarkAsModified();
   auto newVariable = std::make_shared<gd::Variable>(variable);
   if (position < variables.size()) {
     variables.insert(variables.begin() + position,
@@ -97,6 +101,7 @@ Variable& VariablesContainer::Insert(const gd::String& name,
 }
 
 void VariablesContainer::Remove(const gd::String& varName) {
+  MarkAsModified();
   variables.erase(
       std::remove_if(
           variables.begin(), variables.end(), VariableHasName(varName)),
@@ -105,6 +110,7 @@ void VariablesContainer::Remove(const gd::String& varName) {
 
 void VariablesContainer::RemoveRecursively(
     const gd::Variable& variableToRemove) {
+  MarkAsModified();
   variables.erase(
       std::remove_if(
           variables.begin(),
@@ -139,6 +145,7 @@ bool VariablesContainer::Rename(const gd::String& oldName,
                                 const gd::String& newName) {
   if (Has(newName)) return false;
 
+  MarkAsModified();
   auto i = std::find_if(
       variables.begin(), variables.end(), VariableHasName(oldName));
   if (i != variables.end()) i->first = newName;
@@ -152,6 +159,7 @@ void VariablesContainer::Swap(std::size_t firstVariableIndex,
       secondVariableIndex >= variables.size())
     return;
 
+  MarkAsModified();
   auto temp = variables[firstVariableIndex];
   variables[firstVariableIndex] = variables[secondVariableIndex];
   variables[secondVariableIndex] = temp;
@@ -162,6 +170,7 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
       oldIndex == newIndex)
     return;
 
+  MarkAsModified();
   auto nameAndVariable = variables[oldIndex];
   variables.erase(variables.begin() + oldIndex);
   variables.insert(variables.begin() + newIndex, nameAndVariable);
@@ -189,6 +198,17 @@ void VariablesContainer::SerializeTo(SerializerElement& element) const {
   }
 }
 
+std::uint64_t VariablesContainer::GetContentHash() const {
+  if (isContentHashOutdated) {
+    gd::SerializerElement element;
+    SerializeTo(element);
+    contentHash = gd::ContentHash::Of(element);
+    isContentHashOutdated = false;
+  }
+
+  return contentHash;
+}
+
 void VariablesContainer::UnserializeFrom(const SerializerElement& element) {
   persistentUuid = element.GetStringAttribute("persistentUuid");
 
@@ -236,6 +256,8 @@ VariablesContainer& VariablesContainer::operator=(
 void VariablesContainer::Init(const gd::VariablesContainer& other) {
   sourceType = other.sourceType;
   persistentUuid = other.persistentUuid;
+  contentHash = other.contentHash;
+  isContentHashOutdated = other.isContentHashOutdated;
   variables.clear();
   for (auto& it : other.variables) {
     variables.push_back(
@@ -5,6 +5,7 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include "GDCore/Project/Variable.h"
@@ -145,7 +146,10 @@ class GD_CORE_API VariablesContainer {
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { variables.clear(); }
+  inline void Clear() {
+    variables.clear();
+    MarkAsModified();
+  }
 
   /**
    * \brief Call the callback for each variable with a name matching the specified search.
@@ -186,6 +190,24 @@ class GD_CORE_API VariablesContainer {
   const gd::String& GetPersistentUuid() const { return persistentUuid; };
   ///@}
 
+  /**
+   * \brief Return a hash of the variables (their names, types and values).
+   *
+   * The hash is only computed again after the container was modified
+   * through its methods. Getting a variable with a non-const accessor
+   * counts as a modification, as it can be modified through the reference.
+   *
+   * \see gd::ContentHash
+   */
+  std::uint64_t GetContentHash() const;
+
+  /**
+   * \brief Mark the container as modified, so that its hash is computed
+   * again. To be called after modifying variables through references
+   * obtained before the last call to GetContentHash.
+   */
+  void MarkAsModified() { isContentHashOutdated = true; }
+
  private:
   SourceType sourceType = Unknown;
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
@@ -193,6 +215,8 @@ class GD_CORE_API VariablesContainer {
                                       ///< useful for computing changesets.
   static gd::Variable badVariable;
   static gd::String badName;
+  mutable std::uint64_t contentHash = 0;      ///< \see GetContentHash
+  mutable bool isContentHashOutdated = true;  ///< \see GetContentHash
 
   /**
    * Initialize from another variables container, copying elements. Used by
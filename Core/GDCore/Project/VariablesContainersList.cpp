@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "GDCore/Project/IdentifiersSearchIndex.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
@@ -115,10 +116,14 @@ bool VariablesContainersList::HasVariablesContainer(const gd::VariablesContainer
 
 void VariablesContainersList::ForEachVariableMatchingSearch(
     const gd::String& search,
-    std::function<void(const gd::String& name, const gd::Variable& variable)> fn) const {
+    std::function<void(const gd::String& name, const gd::Variable& variable)> fn,
+    const gd::IdentifiersSearchIndex* index) const {
   for (auto it = variablesContainers.rbegin(); it != variablesContainers.rend();
        ++it) {
-    (*it)->ForEachVariableMatchingSearch(search, fn);
+    if (index)
+      index->ForEachVariableMatchingSearch(**it, search, fn);
+    else
+      (*it)->ForEachVariableMatchingSearch(search, fn);
   }
 }
 
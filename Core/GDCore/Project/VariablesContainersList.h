@@ -9,6 +9,7 @@ class Layout;
 class VariablesContainer;
 class Variable;
 class EventsFunctionsExtension;
+class IdentifiersSearchIndex;
 }  // namespace gd
 
 namespace gd {
@@ -120,8 +121,15 @@ class GD_CORE_API VariablesContainersList {
 
   /**
    * \brief Call the callback for each variable having a name matching the specified search.
+   *
+   * \param index If not null, the index used to find the names matching the
+   * search in the indexed containers.
    */
-  void ForEachVariableMatchingSearch(const gd::String& search, std::function<void(const gd::String& name, const gd::Variable& variable)> fn) const;
+  void ForEachVariableMatchingSearch(
+      const gd::String& search,
+      std::function<void(const gd::String& name, const gd::Variable& variable)>
+          fn,
+      const gd::IdentifiersSearchIndex* index = nullptr) const;
 
   /**
    * \brief Push a new variables container to the context.
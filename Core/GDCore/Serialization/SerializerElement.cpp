@@ -4,7 +4,10 @@
 
 namespace gd {
 
-SerializerElement SerializerElement::nullElement;
+SerializerElement& SerializerElement::GetNullElement() {
+  static thread_local SerializerElement nullElement;
+  return nullElement;
+}
 
 SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
 
@@ -165,12 +168,37 @@ SerializerElement& SerializerElement::AddChild(gd::String name) {
   return *newElement;
 }
 
+void SerializerElement::AddSharedChild(
+    gd::String name, std::shared_ptr<SerializerElement> child) {
+  if (isArray) {
+    if (name != arrayOf) {
+      std::cout << "WARNING: Adding a child, to a SerializerElement which is "
+                   "considered as an array, with a name ("
+                << name << ") which is not the same as the array elements ("
+                << arrayOf << "). Child was renamed." << std::endl;
+      name = arrayOf;
+    }
+  } else {
+    // In case of children of objects, there can be only one child with
+    // a given name.
+    RemoveChild(name);
+  }
+
+  children.push_back(std::make_pair(name, child));
+}
+
 SerializerElement& SerializerElement::GetChild(std::size_t index) const {
+  std::shared_ptr<SerializerElement> child = GetSharedChild(index);
+  return child ? *child : GetNullElement();
+}
+
+std::shared_ptr<SerializerElement> SerializerElement::GetSharedChild(
+    std::size_t index) const {
   if (!isArray) {
     std::cout << "ERROR: Getting a child from its index whereas the parent is "
                  "not considered as an array."
               << std::endl;
-    return nullElement;
+    return nullptr;
   }
 
   std::size_t currentIndex = 0;
@@ -181,7 +209,7 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
         (!deprecatedArrayOf.empty() &&
          children[i].first == deprecatedArrayOf)) {
       if (index == currentIndex)
-        return *children[i].second;
+        return children[i].second;
       else
         currentIndex++;
     }
@@ -189,7 +217,7 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
 
   std::cout << "ERROR: Requested out of bound child at index " << index
             << std::endl;
-  return nullElement;
+  return nullptr;
 }
 
 SerializerElement& SerializerElement::GetChild(
@@ -219,7 +247,7 @@ SerializerElement& SerializerElement::GetChild(
 
   std::cout << "Child " << name << " not found in SerializerElement::GetChild"
             << std::endl;
-  return nullElement;
+  return GetNullElement();
 }
 
 std::size_t SerializerElement::GetChildrenCount(
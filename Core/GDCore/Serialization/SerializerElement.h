@@ -392,6 +392,19 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement &AddChild(gd::String name);
 
+  /**
+   * \brief Add an existing element at the end of the children list with the
+   * given name.
+   *
+   * The element is shared, not copied: it must not be modified while it's
+   * also a child of other elements.
+   *
+   * \param name The name of the new child.
+   * \param child The element to be added.
+   */
+  void AddSharedChild(gd::String name,
+                      std::shared_ptr<SerializerElement> child);
+
   /**
    * \brief Get a child of the element using its name.
    *
@@ -410,6 +423,15 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement &GetChild(std::size_t index) const;
 
+  /**
+   * \brief Get a child of the element using its index (when the element is
+   * considered as an array), to share it instead of copying it.
+   *
+   * \return The child, or nullptr if there is no child at this index.
+   * \see gd::SerializerElement::AddSharedChild
+   */
+  std::shared_ptr<SerializerElement> GetSharedChild(std::size_t index) const;
+
   /**
    * \brief Get the number of children having a specific name.
    *
@@ -447,9 +469,13 @@ class GD_CORE_API SerializerElement {
   };
   ///@}
 
-  static SerializerElement nullElement;
-
  private:
+  /**
+   * Return the element returned when a child is not found. There is one per
+   * thread, as it can be modified (by ConsiderAsArray...) by the caller.
+   */
+  static SerializerElement &GetNullElement();
+
   /**
    * Initialize element using another element. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
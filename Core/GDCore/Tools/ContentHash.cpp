@@ -0,0 +1,113 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ContentHash.h"
+
+#include <cstring>
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerValue.h"
+
+namespace {
+
+// 64-bit FNV-1a.
+const std::uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+const std::uint64_t fnvPrime = 1099511628211ULL;
+
+// Persistent UUIDs identify elements between serializations, they are not
+// part of their content.
+const gd::String persistentUuidName = "persistentUuid";
+
+void HashByte(std::uint64_t& hash, unsigned char byte) {
+  hash ^= byte;
+  hash *= fnvPrime;
+}
+
+void HashUInt64(std::uint64_t& hash, std::uint64_t value) {
+  // Byte by byte, so that the hash doesn't depend on the endianness.
+  for (std::size_t i = 0; i < 8; ++i) {
+    HashByte(hash, static_cast<unsigned char>(value >> (i * 8)));
+  }
+}
+
+void HashString(std::uint64_t& hash, const gd::String& string) {
+  const std::string& bytes = string.Raw();
+  // The size avoids "ab" + "c" and "a" + "bc" having the same hash.
+  HashUInt64(hash, bytes.size());
+  for (char byte : bytes) HashByte(hash, static_cast<unsigned char>(byte));
+}
+
+void HashValue(std::uint64_t& hash, const gd::SerializerValue& value) {
+  if (value.IsBoolean()) {
+    HashByte(hash, 'b');
+    HashByte(hash, value.GetBool() ? 1 : 0);
+  } else if (value.IsInt()) {
+    HashByte(hash, 'i');
+    HashUInt64(hash, static_cast<std::uint64_t>(
+                         static_cast<std::int64_t>(value.GetInt())));
+  } else if (value.IsDouble()) {
+    HashByte(hash, 'd');
+    double number = value.GetDouble();
+    std::uint64_t bits;
+    std::memcpy(&bits, &number, sizeof(bits));
+    HashUInt64(hash, bits);
+  } else {
+    HashByte(hash, 's');
+    HashString(hash, value.GetRawString());
+  }
+}
+
+void HashElement(std::uint64_t& hash, const gd::SerializerElement& element) {
+  if (!element.IsValueUndefined()) {
+    HashByte(hash, 'v');
+    HashValue(hash, element.GetValue());
+  }
+
+  const auto& attributes = element.GetAllAttributes();
+  HashByte(hash, 'a');
+  for (const auto& attribute : attributes) {
+    if (attribute.first == persistentUuidName) continue;
+
+    HashByte(hash, ',');
+    HashString(hash, attribute.first);
+    HashValue(hash, attribute.second);
+  }
+
+  const auto& children = element.GetAllChildren();
+  HashByte(hash, 'c');
+  for (const auto& child : children) {
+    if (child.first == persistentUuidName) continue;
+
+    HashByte(hash, ',');
+    HashString(hash, child.first);
+    HashElement(hash, *child.second);
+  }
+  HashByte(hash, ';');
+}
+
+}  // namespace
+
+namespace gd {
+
+const std::uint64_t ContentHash::emptyHash = fnvOffsetBasis;
+
+std::uint64_t ContentHash::Of(const gd::SerializerElement& element) {
+  std::uint64_t hash = fnvOffsetBasis;
+  HashElement(hash, element);
+  return hash;
+}
+
+std::uint64_t ContentHash::Of(const gd::String& string) {
+  std::uint64_t hash = fnvOffsetBasis;
+  HashString(hash, string);
+  return hash;
+}
+
+std::uint64_t ContentHash::Combine(std::uint64_t hash, std::uint64_t value) {
+  HashUInt64(hash, value);
+  return hash;
+}
+
+}  // namespace gd
@@ -0,0 +1,57 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Compute 64-bit hashes of the content of project elements, to know
+ * if they changed without comparing their serialization.
+ *
+ * Hashes only depend on the content (not on the memory layout or the
+ * platform), so they are the same from one run to another and can be stored.
+ * Persistent UUIDs are ignored: they identify elements, they don't describe
+ * their content.
+ *
+ * \note This is not a cryptographic hash.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API ContentHash {
+ public:
+  /**
+   * \brief Return the hash of the value, the attributes and the children
+   * (with their names and in their order) of an element.
+   */
+  static std::uint64_t Of(const gd::SerializerElement& element);
+
+  /**
+   * \brief Return the hash of a string.
+   */
+  static std::uint64_t Of(const gd::String& string);
+
+  /**
+   * \brief Return a hash mixing a hash with another value (usually the hash
+   * of a child element). The order of the combinations matters.
+   */
+  static std::uint64_t Combine(std::uint64_t hash, std::uint64_t value);
+
+  /**
+   * \brief The hash from which combinations are started.
+   */
+  static const std::uint64_t emptyHash;
+};
+
+}  // namespace gd
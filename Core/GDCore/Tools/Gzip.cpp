@@ -0,0 +1,530 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Gzip.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+const std::uint16_t lengthBases[29] = {
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const std::uint8_t lengthExtraBits[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                          1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                          4, 4, 4, 4, 5, 5, 5, 5, 0};
+const std::uint16_t distanceBases[30] = {
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145,  8193,  12289, 16385, 24577};
+const std::uint8_t distanceExtraBits[30] = {0, 0, 0,  0,  1,  1,  2,  2,
+                                            3, 3, 4,  4,  5,  5,  6,  6,
+                                            7, 7, 8,  8,  9,  9,  10, 10,
+                                            11, 11, 12, 12, 13, 13};
+
+const std::size_t windowSize = 32768;
+const std::size_t minMatchLength = 3;
+const std::size_t maxMatchLength = 258;
+const std::size_t hashBits = 15;
+const std::size_t maxChainLength = 128;
+const std::size_t maxStoredBlockSize = 65535;
+
+/**
+ * \brief Write bits in the order used by deflate (least significant bit
+ * first).
+ */
+class BitWriter {
+ public:
+  BitWriter(std::string& output_) : output(output_){};
+
+  void WriteBits(std::uint32_t value, int count) {
+    bitBuffer |= value << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+      output.push_back(static_cast<char>(bitBuffer & 0xFF));
+      bitBuffer >>= 8;
+      bitCount -= 8;
+    }
+  }
+
+  /**
+   * \brief Write a Huffman code, which is stored starting from its most
+   * significant bit.
+   */
+  void WriteHuffmanCode(std::uint32_t code, int length) {
+    std::uint32_t reversedCode = 0;
+    for (int i = 0; i < length; ++i) {
+      reversedCode = (reversedCode << 1) | (code & 1);
+      code >>= 1;
+    }
+    WriteBits(reversedCode, length);
+  }
+
+  void Flush() {
+    if (bitCount > 0) output.push_back(static_cast<char>(bitBuffer & 0xFF));
+    bitBuffer = 0;
+    bitCount = 0;
+  }
+
+ private:
+  std::string& output;
+  std::uint32_t bitBuffer = 0;
+  int bitCount = 0;
+};
+
+void WriteFixedLiteralOrLength(BitWriter& writer, std::size_t symbol) {
+  if (symbol <= 143)
+    writer.WriteHuffmanCode(0x30 + symbol, 8);
+  else if (symbol <= 255)
+    writer.WriteHuffmanCode(0x190 + (symbol - 144), 9);
+  else if (symbol <= 279)
+    writer.WriteHuffmanCode(symbol - 256, 7);
+  else
+    writer.WriteHuffmanCode(0xC0 + (symbol - 280), 8);
+}
+
+void WriteMatch(BitWriter& writer, std::size_t length, std::size_t distance) {
+  std::size_t lengthCode = 28;
+  while (lengthBases[lengthCode] > length) lengthCode--;
+  WriteFixedLiteralOrLength(writer, 257 + lengthCode);
+  writer.WriteBits(length - lengthBases[lengthCode],
+                   lengthExtraBits[lengthCode]);
+
+  std::size_t distanceCode = 29;
+  while (distanceBases[distanceCode] > distance) distanceCode--;
+  writer.WriteHuffmanCode(distanceCode, 5);
+  writer.WriteBits(distance - distanceBases[distanceCode],
+                   distanceExtraBits[distanceCode]);
+}
+
+/**
+ * \brief Compress the data in a single deflate block using the fixed Huffman
+ * codes, finding repeated sequences with hash chains.
+ */
+std::string DeflateWithFixedCodes(const std::string& data) {
+  std::string output;
+  output.reserve(data.size() / 2);
+  BitWriter writer(output);
+  writer.WriteBits(1, 1);  // Final block.
+  writer.WriteBits(1, 2);  // Fixed Huffman codes.
+
+  const std::size_t size = data.size();
+  auto byteAt = [&data](std::size_t position) {
+    return static_cast<std::uint32_t>(
+        static_cast<unsigned char>(data[position]));
+  };
+  auto hashAt = [&byteAt](std::size_t position) {
+    return ((byteAt(position) << 10) ^ (byteAt(position + 1) << 5) ^
+            byteAt(position + 2)) &
+           ((1 << hashBits) - 1);
+  };
+
+  // The last position of each hash, and for each position of the window the
+  // previous position with the same hash.
+  std::vector<std::int64_t> head(std::size_t(1) << hashBits, -1);
+  std::vector<std::int64_t> previous(windowSize, -1);
+  auto insertPosition = [&](std::size_t position) {
+    if (position + minMatchLength > size) return;
+    std::uint32_t hash = hashAt(position);
+    previous[position & (windowSize - 1)] = head[hash];
+    head[hash] = position;
+  };
+
+  std::size_t position = 0;
+  while (position < size) {
+    std::size_t bestLength = 0;
+    std::size_t bestDistance = 0;
+    if (position + minMatchLength <= size) {
+      std::size_t maxLength = std::min(maxMatchLength, size - position);
+      std::int64_t candidate = head[hashAt(position)];
+      std::size_t chainLength = 0;
+      while (candidate >= 0 &&
+             position - static_cast<std::size_t>(candidate) <= windowSize &&
+             chainLength++ < maxChainLength) {
+        std::size_t length = 0;
+        while (length < maxLength &&
+               data[candidate + length] == data[position + length])
+          length++;
+
+        if (length > bestLength) {
+          bestLength = length;
+          bestDistance = position - candidate;
+          if (length == maxLength) break;
+        }
+
+        std::int64_t previousCandidate =
+            previous[candidate & (windowSize - 1)];
+        if (previousCandidate >= candidate) break;
+        candidate = previousCandidate;
+      }
+    }
+
+    if (bestLength >= minMatchLength) {
+      WriteMatch(writer, bestLength, bestDistance);
+      for (std::size_t i = 0; i < bestLength; ++i)
+        insertPosition(position + i);
+      position += bestLength;
+    } else {
+      WriteFixedLiteralOrLength(writer, byteAt(position));
+      insertPosition(position);
+      position++;
+    }
+  }
+
+  WriteFixedLiteralOrLength(writer, 256);  // End of block.
+  writer.Flush();
+  return output;
+}
+
+/**
+ * \brief Store the data in uncompressed deflate blocks.
+ */
+std::string DeflateStored(const std::string& data) {
+  std::string output;
+  std::size_t position = 0;
+  do {
+    std::size_t blockSize =
+        std::min(maxStoredBlockSize, data.size() - position);
+    bool isFinal = position + blockSize == data.size();
+    output.push_back(isFinal ? 1 : 0);  // Final flag, then stored block type.
+    output.push_back(static_cast<char>(blockSize & 0xFF));
+    output.push_back(static_cast<char>((blockSize >> 8) & 0xFF));
+    output.push_back(static_cast<char>(~blockSize & 0xFF));
+    output.push_back(static_cast<char>((~blockSize >> 8) & 0xFF));
+    output.append(data, position, blockSize);
+    position += blockSize;
+  } while (position < data.size());
+
+  return output;
+}
+
+/**
+ * \brief Read bits in the order used by deflate (least significant bit
+ * first).
+ */
+class BitReader {
+ public:
+  BitReader(const std::string& input_, std::size_t position_, std::size_t end_)
+      : input(input_), position(position_), end(end_){};
+
+  bool ReadBits(int count, std::uint32_t& value) {
+    while (bitCount < count) {
+      if (position >= end) return false;
+      bitBuffer |= static_cast<std::uint32_t>(
+                       static_cast<unsigned char>(input[position++]))
+                   << bitCount;
+      bitCount += 8;
+    }
+    value = bitBuffer & ((std::uint32_t(1) << count) - 1);
+    bitBuffer >>= count;
+    bitCount -= count;
+    return true;
+  }
+
+  /**
+   * \brief Skip the remaining bits of the current byte.
+   */
+  void AlignToByte() {
+    bitBuffer = 0;
+    bitCount = 0;
+  }
+
+  bool ReadBytes(std::size_t count, std::string& output) {
+    if (count > end - position) return false;
+    output.append(input, position, count);
+    position += count;
+    return true;
+  }
+
+ private:
+  const std::string& input;
+  std::size_t position;
+  std::size_t end;
+  std::uint32_t bitBuffer = 0;
+  int bitCount = 0;
+};
+
+/**
+ * \brief A canonical Huffman code, decoded one bit at a time.
+ */
+class HuffmanCode {
+ public:
+  /**
+   * \brief Build the code from the length of the code of each symbol.
+   *
+   * \return false if the lengths are over-subscribed.
+   */
+  bool Build(const std::uint8_t* lengths, std::size_t symbolsCount) {
+    for (auto& count : counts) count = 0;
+    for (std::size_t symbol = 0; symbol < symbolsCount; ++symbol)
+      counts[lengths[symbol]]++;
+
+    int left = 1;
+    for (int length = 1; length <= 15; ++length) {
+      left <<= 1;
+      left -= counts[length];
+      if (left < 0) return false;
+    }
+
+    std::uint16_t offsets[16];
+    offsets[1] = 0;
+    for (int length = 1; length < 15; ++length)
+      offsets[length + 1] = offsets[length] + counts[length];
+    for (std::size_t symbol = 0; symbol < symbolsCount; ++symbol) {
+      if (lengths[symbol] != 0) symbols[offsets[lengths[symbol]]++] = symbol;
+    }
+
+    return true;
+  }
+
+  /**
+   * \return The decoded symbol, or -1 if the input is invalid or truncated.
+   */
+  int Decode(BitReader& reader) const {
+    int code = 0, first = 0, index = 0;
+    for (int length = 1; length <= 15; ++length) {
+      std::uint32_t bit = 0;
+      if (!reader.ReadBits(1, bit)) return -1;
+      code |= bit;
+      int count = counts[length];
+      if (code - count < first) return symbols[index + (code - first)];
+      index += count;
+      first += count;
+      first <<= 1;
+      code <<= 1;
+    }
+    return -1;
+  }
+
+ private:
+  std::uint16_t counts[16];
+  std::uint16_t symbols[288];
+};
+
+bool InflateCodes(BitReader& reader,
+                  const HuffmanCode& literalsAndLengths,
+                  const HuffmanCode& distances,
+                  std::string& output) {
+  while (true) {
+    int symbol = literalsAndLengths.Decode(reader);
+    if (symbol < 0) return false;
+    if (symbol < 256) {
+      output.push_back(static_cast<char>(symbol));
+      continue;
+    }
+    if (symbol == 256) return true;
+
+    symbol -= 257;
+    if (symbol >= 29) return false;
+    std::uint32_t extra = 0;
+    if (!reader.ReadBits(lengthExtraBits[symbol], extra)) return false;
+    std::size_t length = lengthBases[symbol] + extra;
+
+    int distanceSymbol = distances.Decode(reader);
+    if (distanceSymbol < 0 || distanceSymbol >= 30) return false;
+    if (!reader.ReadBits(distanceExtraBits[distanceSymbol], extra))
+      return false;
+    std::size_t distance = distanceBases[distanceSymbol] + extra;
+    if (distance > output.size()) return false;
+
+    std::size_t from = output.size() - distance;
+    for (std::size_t i = 0; i < length; ++i) output.push_back(output[from + i]);
+  }
+}
+
+bool InflateDynamicBlock(BitReader& reader, std::string& output) {
+  static const std::uint8_t codeLengthsOrder[19] = {
+      16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+  std::uint32_t literalsCount = 0, distancesCount = 0, codeLengthsCount = 0;
+  if (!reader.ReadBits(5, literalsCount) ||
+      !reader.ReadBits(5, distancesCount) ||
+      !reader.ReadBits(4, codeLengthsCount))
+    return false;
+  literalsCount += 257;
+  distancesCount += 1;
+  codeLengthsCount += 4;
+  if (literalsCount > 286 || distancesCount > 30) return false;
+
+  std::uint8_t lengths[286 + 30] = {0};
+  for (std::uint32_t i = 0; i < codeLengthsCount; ++i) {
+    std::uint32_t length = 0;
+    if (!reader.ReadBits(3, length)) return false;
+    lengths[codeLengthsOrder[i]] = length;
+  }
+  HuffmanCode codeLengths;
+  if (!codeLengths.Build(lengths, 19)) return false;
+
+  std::uint32_t index = 0;
+  while (index < literalsCount + distancesCount) {
+    int symbol = codeLengths.Decode(reader);
+    if (symbol < 0) return false;
+    if (symbol < 16) {
+      lengths[index++] = symbol;
+      continue;
+    }
+
+    std::uint8_t repeatedLength = 0;
+    std::uint32_t repeatCount = 0;
+    if (symbol == 16) {
+      if (index == 0) return false;
+      repeatedLength = lengths[index - 1];
+      if (!reader.ReadBits(2, repeatCount)) return false;
+      repeatCount += 3;
+    } else if (symbol == 17) {
+      if (!reader.ReadBits(3, repeatCount)) return false;
+      repeatCount += 3;
+    } else {
+      if (!reader.ReadBits(7, repeatCount)) return false;
+      repeatCount += 11;
+    }
+    if (index + repeatCount > literalsCount + distancesCount) return false;
+    while (repeatCount--) lengths[index++] = repeatedLength;
+  }
+  if (lengths[256] == 0) return false;  // The end of block code is required.
+
+  HuffmanCode literalsAndLengths, distances;
+  if (!literalsAndLengths.Build(lengths, literalsCount) ||
+      !distances.Build(lengths + literalsCount, distancesCount))
+    return false;
+
+  return InflateCodes(reader, literalsAndLengths, distances, output);
+}
+
+bool Inflate(BitReader& reader, std::string& output) {
+  HuffmanCode fixedLiteralsAndLengths, fixedDistances;
+  {
+    std::uint8_t lengths[288];
+    for (std::size_t symbol = 0; symbol < 288; ++symbol)
+      lengths[symbol] =
+          symbol < 144 ? 8 : (symbol < 256 ? 9 : (symbol < 280 ? 7 : 8));
+    fixedLiteralsAndLengths.Build(lengths, 288);
+    for (std::size_t symbol = 0; symbol < 30; ++symbol) lengths[symbol] = 5;
+    fixedDistances.Build(lengths, 30);
+  }
+
+  std::uint32_t isFinal = 0;
+  do {
+    std::uint32_t blockType = 0;
+    if (!reader.ReadBits(1, isFinal) || !reader.ReadBits(2, blockType))
+      return false;
+
+    if (blockType == 0) {
+      reader.AlignToByte();
+      std::string sizes;
+      if (!reader.ReadBytes(4, sizes)) return false;
+      std::size_t size = static_cast<unsigned char>(sizes[0]) |
+                         (static_cast<unsigned char>(sizes[1]) << 8);
+      std::size_t sizeComplement = static_cast<unsigned char>(sizes[2]) |
+                                   (static_cast<unsigned char>(sizes[3]) << 8);
+      if (size != (~sizeComplement & 0xFFFF)) return false;
+      if (!reader.ReadBytes(size, output)) return false;
+    } else if (blockType == 1) {
+      if (!InflateCodes(
+              reader, fixedLiteralsAndLengths, fixedDistances, output))
+        return false;
+    } else if (blockType == 2) {
+      if (!InflateDynamicBlock(reader, output)) return false;
+    } else {
+      return false;
+    }
+  } while (!isFinal);
+
+  return true;
+}
+
+void WriteUInt32(std::string& output, std::uint32_t value) {
+  for (int i = 0; i < 4; ++i)
+    output.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+std::uint32_t ReadUInt32(const std::string& input, std::size_t position) {
+  std::uint32_t value = 0;
+  for (int i = 0; i < 4; ++i)
+    value |= static_cast<std::uint32_t>(
+                 static_cast<unsigned char>(input[position + i]))
+             << (8 * i);
+  return value;
+}
+
+}  // namespace
+
+namespace gd {
+
+std::uint32_t Gzip::Crc32(const std::string& data) {
+  static const std::vector<std::uint32_t> table = []() {
+    std::vector<std::uint32_t> table(256);
+    for (std::uint32_t i = 0; i < 256; ++i) {
+      std::uint32_t value = i;
+      for (int bit = 0; bit < 8; ++bit)
+        value = (value & 1) ? (0xEDB88320 ^ (value >> 1)) : (value >> 1);
+      table[i] = value;
+    }
+    return table;
+  }();
+
+  std::uint32_t crc = 0xFFFFFFFF;
+  for (char byte : data)
+    crc = table[(crc ^ static_cast<unsigned char>(byte)) & 0xFF] ^ (crc >> 8);
+  return crc ^ 0xFFFFFFFF;
+}
+
+std::string Gzip::Compress(const std::string& data) {
+  // Header: magic, deflate method, no flags, no modification time, no extra
+  // flags, unknown operating system.
+  std::string output("\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\xff", 10);
+
+  std::string compressedData = DeflateWithFixedCodes(data);
+  std::size_t storedSize =
+      data.size() + 5 * (data.size() / maxStoredBlockSize + 1);
+  if (compressedData.size() > storedSize) compressedData = DeflateStored(data);
+  output.append(compressedData);
+
+  WriteUInt32(output, Crc32(data));
+  WriteUInt32(output, static_cast<std::uint32_t>(data.size()));
+  return output;
+}
+
+bool Gzip::Decompress(const std::string& compressedData, std::string& data) {
+  data.clear();
+  const std::string& input = compressedData;
+  const std::size_t trailerSize = 8;
+  if (input.size() < 10 + trailerSize || input[0] != '\x1f' ||
+      input[1] != '\x8b' || input[2] != '\x08')
+    return false;
+
+  const std::uint8_t flags = input[3];
+  const std::size_t end = input.size() - trailerSize;
+  std::size_t position = 10;
+  if (flags & 0x04) {  // Extra field.
+    if (position + 2 > end) return false;
+    position += 2 + (static_cast<unsigned char>(input[position]) |
+                     (static_cast<unsigned char>(input[position + 1]) << 8));
+  }
+  for (std::uint8_t zeroTerminatedField : {0x08, 0x10}) {  // Name, comment.
+    if (!(flags & zeroTerminatedField)) continue;
+    while (position < end && input[position] != '\0') position++;
+    position++;
+  }
+  if (flags & 0x02) position += 2;  // Header CRC.
+  if (position > end) return false;
+
+  BitReader reader(input, position, end);
+  if (!Inflate(reader, data)) {
+    data.clear();
+    return false;
+  }
+
+  if (ReadUInt32(input, end) != Crc32(data) ||
+      ReadUInt32(input, end + 4) != static_cast<std::uint32_t>(data.size())) {
+    data.clear();
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace gd
@@ -0,0 +1,49 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace gd {
+
+/**
+ * \brief Tool class to compress and decompress data in the gzip format
+ * (RFC 1952), without any external library.
+ *
+ * Compression uses LZ77 with the fixed Huffman codes of deflate (RFC 1951),
+ * which is efficient for text like JSON or JavaScript. Decompression
+ * supports any deflate stream (stored, fixed or dynamic Huffman blocks).
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API Gzip {
+ public:
+  /**
+   * \brief Compress the data and return it in the gzip format.
+   */
+  static std::string Compress(const std::string& data);
+
+  /**
+   * \brief Decompress data in the gzip format.
+   *
+   * \return false if the data is invalid, truncated or corrupted.
+   */
+  static bool Decompress(const std::string& compressedData,
+                         std::string& data);
+
+  /**
+   * \brief Return the CRC-32 of the data, as used by gzip.
+   */
+  static std::uint32_t Crc32(const std::string& data);
+
+ private:
+  Gzip(){};
+  virtual ~Gzip(){};
+};
+
+}  // namespace gd
@@ -0,0 +1,196 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief The part of gd::NameIndex not depending on the type of the elements.
+ *
+ * \see gd::NameIndex
+ */
+class NameIndexBase {
+ public:
+  /**
+   * \brief Mark the index as outdated, so that it's rebuilt before being used
+   * again.
+   */
+  void Invalidate() const { outdated.store(true, std::memory_order_release); }
+
+ protected:
+  NameIndexBase() {}
+  NameIndexBase(const NameIndexBase& other)
+      : outdated(other.outdated.load(std::memory_order_acquire)) {}
+  NameIndexBase& operator=(const NameIndexBase& other) {
+    outdated.store(other.outdated.load(std::memory_order_acquire),
+                   std::memory_order_release);
+    return *this;
+  }
+
+  mutable std::atomic<bool> outdated{false};  ///< True when an element was
+                                              ///< renamed since the index was
+                                              ///< built.
+  mutable std::mutex rebuildMutex;  ///< Protects the rebuild done by lookups
+                                    ///< of an outdated index.
+};
+
+/**
+ * \brief Stored by the elements that can be indexed in a gd::NameIndex, so
+ * that they tell the index when they are renamed.
+ *
+ * A copy of an element is not part of any index: the link is not copied.
+ * Assigning another element to an element changes its name, so the index of
+ * the element is invalidated.
+ */
+class NameIndexLink {
+ public:
+  NameIndexLink() {}
+  NameIndexLink(const NameIndexLink&) {}
+  NameIndexLink& operator=(const NameIndexLink&) {
+    NotifyRenamed();
+    return *this;
+  }
+
+  /**
+   * \brief To be called by the element when its name changed.
+   */
+  void NotifyRenamed() const {
+    if (index) index->Invalidate();
+  }
+
+ private:
+  template <typename T>
+  friend class NameIndex;
+
+  const NameIndexBase* index = nullptr;
+};
+
+/**
+ * \brief An index of the positions of elements, stored in a vector of
+ * `std::unique_ptr`, by their names.
+ *
+ * The type T is supposed to have a method `GetName`, returning the `gd::String`
+ * representing the name of the element, and a gd::NameIndexLink member called
+ * `nameIndexLink` (accessible by gd::NameIndex), notified when the element is
+ * renamed.
+ *
+ * The owner of the vector must tell the index when elements are inserted,
+ * removed or moved. Elements tell the index when they are renamed: the index
+ * is then rebuilt once, when it's used again.
+ *
+ * \note Searching can be done by several threads at the same time, as long as
+ * no element is renamed meanwhile.
+ *
+ * \ingroup Tools
+ */
+template <typename T>
+class NameIndex : public NameIndexBase {
+ public:
+  typedef std::vector<std::unique_ptr<T>> Elements;
+
+  NameIndex() {}
+  NameIndex(const NameIndex<T>& other)
+      : NameIndexBase(other), positionsByName(other.positionsByName) {}
+  NameIndex<T>& operator=(const NameIndex<T>& other) {
+    if (this != &other) {
+      NameIndexBase::operator=(other);
+      positionsByName = other.positionsByName;
+    }
+    return *this;
+  }
+
+  /**
+   * \brief Return the position of the element with the given name, or
+   * gd::String::npos if there is no such element.
+   */
+  std::size_t Find(const Elements& elements, const gd::String& name) const {
+    if (outdated.load(std::memory_order_acquire)) RebuildIfOutdated(elements);
+
+    auto it = positionsByName.find(name);
+    if (it == positionsByName.end() || it->second >= elements.size() ||
+        elements[it->second]->GetName() != name)
+      return gd::String::npos;
+
+    return it->second;
+  }
+
+  /**
+   * \brief Index again all the elements.
+   */
+  void Rebuild(const Elements& elements) {
+    Reindex(elements);
+    outdated.store(false, std::memory_order_release);
+  }
+
+  /**
+   * \brief Update the index after the elements from position \a from to
+   * position \a to (included) were inserted or moved.
+   */
+  void Update(const Elements& elements,
+              std::size_t from,
+              std::size_t to = gd::String::npos) {
+    for (std::size_t i = from; i <= to && i < elements.size(); ++i) {
+      elements[i]->nameIndexLink.index = this;
+      auto result = positionsByName.emplace(elements[i]->GetName(), i);
+      if (result.second) continue;
+
+      // Keep the first element when names are duplicated.
+      std::size_t indexedPosition = result.first->second;
+      if (indexedPosition >= i || indexedPosition >= elements.size() ||
+          elements[indexedPosition]->GetName() != elements[i]->GetName())
+        result.first->second = i;
+    }
+  }
+
+  /**
+   * \brief Remove the element with the given name from the index. The
+   * following elements must then be updated.
+   */
+  void Remove(const gd::String& name) { positionsByName.erase(name); }
+
+  /**
+   * \brief Clear the index, when all the elements are removed.
+   */
+  void Clear() {
+    positionsByName.clear();
+    outdated.store(false, std::memory_order_release);
+  }
+
+ private:
+  void RebuildIfOutdated(const Elements& elements) const {
+    // Other threads searching at the same time wait for the index to be
+    // rebuilt.
+    std::lock_guard<std::mutex> lock(rebuildMutex);
+    if (!outdated.load(std::memory_order_acquire)) return;
+
+    Reindex(elements);
+    outdated.store(false, std::memory_order_release);
+  }
+
+  void Reindex(const Elements& elements) const {
+    positionsByName.clear();
+    positionsByName.reserve(elements.size());
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+      elements[i]->nameIndexLink.index = this;
+      positionsByName.emplace(elements[i]->GetName(), i);
+    }
+  }
+
+  mutable std::unordered_map<gd::String, std::size_t>
+      positionsByName;  ///< Rebuilt by the lookups of an outdated index,
+                        ///< while holding rebuildMutex.
+};
+
+}  // namespace gd
@@ -0,0 +1,46 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ParallelTasks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace gd {
+
+void ParallelTasks::Run(const std::vector<std::function<void()>>& tasks,
+                        std::size_t threadsCount) {
+#if !defined(EMSCRIPTEN)
+  threadsCount = std::min(threadsCount, tasks.size());
+  if (threadsCount > 1) {
+    std::atomic<std::size_t> nextTaskIndex(0);
+    auto runTasks = [&tasks, &nextTaskIndex]() {
+      for (std::size_t i = nextTaskIndex++; i < tasks.size();
+           i = nextTaskIndex++)
+        tasks[i]();
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < threadsCount; ++i)
+      threads.emplace_back(runTasks);
+    runTasks();
+    for (auto& thread : threads) thread.join();
+    return;
+  }
+#endif
+
+  for (const auto& task : tasks) task();
+}
+
+std::size_t ParallelTasks::GetHardwareThreadsCount() {
+#if !defined(EMSCRIPTEN)
+  return std::max(1u, std::thread::hardware_concurrency());
+#else
+  return 1;
+#endif
+}
+
+}  // namespace gd
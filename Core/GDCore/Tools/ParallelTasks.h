@@ -0,0 +1,40 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief Run independent tasks on several threads.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API ParallelTasks {
+ public:
+  /**
+   * \brief Run the tasks, spread on the given number of threads (including
+   * the calling thread) when threads are available.
+   *
+   * Tasks are started in order, each one by the first thread that is free.
+   * When threads are not available (like in the browser), tasks are run one
+   * after the other on the calling thread.
+   */
+  static void Run(const std::vector<std::function<void()>>& tasks,
+                  std::size_t threadsCount);
+
+  /**
+   * \brief Return the number of threads that can run at the same time on
+   * this machine (at least 1).
+   */
+  static std::size_t GetHardwareThreadsCount();
+};
+
+}  // namespace gd
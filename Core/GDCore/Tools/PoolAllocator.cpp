@@ -0,0 +1,179 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/PoolAllocator.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace {
+
+const std::size_t blockAlignment = 16;
+const std::size_t sizeClassesCount = 32;  // Blocks up to 512 bytes.
+const std::size_t chunkSize = 64 * 1024;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+/**
+ * \brief A chunk of memory carved into blocks of the same size.
+ */
+struct Chunk {
+  char* start = nullptr;
+  char* position = nullptr;  ///< The first block never allocated.
+  FreeBlock* freeBlocks = nullptr;
+  std::size_t allocatedBlocksCount = 0;
+  std::size_t availableChunksIndex = 0;  ///< Position in availableChunks, if
+                                         ///< the chunk has free blocks.
+  bool isAvailable = false;
+};
+
+/**
+ * \brief The blocks of a given size, carved out of chunks.
+ */
+struct SizeClass {
+  std::mutex mutex;
+  std::map<char*, Chunk> chunks;  ///< Chunks, by their start addresses.
+  std::vector<Chunk*> availableChunks;  ///< Chunks having free blocks.
+};
+
+struct Pool {
+  SizeClass sizeClasses[sizeClassesCount];
+  std::atomic<std::size_t> reservedBytesCount{0};
+  std::atomic<std::size_t> allocatedBlocksCount{0};
+};
+
+Pool& GetPool() {
+  // Never destroyed, so that elements freed during static destructions can
+  // still be given back to the pool.
+  static Pool* pool = new Pool;
+  return *pool;
+}
+
+std::size_t GetSizeClassIndex(std::size_t size) {
+  return size == 0 ? 0 : (size - 1) / blockAlignment;
+}
+
+bool HasFreeBlock(const Chunk& chunk, std::size_t blockSize) {
+  return chunk.freeBlocks ||
+         static_cast<std::size_t>(chunk.start + chunkSize - chunk.position) >=
+             blockSize;
+}
+
+void MakeAvailable(SizeClass& sizeClass, Chunk& chunk) {
+  if (chunk.isAvailable) return;
+
+  chunk.isAvailable = true;
+  chunk.availableChunksIndex = sizeClass.availableChunks.size();
+  sizeClass.availableChunks.push_back(&chunk);
+}
+
+void MakeUnavailable(SizeClass& sizeClass, Chunk& chunk) {
+  if (!chunk.isAvailable) return;
+
+  // Move the last available chunk in place of this one.
+  Chunk* lastChunk = sizeClass.availableChunks.back();
+  sizeClass.availableChunks[chunk.availableChunksIndex] = lastChunk;
+  lastChunk->availableChunksIndex = chunk.availableChunksIndex;
+  sizeClass.availableChunks.pop_back();
+  chunk.isAvailable = false;
+}
+
+}  // namespace
+
+namespace gd {
+
+void* MemoryPool::Allocate(std::size_t size) {
+  std::size_t index = GetSizeClassIndex(size);
+  if (index >= sizeClassesCount) return ::operator new(size);
+
+  Pool& pool = GetPool();
+  SizeClass& sizeClass = pool.sizeClasses[index];
+  std::size_t blockSize = (index + 1) * blockAlignment;
+  void* block = nullptr;
+  bool newChunk = false;
+  {
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    if (sizeClass.availableChunks.empty()) {
+      char* start = static_cast<char*>(::operator new(chunkSize));
+      Chunk& chunk = sizeClass.chunks[start];
+      chunk.start = start;
+      chunk.position = start;
+      MakeAvailable(sizeClass, chunk);
+      newChunk = true;
+    }
+
+    // The last available chunk is used first, so that blocks allocated one
+    // after the other are contiguous.
+    Chunk& chunk = *sizeClass.availableChunks.back();
+    if (chunk.freeBlocks) {
+      block = chunk.freeBlocks;
+      chunk.freeBlocks = chunk.freeBlocks->next;
+    } else {
+      block = chunk.position;
+      chunk.position += blockSize;
+    }
+    chunk.allocatedBlocksCount++;
+    if (!HasFreeBlock(chunk, blockSize)) MakeUnavailable(sizeClass, chunk);
+  }
+
+  if (newChunk) pool.reservedBytesCount += chunkSize;
+  pool.allocatedBlocksCount++;
+  return block;
+}
+
+void MemoryPool::Deallocate(void* pointer, std::size_t size) {
+  if (!pointer) return;
+
+  std::size_t index = GetSizeClassIndex(size);
+  if (index >= sizeClassesCount) {
+    ::operator delete(pointer);
+    return;
+  }
+
+  Pool& pool = GetPool();
+  SizeClass& sizeClass = pool.sizeClasses[index];
+  bool releasedChunk = false;
+  {
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    auto it = sizeClass.chunks.upper_bound(static_cast<char*>(pointer));
+    --it;
+    Chunk& chunk = it->second;
+
+    FreeBlock* block = static_cast<FreeBlock*>(pointer);
+    block->next = chunk.freeBlocks;
+    chunk.freeBlocks = block;
+    chunk.allocatedBlocksCount--;
+
+    MakeAvailable(sizeClass, chunk);
+
+    // An empty chunk is given back to the system, unless it's the only chunk
+    // with free blocks: it's kept for the next allocations.
+    if (chunk.allocatedBlocksCount == 0 &&
+        sizeClass.availableChunks.size() > 1) {
+      MakeUnavailable(sizeClass, chunk);
+      ::operator delete(chunk.start);
+      sizeClass.chunks.erase(it);
+      releasedChunk = true;
+    }
+  }
+
+  if (releasedChunk) pool.reservedBytesCount -= chunkSize;
+  pool.allocatedBlocksCount--;
+}
+
+std::size_t MemoryPool::GetReservedBytesCount() {
+  return GetPool().reservedBytesCount;
+}
+
+std::size_t MemoryPool::GetAllocatedBlocksCount() {
+  return GetPool().allocatedBlocksCount;
+}
+
+}  // namespace gd
@@ -0,0 +1,89 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief A process-wide pool of small memory blocks, used for elements
+ * allocated by the thousands, like instructions.
+ *
+ * Blocks are grouped by size class and carved out of large chunks, so that
+ * elements allocated one after the other (like the instructions of an events
+ * list being loaded) are contiguous in memory, which makes traversing them
+ * more cache friendly. Freed blocks are reused by the next allocations of the
+ * same size class. A chunk is given back to the system as soon as all its
+ * blocks are freed (for example when a project is closed), unless it's the
+ * only chunk of its size class with free blocks.
+ *
+ * Allocating and freeing blocks is thread-safe.
+ *
+ * \see gd::PoolAllocator
+ * \ingroup Tools
+ */
+class GD_CORE_API MemoryPool {
+ public:
+  /**
+   * \brief Allocate a block of at least the given size. Blocks larger than
+   * the biggest size class are allocated with operator new.
+   */
+  static void* Allocate(std::size_t size);
+
+  /**
+   * \brief Free a block, which must have been allocated with the same size.
+   */
+  static void Deallocate(void* pointer, std::size_t size);
+
+  /**
+   * \brief Return the number of bytes reserved by the chunks of the pool.
+   */
+  static std::size_t GetReservedBytesCount();
+
+  /**
+   * \brief Return the number of blocks currently allocated from the pool.
+   */
+  static std::size_t GetAllocatedBlocksCount();
+};
+
+/**
+ * \brief A standard allocator using gd::MemoryPool, to be used with
+ * `std::allocate_shared` so that the element and its reference counts are
+ * stored in a single pooled block.
+ *
+ * \ingroup Tools
+ */
+template <typename T>
+class PoolAllocator {
+ public:
+  typedef T value_type;
+
+  PoolAllocator() {}
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>&) {}
+
+  T* allocate(std::size_t count) {
+    return static_cast<T*>(gd::MemoryPool::Allocate(count * sizeof(T)));
+  }
+
+  void deallocate(T* pointer, std::size_t count) {
+    gd::MemoryPool::Deallocate(pointer, count * sizeof(T));
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+  return false;
+}
+
+}  // namespace gd
@@ -33,7 +33,20 @@ void SPtrList<T>::Insert(const SPtrList<T>& otherElements,
 
 template <typename T>
 T& SPtrList<T>::Insert(const T& evt, size_t position) {
-  std::shared_ptr<T> element = std::make_shared<T>(evt);
+  std::shared_ptr<T> element =
+      std::allocate_shared<T>(gd::PoolAllocator<T>(), evt);
+  if (position < elements.size())
+    elements.insert(elements.begin() + position, element);
+  else
+    elements.push_back(element);
+
+  return *element;
+}
+
+template <typename T>
+T& SPtrList<T>::Insert(T&& evt, size_t position) {
+  std::shared_ptr<T> element =
+      std::allocate_shared<T>(gd::PoolAllocator<T>(), std::move(evt));
   if (position < elements.size())
     elements.insert(elements.begin() + position, element);
   else
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class Project;
 class SerializerElement;
@@ -28,6 +29,10 @@ namespace gd {
  * \note *Invalidation*: Elements can be re-ordered without invalidating them.
  * Insertion/removal does not invalidate other elements. Remove/Clear delete
  * elements from memory.
+ *
+ * \note Elements are indexed by name (see gd::NameIndex). They can still be
+ * renamed directly or changed with GetInternalVector: the index is checked and
+ * rebuilt if needed when searching for an element.
  */
 template <typename T>
 class SerializableWithNameList {
@@ -115,7 +120,10 @@ class SerializableWithNameList {
   /**
    * \brief Clear the list of elements, destroying all of them.
    */
-  void Clear() { return elements.clear(); };
+  void Clear() {
+    elements.clear();
+    namesIndex.Clear();
+  };
 
   /**
    * \brief Move element at position `oldIndex` to position `newIndex`.
@@ -212,6 +220,7 @@ class SerializableWithNameList {
 
  protected:
   std::vector<std::unique_ptr<T>> elements;
+  gd::NameIndex<T> namesIndex;
 
   /**
    * Initialize from another list of elements, copying elements. Used by
@@ -24,6 +24,8 @@ void SerializableWithNameList<T>::Insert(
   if (end < begin) return;
   if (end >= otherElements.size()) end = otherElements.size() - 1;
 
+  std::size_t firstInsertedPosition =
+      position < elements.size() ? position : elements.size();
   for (std::size_t insertPos = 0; insertPos <= (end - begin); insertPos++) {
     if (position != (size_t)-1 && position + insertPos < elements.size())
       elements.insert(elements.begin() + position + insertPos,
@@ -31,73 +33,59 @@ void SerializableWithNameList<T>::Insert(
     else
       elements.push_back(gd::Clone(otherElements.elements[begin + insertPos]));
   }
+  namesIndex.Update(elements, firstInsertedPosition);
 }
 
 template <typename T>
 T& SerializableWithNameList<T>::Insert(const T& element, size_t position) {
-  T& newElement = *(*(elements.insert(
-      position < elements.size() ? elements.begin() + position : elements.end(),
-      std::unique_ptr<T>(new T(element)))));
+  if (position > elements.size()) position = elements.size();
+  T& newElement = *(*(elements.insert(elements.begin() + position,
+                                      std::unique_ptr<T>(new T(element)))));
 
+  namesIndex.Update(elements, position);
   return newElement;
 }
 
 template <typename T>
 T& SerializableWithNameList<T>::InsertNew(const gd::String& name,
                                           std::size_t position) {
-  T& newElement = *(*(elements.insert(
-      position < elements.size() ? elements.begin() + position : elements.end(),
-      std::unique_ptr<T>(new T()))));
+  if (position > elements.size()) position = elements.size();
+  T& newElement = *(*(
+      elements.insert(elements.begin() + position, std::unique_ptr<T>(new T()))));
 
   newElement.SetName(name);
+  namesIndex.Update(elements, position);
   return newElement;
 }
 
 template <typename T>
 void SerializableWithNameList<T>::Remove(size_t index) {
+  namesIndex.Remove(elements[index]->GetName());
   elements.erase(elements.begin() + index);
+  namesIndex.Update(elements, index);
 }
 
 template <typename T>
 void SerializableWithNameList<T>::Remove(const gd::String& name) {
-  typename std::vector<std::unique_ptr<T>>::iterator object =
-      find_if(elements.begin(),
-              elements.end(),
-              [&name](const std::unique_ptr<T>& function) {
-                return function->GetName() == name;
-              });
-  if (object == elements.end()) return;
+  std::size_t index = namesIndex.Find(elements, name);
+  if (index == gd::String::npos) return;
 
-  elements.erase(object);
+  Remove(index);
 }
 
 template <typename T>
 T& SerializableWithNameList<T>::Get(const gd::String& name) {
-  return *(
-      *find_if(elements.begin(),
-               elements.end(),
-               [&name](const std::unique_ptr<T>& function) {
-                 return function->GetName() == name;
-               }));
+  return *elements[namesIndex.Find(elements, name)];
 }
 
 template <typename T>
 const T& SerializableWithNameList<T>::Get(const gd::String& name) const {
-  return *(
-      *find_if(elements.begin(),
-               elements.end(),
-               [&name](const std::unique_ptr<T>& function) {
-                 return function->GetName() == name;
-               }));
+  return *elements[namesIndex.Find(elements, name)];
 }
 
 template <typename T>
 bool SerializableWithNameList<T>::Has(const gd::String& name) const {
-  return find_if(elements.begin(),
-                 elements.end(),
-                 [&name](const std::unique_ptr<T>& function) {
-                   return function->GetName() == name;
-                 }) != elements.end();
+  return namesIndex.Find(elements, name) != gd::String::npos;
 }
 
 template <typename T>
@@ -108,10 +96,17 @@ void SerializableWithNameList<T>::Move(std::size_t oldIndex,
   std::unique_ptr<T> object = std::move(elements[oldIndex]);
   elements.erase(elements.begin() + oldIndex);
   elements.insert(elements.begin() + newIndex, std::move(object));
+  namesIndex.Update(
+      elements, std::min(oldIndex, newIndex), std::max(oldIndex, newIndex));
 }
 
 template <typename T>
 std::size_t SerializableWithNameList<T>::GetPosition(const T& element) const {
+  std::size_t namedPosition = namesIndex.Find(elements, element.GetName());
+  if (namedPosition != gd::String::npos &&
+      elements[namedPosition].get() == &element)
+    return namedPosition;
+
   for(std::size_t index = 0;index<elements.size();++index) {
     if (&element == elements[index].get()) return index;
   }
@@ -146,6 +141,7 @@ void SerializableWithNameList<T>::ProgressivelyUnserializeElementsFrom(
   while (elements.size() > serializerElement.GetChildrenCount()) {
     elements.pop_back();
   }
+  namesIndex.Rebuild(elements);
 }
 
 template <typename T>
@@ -159,6 +155,7 @@ void SerializableWithNameList<T>::UnserializeElementsFrom(
     T& newElement = InsertNew("", GetCount());
     newElement.UnserializeFrom(project, serializerElement.GetChild(i));
   }
+  namesIndex.Rebuild(elements);
 }
 
 template <typename T>
@@ -170,6 +167,7 @@ void SerializableWithNameList<T>::UnserializeElementsFrom(
     T& newElement = InsertNew("", GetCount());
     newElement.UnserializeFrom(serializerElement.GetChild(i));
   }
+  namesIndex.Rebuild(elements);
 }
 
 template <typename T>
@@ -190,6 +188,7 @@ template <typename T>
 void SerializableWithNameList<T>::Init(
     const gd::SerializableWithNameList<T>& other) {
   elements = gd::Clone(other.elements);
+  namesIndex.Rebuild(elements);
 }
 
 }  // namespace gd
@@ -0,0 +1,91 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/StringAtom.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace gd {
+
+/**
+ * \brief The process-wide table of interned strings.
+ */
+class StringAtomTable {
+ public:
+  static StringAtomTable& Get() {
+    // Never destroyed, so that atoms stay valid during static destructions.
+    static StringAtomTable* table = new StringAtomTable;
+    return *table;
+  }
+
+  const StringAtom::Entry* Intern(const gd::String& string) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entriesByString.find(&string);
+    if (it != entriesByString.end()) return it->second;
+
+    // A deque never moves its elements, so entries can be pointed to.
+    entries.push_back({string, static_cast<std::uint32_t>(entries.size())});
+    const StringAtom::Entry* entry = &entries.back();
+    entriesByString[&entry->string] = entry;
+    return entry;
+  }
+
+  const StringAtom::Entry* Find(const gd::String& string) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entriesByString.find(&string);
+    return it != entriesByString.end() ? it->second : emptyStringEntry;
+  }
+
+  const StringAtom::Entry* GetEmptyStringEntry() const {
+    return emptyStringEntry;
+  }
+
+  std::size_t GetEntriesCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+  }
+
+ private:
+  struct StringPointerHash {
+    std::size_t operator()(const gd::String* string) const {
+      return std::hash<gd::String>()(*string);
+    }
+  };
+  struct StringPointerEqual {
+    bool operator()(const gd::String* a, const gd::String* b) const {
+      return *a == *b;
+    }
+  };
+
+  StringAtomTable() { emptyStringEntry = Intern(""); }
+
+  std::mutex mutex;
+  std::deque<StringAtom::Entry> entries;
+  std::unordered_map<const gd::String*,
+                     const StringAtom::Entry*,
+                     StringPointerHash,
+                     StringPointerEqual>
+      entriesByString;
+  const StringAtom::Entry* emptyStringEntry;
+};
+
+StringAtom::StringAtom()
+    : entry(StringAtomTable::Get().GetEmptyStringEntry()) {}
+
+StringAtom::StringAtom(const gd::String& string)
+    : entry(string.empty() ? StringAtomTable::Get().GetEmptyStringEntry()
+                           : StringAtomTable::Get().Intern(string)) {}
+
+StringAtom StringAtom::FindExisting(const gd::String& string) {
+  return StringAtom(StringAtomTable::Get().Find(string));
+}
+
+std::size_t StringAtom::GetInternedStringsCount() {
+  return StringAtomTable::Get().GetEntriesCount();
+}
+
+}  // namespace gd
@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An interned string, used for the types defined by the platform and
+ * repeated many times in a project (instruction types, object types...).
+ *
+ * Each distinct string is stored once in a process-wide table and never freed.
+ * An atom is a pointer to this unique copy: it's cheap to copy, and comparing
+ * or hashing atoms is done in constant time, without comparing the strings.
+ * Each atom also has a stable 32-bit identifier.
+ *
+ * Interning a string is thread-safe. Reading an atom doesn't need any lock.
+ *
+ * \note As strings are never freed, don't intern names chosen by users (like
+ * object or layer names): they would leak each time they are renamed. To
+ * search for such a string, use FindExisting, which never interns it.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API StringAtom {
+ public:
+  /**
+   * \brief Construct the atom of the empty string.
+   */
+  StringAtom();
+
+  /**
+   * \brief Construct the atom of the given string, interning it if needed.
+   */
+  StringAtom(const gd::String& string);
+
+  /**
+   * \brief Return the interned string. The reference stays valid until the
+   * end of the process.
+   */
+  const gd::String& GetString() const { return entry->string; }
+
+  /**
+   * \brief Return the identifier of the atom, which is unique among the atoms
+   * of the process.
+   *
+   * \note Identifiers depend on the order strings were interned: they must not
+   * be persisted.
+   */
+  std::uint32_t GetId() const { return entry->id; }
+
+  bool empty() const { return entry->string.empty(); }
+
+  bool operator==(const StringAtom& other) const {
+    return entry == other.entry;
+  }
+  bool operator!=(const StringAtom& other) const {
+    return entry != other.entry;
+  }
+  bool operator==(const gd::String& string) const {
+    return entry->string == string;
+  }
+  bool operator!=(const gd::String& string) const {
+    return entry->string != string;
+  }
+
+  /**
+   * \brief Order atoms by their identifiers (not alphabetically), to use
+   * them as keys of ordered containers.
+   */
+  bool operator<(const StringAtom& other) const {
+    return entry->id < other.entry->id;
+  }
+
+  /**
+   * \brief Return the atom of the given string if it was already interned, or
+   * the atom of the empty string otherwise. The string is not interned.
+   */
+  static StringAtom FindExisting(const gd::String& string);
+
+  /**
+   * \brief Return the number of strings interned in the process.
+   */
+  static std::size_t GetInternedStringsCount();
+
+ private:
+  struct Entry {
+    gd::String string;
+    std::uint32_t id;
+  };
+  friend class StringAtomTable;
+
+  StringAtom(const Entry* entry_) : entry(entry_) {}
+
+  const Entry* entry;
+};
+
+}  // namespace gd
+
+namespace std {
+/**
+ * std::hash specialization for gd::StringAtom
+ */
+template <>
+struct hash<gd::StringAtom> {
+  size_t operator()(const gd::StringAtom& atom) const {
+    return hash<std::uint32_t>()(atom.GetId());
+  }
+};
+}  // namespace std
@@ -0,0 +1,260 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the content hashes of project elements.
+ */
+#include "GDCore/Tools/ContentHash.h"
+
+#include <vector>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::StandardEvent &InsertAction(gd::EventsList &events,
+                                const gd::String &parameter) {
+  gd::StandardEvent standardEvent;
+  standardEvent.SetType("BuiltinCommonInstructions::Standard");
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomething");
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, parameter);
+  standardEvent.GetActions().Insert(instruction);
+  return dynamic_cast<gd::StandardEvent &>(
+      events.InsertEvent(standardEvent));
+}
+
+}  // namespace
+
+TEST_CASE("ContentHash", "[common]") {
+  SECTION("Serializer elements") {
+    gd::SerializerElement element;
+    element.SetAttribute("name", "MyElement");
+    element.AddChild("child").SetIntValue(1);
+
+    gd::SerializerElement sameElement;
+    sameElement.SetAttribute("name", "MyElement");
+    sameElement.AddChild("child").SetIntValue(1);
+    REQUIRE(gd::ContentHash::Of(element) == gd::ContentHash::Of(sameElement));
+
+    // Values of different types are different.
+    gd::SerializerElement otherElement;
+    otherElement.SetAttribute("name", "MyElement");
+    otherElement.AddChild("child").SetStringValue("1");
+    REQUIRE(gd::ContentHash::Of(element) !=
+            gd::ContentHash::Of(otherElement));
+
+    // Persistent UUIDs are ignored.
+    sameElement.SetAttribute("persistentUuid", "1234");
+    REQUIRE(gd::ContentHash::Of(element) == gd::ContentHash::Of(sameElement));
+
+    // The hash doesn't depend on the run.
+    REQUIRE(gd::ContentHash::Of(gd::String("")) == 0xa8c7f832281a39c5ULL);
+    REQUIRE(gd::ContentHash::Combine(gd::ContentHash::emptyHash, 1) ==
+            0x89cd31291d2aefa4ULL);
+  }
+
+  SECTION("Variables") {
+    gd::VariablesContainer variables;
+    variables.InsertNew("MyVariable").SetValue(1);
+    auto hash = variables.GetContentHash();
+
+    gd::VariablesContainer copiedVariables = variables;
+    REQUIRE(copiedVariables.GetContentHash() == hash);
+
+    variables.Get("MyVariable").SetValue(2);
+    REQUIRE(variables.GetContentHash() != hash);
+    variables.Get("MyVariable").SetValue(1);
+    REQUIRE(variables.GetContentHash() == hash);
+
+    variables.ResetPersistentUuid();
+    REQUIRE(variables.GetContentHash() == hash);
+
+    variables.Rename("MyVariable", "MyRenamedVariable");
+    REQUIRE(variables.GetContentHash() != hash);
+  }
+
+  SECTION("Events") {
+    gd::EventsList events;
+    auto &event = InsertAction(events, "1");
+    InsertAction(event.GetSubEvents(), "2");
+    auto hash = events.GetContentHash();
+
+    gd::EventsList copiedEvents = events;
+    REQUIRE(copiedEvents.GetContentHash() == hash);
+
+    // Sub-events are modified through the parent event.
+    auto &subEvent = dynamic_cast<gd::StandardEvent &>(
+        events.GetEvent(0).GetSubEvents().GetEvent(0));
+    subEvent.GetActions()[0].SetParameter(0, "3");
+    REQUIRE(events.GetContentHash() != hash);
+
+    events.RemoveEvent(0);
+    REQUIRE(events.GetContentHash() != hash);
+    REQUIRE(events.GetContentHash() == gd::EventsList().GetContentHash());
+  }
+
+  SECTION("Objects") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    auto &object = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    auto hash = object.GetContentHash();
+
+    object.GetVariables().InsertNew("MyVariable");
+    auto hashWithVariable = object.GetContentHash();
+    REQUIRE(hashWithVariable != hash);
+
+    object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    REQUIRE(object.GetContentHash() != hashWithVariable);
+    object.RemoveBehavior("MyBehavior");
+    REQUIRE(object.GetContentHash() == hashWithVariable);
+
+    object.ResetPersistentUuid();
+    REQUIRE(object.GetContentHash() == hashWithVariable);
+
+    gd::Object copiedObject = object;
+    REQUIRE(copiedObject.GetContentHash() == hashWithVariable);
+    copiedObject.SetName("MyRenamedObject");
+    REQUIRE(copiedObject.GetContentHash() != hashWithVariable);
+    REQUIRE(object.GetContentHash() == hashWithVariable);
+  }
+
+  SECTION("Layouts") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    auto &object = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    InsertAction(layout.GetEvents(), "1");
+    auto hash = layout.GetContentHash();
+    REQUIRE(layout.GetContentHash() == hash);
+
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "MyObject");
+    auto hashWithInstance = layout.GetContentHash();
+    REQUIRE(hashWithInstance != hash);
+
+    layout.InsertNewLayer("MyLayer", 0);
+    auto hashWithLayer = layout.GetContentHash();
+    REQUIRE(hashWithLayer != hashWithInstance);
+
+    // Objects, their variables and events are hashed by themselves.
+    object.GetVariables().InsertNew("MyVariable");
+    auto hashWithObjectVariable = layout.GetContentHash();
+    REQUIRE(hashWithObjectVariable != hashWithLayer);
+
+    layout.GetVariables().InsertNew("MySceneVariable");
+    auto hashWithVariable = layout.GetContentHash();
+    REQUIRE(hashWithVariable != hashWithObjectVariable);
+
+    InsertAction(layout.GetEvents(), "2");
+    auto hashWithEvent = layout.GetContentHash();
+    REQUIRE(hashWithEvent != hashWithVariable);
+
+    // Groups are part of the settings of the layout.
+    layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    REQUIRE(layout.GetContentHash() != hashWithEvent);
+
+    // Persistent UUIDs are ignored.
+    auto hashWithGroup = layout.GetContentHash();
+    layout.GetVariables().ResetPersistentUuid();
+    object.ResetPersistentUuid();
+    REQUIRE(layout.GetContentHash() == hashWithGroup);
+
+    // The hash is the same as a layout with the same content.
+    gd::SerializerElement element;
+    layout.SerializeTo(element);
+    auto &otherLayout = project.InsertNewLayout("OtherScene", 1);
+    otherLayout.UnserializeFrom(project, element);
+    otherLayout.SetName("Scene");
+    REQUIRE(otherLayout.GetContentHash() == hashWithGroup);
+  }
+
+  SECTION("Extensions") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    auto &function = extension.InsertNewEventsFunction("MyFunction", 0);
+    auto hash = extension.GetContentHash();
+
+    function.SetFullName("My function");
+    auto hashWithFullName = extension.GetContentHash();
+    REQUIRE(hashWithFullName != hash);
+
+    InsertAction(function.GetEvents(), "1");
+    auto hashWithEvent = extension.GetContentHash();
+    REQUIRE(hashWithEvent != hashWithFullName);
+
+    extension.GetSceneVariables().InsertNew("MyVariable");
+    auto hashWithVariable = extension.GetContentHash();
+    REQUIRE(hashWithVariable != hashWithEvent);
+
+    extension.GetEventsBasedBehaviors().InsertNew("MyBehavior", 0);
+    auto hashWithBehavior = extension.GetContentHash();
+    REQUIRE(hashWithBehavior != hashWithVariable);
+
+    extension.SetDescription("My description");
+    REQUIRE(extension.GetContentHash() != hashWithBehavior);
+
+    gd::EventsFunctionsExtension copiedExtension = extension;
+    REQUIRE(copiedExtension.GetContentHash() == extension.GetContentHash());
+  }
+}
+
+TEST_CASE("ContentHash - Benchmarks", "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  for (std::size_t i = 0; i < 1000; ++i) {
+    layout.GetObjects().InsertNewObject(project, "MyExtension::Sprite",
+                                        "MyObject" + gd::String::From(i), i);
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "MyObject" + gd::String::From(i));
+  }
+  for (std::size_t i = 0; i < 10000; ++i) {
+    auto &event = InsertAction(layout.GetEvents(), gd::String::From(i));
+    InsertAction(event.GetSubEvents(), "MyVariable + " + gd::String::From(i));
+  }
+
+  DoBenchmark("Serialize layout", 10, [&]() {
+    gd::SerializerElement element;
+    layout.SerializeTo(element);
+  });
+
+  std::uint64_t hash = 0;
+  DoBenchmark("First content hash of layout", 1,
+              [&]() { hash = layout.GetContentHash(); });
+
+  DoBenchmark("Content hash of unchanged layout", 10,
+              [&]() { REQUIRE(layout.GetContentHash() == hash); });
+
+  std::size_t changesCount = 0;
+  DoBenchmark("Content hash of layout after an object change", 10, [&]() {
+    layout.GetObjects().GetObject(0).SetAssetStoreId(
+        gd::String::From(++changesCount));
+    REQUIRE(layout.GetContentHash() != hash);
+  });
+}
@@ -7,11 +7,22 @@
  * @file Tests covering events of GDevelop Core.
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include <algorithm>
 #include <memory>
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Tools/PoolAllocator.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
@@ -32,3 +43,252 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
 }
+
+namespace {
+
+void SetupLinksAndStandardEventsCodeGeneration(gd::Platform& platform) {
+  auto extension = platform.GetExtension("BuiltinCommonInstructions");
+  extension->GetAllEvents()["BuiltinCommonInstructions::Standard"]
+      .SetCodeGenerator([](gd::BaseEvent& event_,
+                           gd::EventsCodeGenerator& codeGenerator,
+                           gd::EventsCodeGenerationContext& context) {
+        auto& event = dynamic_cast<gd::StandardEvent&>(event_);
+        gd::String code = "[";
+        if (!event.GetActions().IsEmpty())
+          code += event.GetActions().Get(0).GetParameter(0).GetPlainString();
+        return code + "]{" +
+               codeGenerator.GenerateEventsListCode(event.GetSubEvents(),
+                                                    context) +
+               "}";
+      });
+  extension
+      ->AddEvent("Link", "Link", "", "", "", std::make_shared<gd::LinkEvent>())
+      .SetCodeGenerator([](gd::BaseEvent& event_,
+                           gd::EventsCodeGenerator& codeGenerator,
+                           gd::EventsCodeGenerationContext& context) {
+        auto& event = dynamic_cast<gd::LinkEvent&>(event_);
+        return codeGenerator.GenerateLinkedEventsCode(event, context);
+      })
+      .SetPreprocessing([](gd::BaseEvent& event_,
+                           gd::EventsCodeGenerator& codeGenerator,
+                           gd::EventsList& eventList,
+                           std::size_t indexOfTheEventInThisList) {
+        if (codeGenerator.IsLinkedEventsSharingEnabled()) return;
+
+        auto& event = dynamic_cast<gd::LinkEvent&>(event_);
+        event.ReplaceLinkByLinkedEvents(
+            codeGenerator.GetProject(), eventList, indexOfTheEventInThisList);
+      });
+}
+
+gd::StandardEvent& InsertStandardEvent(gd::Project& project,
+                                       gd::EventsList& events,
+                                       const gd::String& name) {
+  auto& event = dynamic_cast<gd::StandardEvent&>(
+      events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+  event.GetActions().Insert(gd::Instruction(
+      "MyExtension::DoSomething", std::vector<gd::Expression>{name}));
+  return event;
+}
+
+/**
+ * \brief A code generator generating a function for each events list, like
+ * the JavaScript code generator.
+ */
+class EventsListsFunctionsCodeGenerator : public gd::EventsCodeGenerator {
+ public:
+  EventsListsFunctionsCodeGenerator(const gd::Project& project,
+                                    const gd::Layout& layout,
+                                    const gd::Platform& platform)
+      : gd::EventsCodeGenerator(project, layout, platform){};
+
+  gd::String GenerateEventsListCode(
+      gd::EventsList& events,
+      gd::EventsCodeGenerationContext& context) override {
+    gd::String code =
+        gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
+    functions.push_back(code);
+    return "eventsList" + gd::String::From(functions.size() - 1) + "();";
+  }
+
+  gd::String GenerateCode(const gd::EventsList& events) {
+    PreprocessEventListWithoutCopy(events);
+    unsigned int maxDepthLevelReached = 0;
+    gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+    return GenerateEventsListCode(const_cast<gd::EventsList&>(events),
+                                  context);
+  }
+
+  std::size_t CountOccurrences(const gd::String& search) {
+    std::size_t count = 0;
+    for (const auto& code : functions) {
+      for (std::size_t position = code.find(search);
+           position != gd::String::npos;
+           position = code.find(search, position + 1))
+        count++;
+    }
+    return count;
+  }
+
+  std::vector<gd::String> functions;
+};
+
+}  // namespace
+
+TEST_CASE("EventsCodeGenerator - Preprocessing without copy",
+          "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupLinksAndStandardEventsCodeGeneration(platform);
+
+  auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+  InsertStandardEvent(project, externalEvents.GetEvents(), "C");
+  InsertStandardEvent(project, externalEvents.GetEvents(), "D");
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  auto& eventA = InsertStandardEvent(project, layout.GetEvents(), "A");
+  InsertStandardEvent(project, eventA.GetSubEvents(), "B");
+  auto& linkEvent = dynamic_cast<gd::LinkEvent&>(
+      eventA.GetSubEvents().InsertNewEvent(project,
+                                           "BuiltinCommonInstructions::Link"));
+  linkEvent.SetTarget("External");
+  InsertStandardEvent(project, layout.GetEvents(), "E");
+
+  gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+  codeGenerator.PreprocessEventListWithoutCopy(layout.GetEvents());
+  unsigned int maxDepthLevelReached = 0;
+  gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+  gd::String code =
+      codeGenerator.GenerateEventsListCode(layout.GetEvents(), context);
+
+  // The code is the same as the code generated from a preprocessed copy.
+  gd::EventsList copiedEvents = layout.GetEvents();
+  gd::EventsCodeGenerator copyCodeGenerator(project, layout, platform);
+  copyCodeGenerator.PreprocessEventList(copiedEvents);
+  unsigned int copyMaxDepthLevelReached = 0;
+  gd::EventsCodeGenerationContext copyContext(&copyMaxDepthLevelReached);
+  REQUIRE(code ==
+          copyCodeGenerator.GenerateEventsListCode(copiedEvents, copyContext));
+
+  REQUIRE(code.find("[A]") < code.find("[B]"));
+  REQUIRE(code.find("[B]") < code.find("[C]"));
+  REQUIRE(code.find("[C]") < code.find("[D]"));
+  REQUIRE(code.find("[D]") < code.find("[E]"));
+
+  // Events are not modified, and only the list with the link was copied.
+  REQUIRE(eventA.GetSubEvents().GetEventsCount() == 2);
+  REQUIRE(eventA.GetSubEvents()[1].GetType() ==
+          "BuiltinCommonInstructions::Link");
+  REQUIRE(&codeGenerator.GetPreprocessedEventList(layout.GetEvents()) ==
+          &layout.GetEvents());
+  gd::EventsList& preprocessedSubEvents =
+      codeGenerator.GetPreprocessedEventList(eventA.GetSubEvents());
+  REQUIRE(&preprocessedSubEvents != &eventA.GetSubEvents());
+  REQUIRE(preprocessedSubEvents.GetEventSmartPtr(0) ==
+          eventA.GetSubEvents().GetEventSmartPtr(0));
+}
+
+TEST_CASE("EventsCodeGenerator - Linked events sharing", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupLinksAndStandardEventsCodeGeneration(platform);
+
+  auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+  auto& eventC = InsertStandardEvent(project, externalEvents.GetEvents(), "C");
+  InsertStandardEvent(project, eventC.GetSubEvents(), "D");
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  auto insertLink = [&project](gd::EventsList& events) {
+    dynamic_cast<gd::LinkEvent&>(
+        events.InsertNewEvent(project, "BuiltinCommonInstructions::Link"))
+        .SetTarget("External");
+  };
+  // Two links in the same objects scope, and a link in another one.
+  auto& eventA = InsertStandardEvent(project, layout.GetEvents(), "A");
+  insertLink(eventA.GetSubEvents());
+  insertLink(eventA.GetSubEvents());
+  InsertStandardEvent(project, eventA.GetSubEvents(), "B");
+  insertLink(layout.GetEvents());
+
+  SECTION("Linked events are copied in place of each link by default") {
+    EventsListsFunctionsCodeGenerator codeGenerator(project, layout, platform);
+    codeGenerator.GenerateCode(layout.GetEvents());
+    REQUIRE(codeGenerator.CountOccurrences("[C]") == 3);
+  }
+
+  SECTION("Linked events are generated once for each objects scope") {
+    EventsListsFunctionsCodeGenerator codeGenerator(project, layout, platform);
+    codeGenerator.SetLinkedEventsSharing(true);
+    codeGenerator.GenerateCode(layout.GetEvents());
+    REQUIRE(codeGenerator.CountOccurrences("[C]") == 2);
+    REQUIRE(codeGenerator.CountOccurrences("[D]") == 2);
+
+    // Both links of the sub-events of A call the same function.
+    REQUIRE(codeGenerator.CountOccurrences("[B]") == 1);
+    const gd::String& subEventsCode =
+        *std::find_if(codeGenerator.functions.begin(),
+                      codeGenerator.functions.end(),
+                      [](const gd::String& code) {
+                        return code.find("[B]") != gd::String::npos;
+                      });
+    std::size_t firstCallPosition = subEventsCode.find("eventsList");
+    REQUIRE(firstCallPosition != gd::String::npos);
+    gd::String firstCall = subEventsCode.substr(
+        firstCallPosition,
+        subEventsCode.find(";", firstCallPosition) - firstCallPosition);
+    REQUIRE(subEventsCode.find(firstCall, firstCallPosition + 1) !=
+            gd::String::npos);
+
+    // The project events are not modified.
+    REQUIRE(eventA.GetSubEvents().GetEventsCount() == 3);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 2);
+  }
+}
+
+TEST_CASE("EventsCodeGenerator - Benchmarks",
+          "[.][benchmark][common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupLinksAndStandardEventsCodeGeneration(platform);
+
+  auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+  InsertStandardEvent(project, externalEvents.GetEvents(), "Linked");
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  for (std::size_t i = 0; i < 2000; ++i) {
+    auto& event =
+        InsertStandardEvent(project, layout.GetEvents(), gd::String::From(i));
+    for (std::size_t j = 0; j < 4; ++j)
+      InsertStandardEvent(project, event.GetSubEvents(), gd::String::From(j));
+  }
+  dynamic_cast<gd::LinkEvent&>(layout.GetEvents().InsertNewEvent(
+                                   project, "BuiltinCommonInstructions::Link"))
+      .SetTarget("External");
+
+  DoBenchmark("Preprocessing of a copy of the events", 5, [&]() {
+    std::size_t allocatedBlocksCount =
+        gd::MemoryPool::GetAllocatedBlocksCount();
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    gd::EventsList copiedEvents = layout.GetEvents();
+    codeGenerator.PreprocessEventList(copiedEvents);
+    REQUIRE(copiedEvents.GetEventsCount() == 2002);
+    std::cout << "Instructions copied: "
+              << gd::MemoryPool::GetAllocatedBlocksCount() -
+                     allocatedBlocksCount
+              << std::endl;
+  });
+  DoBenchmark("Preprocessing without copy of the events", 5, [&]() {
+    std::size_t allocatedBlocksCount =
+        gd::MemoryPool::GetAllocatedBlocksCount();
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    codeGenerator.PreprocessEventListWithoutCopy(layout.GetEvents());
+    REQUIRE(codeGenerator.GetPreprocessedEventList(layout.GetEvents())
+                .GetEventsCount() == 2002);
+    std::cout << "Instructions copied: "
+              << gd::MemoryPool::GetAllocatedBlocksCount() -
+                     allocatedBlocksCount
+              << std::endl;
+  });
+}
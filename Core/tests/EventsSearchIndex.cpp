@@ -0,0 +1,176 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the search in events using an index of the events.
+ */
+#include "GDCore/IDE/Events/EventsSearchIndex.h"
+
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::StandardEvent& InsertEvent(gd::Project& project,
+                               gd::EventsList& events,
+                               const std::vector<gd::String>& parameters) {
+  auto& event = dynamic_cast<gd::StandardEvent&>(
+      events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+  for (const auto& parameter : parameters) {
+    event.GetActions().Insert(gd::Instruction(
+        "MyExtension::DoSomething", std::vector<gd::Expression>{parameter}));
+  }
+  return event;
+}
+
+std::vector<const gd::BaseEvent*> GetEvents(
+    const std::vector<gd::EventsSearchResult>& results) {
+  std::vector<const gd::BaseEvent*> events;
+  for (const auto& result : results) events.push_back(&result.GetEvent());
+  return events;
+}
+
+}  // namespace
+
+TEST_CASE("EventsSearchIndex", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  gd::EventsList& events = layout.GetEvents();
+  for (std::size_t i = 0; i < 20; ++i) {
+    auto& event = InsertEvent(
+        project,
+        events,
+        {"Value" + gd::String::From(i), "\"Text\" + \"Ünïcode\""});
+    InsertEvent(
+        project, event.GetSubEvents(), {"SubValue" + gd::String::From(i)});
+  }
+
+  gd::EventsSearchIndex index(platform);
+  index.IndexEvents(events);
+  REQUIRE(index.GetIndexedEventsCount() == 40);
+
+  auto requireSameResults = [&](const gd::String& search,
+                                bool matchCase,
+                                bool inEventSentences) {
+    auto results = gd::EventsRefactorer::SearchInEvents(
+        platform, events, search, matchCase, true, true, true,
+        inEventSentences);
+    auto resultsWithIndex = gd::EventsRefactorer::SearchInEvents(
+        platform, events, index, search, matchCase, true, true, true,
+        inEventSentences);
+    REQUIRE(GetEvents(resultsWithIndex) == GetEvents(results));
+    return results.size();
+  };
+
+  SECTION("Results are the same as without the index") {
+    REQUIRE(requireSameResults("Value12", true, false) == 2);
+    REQUIRE(requireSameResults("value12", false, false) == 2);
+    REQUIRE(requireSameResults("value12", true, false) == 0);
+    REQUIRE(requireSameResults("SubValue1", true, false) == 11);
+    REQUIRE(requireSameResults("ünï", false, false) == 20);
+    REQUIRE(requireSameResults("ÜNÏCODE", false, false) == 20);
+    REQUIRE(requireSameResults("Do something please", false, true) == 40);
+    REQUIRE(requireSameResults("(Value3)", false, true) == 2);
+    REQUIRE(requireSameResults("V", true, false) == 40);
+    REQUIRE(requireSameResults("Nothing", false, true) == 0);
+  }
+
+  SECTION("Updated and new events are found") {
+    auto& event = dynamic_cast<gd::StandardEvent&>(events.GetEvent(3));
+    event.GetActions().Get(0).SetParameter(0, "Modified");
+    index.UpdateEvent(events, 3);
+    REQUIRE(requireSameResults("Modified", true, false) == 1);
+    REQUIRE(requireSameResults("Value3", true, false) == 1);
+
+    // Events not indexed yet are always searched.
+    InsertEvent(project, events, {"Inserted"});
+    REQUIRE(requireSameResults("Inserted", true, false) == 1);
+
+    index.RemoveEvent(events.GetEvent(5));
+    REQUIRE(requireSameResults("Value5", true, false) == 2);
+  }
+
+  SECTION("Index is updated by replacements") {
+    gd::ObjectsContainer& objects = layout.GetObjects();
+    auto modifiedEvents = gd::EventsRefactorer::ReplaceStringInEvents(
+        objects, objects, events, index, "Value1", "Replaced", true, true,
+        true, true);
+    REQUIRE(modifiedEvents.size() == 22);
+    REQUIRE(requireSameResults("Replaced", true, false) == 22);
+    REQUIRE(requireSameResults("Value1", true, false) == 0);
+  }
+}
+
+TEST_CASE("EventsSearchIndex - Benchmarks", "[.][benchmark][common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  // 300000 instructions.
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  gd::EventsList& events = layout.GetEvents();
+  for (std::size_t i = 0; i < 30000; ++i) {
+    auto& event = InsertEvent(project,
+                              events,
+                              {"Value" + gd::String::From(i),
+                               "MyVariable + 1",
+                               "\"Some text\"",
+                               "Speed * 2"});
+    InsertEvent(project,
+                event.GetSubEvents(),
+                {"SubValue" + gd::String::From(i),
+                 "Other + 3",
+                 "\"Other text\"",
+                 "Position",
+                 "Angle",
+                 "Time"});
+  }
+
+  gd::EventsSearchIndex index(platform);
+  DoBenchmark("Events indexing", 1, [&]() {
+    index.IndexEvents(events);
+    REQUIRE(index.GetIndexedEventsCount() == 60000);
+  });
+
+  DoBenchmark("Search without index", 1, [&]() {
+    auto results = gd::EventsRefactorer::SearchInEvents(
+        platform, events, "value1234", false, true, true, true, false);
+    REQUIRE(results.size() == 22);
+  });
+  DoBenchmark("Search with index", 5, [&]() {
+    auto results = gd::EventsRefactorer::SearchInEvents(
+        platform, events, index, "value1234", false, true, true, true, false);
+    REQUIRE(results.size() == 22);
+  });
+
+  DoBenchmark("Search in sentences without index", 1, [&]() {
+    auto results = gd::EventsRefactorer::SearchInEvents(
+        platform, events, "value1234", false, true, true, true, true);
+    REQUIRE(results.size() == 22);
+  });
+  DoBenchmark("Search in sentences with index", 5, [&]() {
+    auto results = gd::EventsRefactorer::SearchInEvents(
+        platform, events, index, "value1234", false, true, true, true, true);
+    REQUIRE(results.size() == 22);
+  });
+
+  DoBenchmark("Update of an event", 5, [&]() {
+    auto& event = dynamic_cast<gd::StandardEvent&>(events.GetEvent(42));
+    event.GetActions().Get(1).SetParameter(0, "MyVariable + 2");
+    index.UpdateEvent(events, 42);
+  });
+}
@@ -0,0 +1,293 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the parsing of an edited expression reusing the tree
+ * of the previous expression.
+ */
+#include <algorithm>
+#include <random>
+
+#include "BenchmarkTools.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * Print all the nodes of a tree with their locations and diagnostics, and
+ * check the parents of the nodes.
+ */
+class TreeDumper : public gd::ExpressionParser2NodeWorker {
+ public:
+  TreeDumper(){};
+  virtual ~TreeDumper(){};
+
+  static gd::String Dump(gd::ExpressionNode& node) {
+    TreeDumper dumper;
+    node.Visit(dumper);
+    return dumper.output;
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(gd::SubExpressionNode& node) override {
+    Print("SubExpression", node);
+    VisitChild(*node.expression, node);
+  }
+  void OnVisitOperatorNode(gd::OperatorNode& node) override {
+    gd::String description = "Operator ";
+    description += node.op;
+    Print(description, node);
+    VisitChild(*node.leftHandSide, node);
+    VisitChild(*node.rightHandSide, node);
+  }
+  void OnVisitUnaryOperatorNode(gd::UnaryOperatorNode& node) override {
+    gd::String description = "UnaryOperator ";
+    description += node.op;
+    Print(description, node);
+    VisitChild(*node.factor, node);
+  }
+  void OnVisitNumberNode(gd::NumberNode& node) override {
+    Print("Number " + node.number, node);
+  }
+  void OnVisitTextNode(gd::TextNode& node) override {
+    Print("Text " + node.text, node);
+  }
+  void OnVisitVariableNode(gd::VariableNode& node) override {
+    Print("Variable " + node.name, node);
+    PrintLocation(node.nameLocation);
+    if (node.child) VisitChild(*node.child, node);
+  }
+  void OnVisitVariableAccessorNode(gd::VariableAccessorNode& node) override {
+    Print("VariableAccessor " + node.name, node);
+    PrintLocation(node.nameLocation);
+    PrintLocation(node.dotLocation);
+    if (node.child) VisitChild(*node.child, node);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      gd::VariableBracketAccessorNode& node) override {
+    Print("VariableBracketAccessor", node);
+    VisitChild(*node.expression, node);
+    if (node.child) VisitChild(*node.child, node);
+  }
+  void OnVisitIdentifierNode(gd::IdentifierNode& node) override {
+    Print("Identifier " + node.identifierName + "." + node.childIdentifierName,
+          node);
+    PrintLocation(node.identifierNameLocation);
+    PrintLocation(node.identifierNameDotLocation);
+    PrintLocation(node.childIdentifierNameLocation);
+  }
+  void OnVisitObjectFunctionNameNode(
+      gd::ObjectFunctionNameNode& node) override {
+    Print("ObjectFunctionName " + node.objectName + "." +
+              node.objectFunctionOrBehaviorName + "::" +
+              node.behaviorFunctionName,
+          node);
+    PrintLocation(node.objectNameLocation);
+    PrintLocation(node.objectNameDotLocation);
+    PrintLocation(node.objectFunctionOrBehaviorNameLocation);
+    PrintLocation(node.behaviorNameNamespaceSeparatorLocation);
+    PrintLocation(node.behaviorFunctionNameLocation);
+  }
+  void OnVisitFunctionCallNode(gd::FunctionCallNode& node) override {
+    Print("FunctionCall " + node.objectName + "." + node.behaviorName +
+              "::" + node.functionName,
+          node);
+    PrintLocation(node.functionNameLocation);
+    PrintLocation(node.objectNameLocation);
+    PrintLocation(node.objectNameDotLocation);
+    PrintLocation(node.behaviorNameLocation);
+    PrintLocation(node.behaviorNameNamespaceSeparatorLocation);
+    PrintLocation(node.openingParenthesisLocation);
+    PrintLocation(node.closingParenthesisLocation);
+    for (auto& parameter : node.parameters) VisitChild(*parameter, node);
+    output += ")";
+  }
+  void OnVisitEmptyNode(gd::EmptyNode& node) override {
+    Print("Empty " + node.text, node);
+  }
+
+ private:
+  void Print(const gd::String& description, gd::ExpressionNode& node) {
+    output += "\n" + description;
+    PrintLocation(node.location);
+    if (node.diagnostic) {
+      output += " error " + node.diagnostic->GetMessage() + " at " +
+                gd::String::From(node.diagnostic->GetStartPosition()) + "-" +
+                gd::String::From(node.diagnostic->GetEndPosition());
+    }
+  }
+
+  void PrintLocation(const gd::ExpressionParserLocation& location) {
+    if (!location.IsValid()) {
+      output += " [-]";
+      return;
+    }
+    output += " [" + gd::String::From(location.GetStartPosition()) + "-" +
+              gd::String::From(location.GetEndPosition()) + "]";
+  }
+
+  void VisitChild(gd::ExpressionNode& child, gd::ExpressionNode& parent) {
+    if (child.parent != &parent) output += " (wrong parent)";
+    child.Visit(*this);
+  }
+
+  gd::String output;
+};
+
+gd::String ApplyEdit(const gd::String& expression,
+                     size_t editPosition,
+                     size_t removedLength,
+                     const gd::String& insertedText) {
+  return expression.substr(0, editPosition) + insertedText +
+         expression.substr(editPosition + removedLength);
+}
+
+}  // namespace
+
+TEST_CASE("ExpressionParser2 - Reparsing", "[common][events]") {
+  gd::ExpressionParser2 parser;
+
+  auto requireSameTreeAsParsing =
+      [&](const gd::String& previousExpression,
+          size_t editPosition,
+          size_t removedLength,
+          const gd::String& insertedText) {
+        gd::String expression = ApplyEdit(
+            previousExpression, editPosition, removedLength, insertedText);
+        auto reparsedNode =
+            parser.ReparseExpression(parser.ParseExpression(previousExpression),
+                                     previousExpression,
+                                     editPosition,
+                                     removedLength,
+                                     insertedText);
+        REQUIRE(reparsedNode != nullptr);
+        auto node = parser.ParseExpression(expression);
+        INFO("Editing \"" << previousExpression << "\" into \"" << expression
+                          << "\"");
+        REQUIRE(TreeDumper::Dump(*reparsedNode) == TreeDumper::Dump(*node));
+        return reparsedNode;
+      };
+
+  SECTION("Edits inside parameters") {
+    requireSameTreeAsParsing("MyFunction(1, 2 + 3, \"Text\")", 16, 1, "42");
+    requireSameTreeAsParsing("MyFunction(1, 2 + 3, \"Text\")", 23, 0, "ü");
+    requireSameTreeAsParsing("MyFunction(1, 2 + 3, \"Text\")", 11, 1, "");
+    requireSameTreeAsParsing("MyObject.Func(1, (2 + 3) * 4)", 19, 1, "Var.Child");
+    requireSameTreeAsParsing("MyVar[\"a\" + MyVar2[1]].Child + 1", 19, 1, "22");
+    requireSameTreeAsParsing("MyObj.Beh::Func(Other.Var[1], 2) + 3", 26, 1, "i");
+  }
+
+  SECTION("Edits changing the structure") {
+    requireSameTreeAsParsing("MyFunction(1, 2 + 3, \"Text\")", 16, 0, ")");
+    requireSameTreeAsParsing("MyFunction(1, 2 + 3, \"Text\")", 15, 0, "\"");
+    requireSameTreeAsParsing("MyFunction(1, 2 + 3, \"Text\")", 12, 2, "");
+    requireSameTreeAsParsing("MyFunction(1, (2 + 3), 4)", 20, 1, "");
+    requireSameTreeAsParsing("MyFunction(1, 2", 15, 0, ", 3)");
+    requireSameTreeAsParsing("1 + 2", 0, 5, "MyFunction()");
+  }
+
+  SECTION("Unchanged parameters are kept") {
+    gd::String expression = "MyFunction(1, Other(2, 3), 4)";
+    auto node = parser.ParseExpression(expression);
+    auto& function = dynamic_cast<gd::FunctionCallNode&>(*node);
+    gd::ExpressionNode* firstParameter = function.parameters[0].get();
+    gd::ExpressionNode* otherFunction = function.parameters[1].get();
+    gd::ExpressionNode* lastParameter = function.parameters[2].get();
+
+    auto reparsedNode =
+        parser.ReparseExpression(std::move(node), expression, 21, 0, "0");
+    REQUIRE(reparsedNode.get() == &function);
+    REQUIRE(function.parameters[0].get() == firstParameter);
+    REQUIRE(function.parameters[1].get() == otherFunction);
+    REQUIRE(function.parameters[2].get() == lastParameter);
+    REQUIRE(lastParameter->location.GetStartPosition() == 28);
+    REQUIRE(function.closingParenthesisLocation.GetStartPosition() == 29);
+  }
+
+  SECTION("Random edits give the same tree as parsing") {
+    std::vector<gd::String> expressions = {
+        "MyFunction(1, 2 + 3, \"Text\")",
+        "MyObject.Func(1, (2 + 3) * -4, MyVar[\"a\"].b)",
+        "MyObj.Beh::Func(Other.Var[1 + (2)], \"\\\"ü\\\"\") / 2",
+        "MyExtension::GetNumber( ( 1 ), Vär.Child[ A(B(C(1))) ] )",
+        "(1 + (2 * (3 - MyFunction(4, 5))))",
+    };
+    std::vector<gd::String> insertedTexts = {
+        "", "1", "a", " ", "(", ")", ",", "\"", "[", "]", ".", "+", "::",
+        "F(", "ü", "2 + 3", "-"};
+
+    std::mt19937 random(42);
+    for (const gd::String& initialExpression : expressions) {
+      gd::String expression = initialExpression;
+      auto node = parser.ParseExpression(expression);
+      for (size_t i = 0; i < 300; ++i) {
+        size_t length = expression.size();
+        size_t editPosition = random() % (length + 1);
+        size_t removedLength =
+            std::min<size_t>(random() % 4, length - editPosition);
+        const gd::String& insertedText =
+            insertedTexts[random() % insertedTexts.size()];
+        gd::String newExpression =
+            ApplyEdit(expression, editPosition, removedLength, insertedText);
+
+        node = parser.ReparseExpression(std::move(node),
+                                        expression,
+                                        editPosition,
+                                        removedLength,
+                                        insertedText);
+        REQUIRE(node != nullptr);
+        auto parsedNode = parser.ParseExpression(newExpression);
+        INFO("Editing \"" << expression << "\" into \"" << newExpression
+                          << "\"");
+        REQUIRE(TreeDumper::Dump(*node) == TreeDumper::Dump(*parsedNode));
+
+        expression = newExpression;
+        if (expression.size() > 150) {
+          expression = initialExpression;
+          node = parser.ParseExpression(expression);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("ExpressionParser2 - Reparsing Benchmarks",
+          "[.][benchmark][common][events]") {
+  gd::ExpressionParser2 parser;
+
+  gd::String expression = "MyFunction(";
+  for (size_t i = 0; i < 2000; ++i) {
+    expression += "MyObject.X() + cos(" + gd::String::From(i) +
+                  ") * MyVar[\"Child\"], ";
+  }
+  expression += "0)";
+
+  std::unique_ptr<gd::ExpressionNode> node;
+  DoBenchmark("Parse a very long expression", 5, [&]() {
+    node = parser.ParseExpression(expression);
+  });
+
+  // Type digits in the middle of the expression (in "cos(1000)").
+  size_t editPosition = expression.find("cos(1000)") + 5;
+  std::vector<gd::String> expressions = {expression};
+  for (size_t i = 0; i < 5; ++i) {
+    expressions.push_back(
+        ApplyEdit(expressions.back(), editPosition + i, 0, "1"));
+  }
+
+  size_t editsCount = 0;
+  DoBenchmark("Reparse a very long expression after an edit", 5, [&]() {
+    node = parser.ReparseExpression(std::move(node),
+                                    expressions[editsCount],
+                                    editPosition + editsCount,
+                                    0,
+                                    "1");
+    editsCount++;
+  });
+  REQUIRE(TreeDumper::Dump(*node) ==
+          TreeDumper::Dump(*parser.ParseExpression(expressions.back())));
+}
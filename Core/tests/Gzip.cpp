@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the gzip compression.
+ */
+#include "GDCore/Tools/Gzip.h"
+
+#include "catch.hpp"
+
+TEST_CASE("Gzip", "[common]") {
+  SECTION("Crc32") {
+    REQUIRE(gd::Gzip::Crc32("") == 0);
+    REQUIRE(gd::Gzip::Crc32("123456789") == 0xCBF43926);
+  }
+
+  SECTION("Compress and decompress") {
+    std::string repeatedJson;
+    for (int i = 0; i < 1000; ++i) {
+      repeatedJson += "{\"name\":\"MyObject" + std::to_string(i) +
+                      "\",\"type\":\"Sprite\",\"behaviors\":[]},";
+    }
+    std::string binaryData;
+    for (int i = 0; i < 100000; ++i) {
+      binaryData.push_back(static_cast<char>((i * 7919 + i / 13) % 256));
+    }
+
+    for (const std::string &data : {std::string(""),
+                                    std::string("a"),
+                                    std::string("\0\0\0\0\0\0\0\0", 8),
+                                    std::string(70000, 'x'),
+                                    repeatedJson,
+                                    binaryData}) {
+      std::string compressedData = gd::Gzip::Compress(data);
+      REQUIRE(compressedData.substr(0, 3) == "\x1f\x8b\x08");
+
+      std::string decompressedData;
+      REQUIRE(gd::Gzip::Decompress(compressedData, decompressedData));
+      REQUIRE(decompressedData == data);
+    }
+
+    REQUIRE(gd::Gzip::Compress(repeatedJson).size() <
+            repeatedJson.size() / 5);
+  }
+
+  SECTION("Decompress data compressed with dynamic Huffman codes") {
+    // Compressed with zlib (level 9).
+    std::string compressedData(
+        "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x4d\x8f\xc1\x8d\xc3\x30"
+        "\x0c\x04\x5b\xd9\x02\x62\x17\x90\xf7\x01\xa9\xe1\x9e\xb4\xb5\x72"
+        "\x84\xc8\xa2\x21\x52\x31\xd2\xfd\xc9\xca\xe7\xde\x3b\xb3\x4b\x3e"
+        "\x7e\xf8\x66\xd6\x03\xc9\x20\x88\x2d\xe7\x29\x52\xbc\x55\x86\x1b"
+        "\x8a\x4e\xab\x06\xde\xa0\x07\xcb\x64\xda\xea\x4a\x6c\xb2\x13\xe1"
+        "\x6b\xed\x2c\x0e\xd3\xe8\xa7\x54\xce\xf8\xd5\x86\x55\x0a\x96\x96"
+        "\x72\x18\xa0\x21\x6a\xc5\xae\x4b\xca\xbd\x26\xd0\x5e\xde\xb7\xa4"
+        "\x04\xf8\x93\x38\xb9\xcc\x78\xfc\xbb\x20\x8a\xf9\x48\x29\xf6\x81"
+        "\x2b\x9a\xf1\x3e\xd0\xb1\x9a\x75\x4b\xeb\xc5\x5d\x03\x8e\x76\xf4"
+        "\x3c\x95\xad\x1b\x48\xc5\x5b\xf2\xf4\xe6\xd0\x0f\x3d\x59\xfb\x33"
+        "\xe8\xd5\xc5\xa7\x45\x8c\x01\xf6\x31\xe7\x3e\xff\x01\x62\xd3\x6c"
+        "\x33\xf2\x00\x00\x00",
+        181);
+
+    std::string data;
+    REQUIRE(gd::Gzip::Decompress(compressedData, data));
+    REQUIRE(data ==
+            "GDevelop is a full-featured, no-code, open-source game "
+            "development software. You can build games for mobile, desktop "
+            "and the web. GDevelop is fast and easy to use: the game logic is "
+            "built up using an intuitive and powerful event-based system.");
+  }
+
+  SECTION("Refuse invalid or corrupted data") {
+    std::string data;
+    REQUIRE(!gd::Gzip::Decompress("", data));
+    REQUIRE(!gd::Gzip::Decompress("Not compressed at all", data));
+
+    std::string compressedData = gd::Gzip::Compress("Hello world, hello world");
+    REQUIRE(!gd::Gzip::Decompress(
+        compressedData.substr(0, compressedData.size() - 1), data));
+
+    compressedData[12] = compressedData[12] ^ 0x10;
+    REQUIRE(!gd::Gzip::Decompress(compressedData, data));
+    REQUIRE(data.empty());
+  }
+}
@@ -0,0 +1,187 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the index of the names of objects, groups and
+ * variables used for the autocompletion of expressions.
+ */
+#include "GDCore/Project/IdentifiersSearchIndex.h"
+
+#include <algorithm>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionCompletionFinder.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Project/Variable.h"
+#include "catch.hpp"
+
+namespace {
+
+std::vector<gd::String> GetNamesMatchingSearch(
+    const gd::ProjectScopedContainers& projectScopedContainers,
+    const gd::String& search) {
+  std::vector<gd::String> names;
+  projectScopedContainers.ForEachIdentifierMatchingSearch(
+      search,
+      [&](const gd::String& name,
+          const gd::ObjectConfiguration* objectConfiguration) {
+        names.push_back(name);
+      },
+      [&](const gd::String& name, const gd::Variable& variable) {
+        names.push_back(name);
+      },
+      [&](const gd::NamedPropertyDescriptor& property) {},
+      [&](const gd::ParameterMetadata& parameter) {});
+  return names;
+}
+
+std::vector<gd::String> Sorted(std::vector<gd::String> names) {
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+}  // namespace
+
+TEST_CASE("IdentifiersSearchIndex", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  for (const gd::String& name :
+       {"Player", "Enemy", "BigPlayer", "Player_Bullet", "DisplayedText"}) {
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", name, 0);
+  }
+  layout.GetObjects().GetObjectGroups().InsertNew("Players");
+  project.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "GlobalPlayer", 0);
+  layout.GetVariables().InsertNew("playerScore");
+  layout.GetVariables().InsertNew("Ünïcode");
+  project.GetVariables().InsertNew("Lives");
+
+  gd::ProjectScopedContainers projectScopedContainers =
+      gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+
+  gd::IdentifiersSearchIndex index;
+  index.IndexObjectsContainer(layout.GetObjects());
+  index.IndexVariablesContainer(layout.GetVariables());
+  gd::ProjectScopedContainers indexedProjectScopedContainers =
+      projectScopedContainers;
+  indexedProjectScopedContainers.SetIdentifiersSearchIndex(index);
+
+  SECTION("Same names are found as without the index") {
+    for (const gd::String& search :
+         {"", "p", "player", "PLAYER", "lay", "yer_b", "ünï", "ÜNÏ", "x", "es"}) {
+      REQUIRE(Sorted(GetNamesMatchingSearch(indexedProjectScopedContainers,
+                                            search)) ==
+              Sorted(GetNamesMatchingSearch(projectScopedContainers, search)));
+    }
+  }
+
+  SECTION("Names are ranked by relevance") {
+    // Names of the scene are given before names of the project (which are not
+    // indexed).
+    std::vector<gd::String> expectedNames{"Player",
+                                          "Players",
+                                          "Player_Bullet",
+                                          "BigPlayer",
+                                          "GlobalPlayer",
+                                          "playerScore"};
+    REQUIRE(GetNamesMatchingSearch(indexedProjectScopedContainers, "player") ==
+            expectedNames);
+    REQUIRE(GetNamesMatchingSearch(indexedProjectScopedContainers, "bullet") ==
+            std::vector<gd::String>(1, "Player_Bullet"));
+  }
+
+  SECTION("Containers are indexed again after changes") {
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "NewPlayer", 0);
+    layout.GetObjects().GetObject("Enemy").SetName("Boss");
+    index.IndexObjectsContainer(layout.GetObjects());
+
+    REQUIRE(GetNamesMatchingSearch(indexedProjectScopedContainers, "newp") ==
+            std::vector<gd::String>(1, "NewPlayer"));
+    REQUIRE(GetNamesMatchingSearch(indexedProjectScopedContainers, "enemy")
+                .empty());
+    REQUIRE(GetNamesMatchingSearch(indexedProjectScopedContainers, "boss") ==
+            std::vector<gd::String>(1, "Boss"));
+  }
+
+  SECTION("Expression completions use the index") {
+    gd::ExpressionParser2 parser;
+    auto getCompletionsFor =
+        [&](const gd::ProjectScopedContainers& projectScopedContainers,
+            const gd::String& expression) {
+          auto node = parser.ParseExpression(expression);
+          REQUIRE(node != nullptr);
+          auto completions =
+              gd::ExpressionCompletionFinder::GetCompletionDescriptionsFor(
+                  platform, projectScopedContainers, "number", *node, 0);
+
+          std::vector<gd::String> completionsAsString;
+          for (const auto& completion : completions)
+            completionsAsString.push_back(completion.ToString());
+          return Sorted(completionsAsString);
+        };
+
+    REQUIRE(getCompletionsFor(indexedProjectScopedContainers, "Play") ==
+            getCompletionsFor(projectScopedContainers, "Play"));
+    REQUIRE(getCompletionsFor(indexedProjectScopedContainers, "Player.Var") ==
+            getCompletionsFor(projectScopedContainers, "Player.Var"));
+  }
+}
+
+TEST_CASE("IdentifiersSearchIndex - Benchmarks", "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  for (std::size_t i = 0; i < 5000; ++i) {
+    layout.GetObjects().InsertNewObject(project,
+                                        "MyExtension::Sprite",
+                                        "MyObject" + gd::String::From(i),
+                                        i);
+    layout.GetVariables().InsertNew("MyVariable" + gd::String::From(i), i);
+  }
+
+  gd::ProjectScopedContainers projectScopedContainers =
+      gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+
+  DoBenchmark("Identifiers search without index", 10, [&]() {
+    REQUIRE(GetNamesMatchingSearch(projectScopedContainers, "object123")
+                .size() == 11);
+  });
+
+  gd::IdentifiersSearchIndex index;
+  DoBenchmark("Identifiers indexing", 1, [&]() {
+    index.IndexObjectsContainer(layout.GetObjects());
+    index.IndexVariablesContainer(layout.GetVariables());
+  });
+  projectScopedContainers.SetIdentifiersSearchIndex(index);
+
+  DoBenchmark("Identifiers search with index", 10, [&]() {
+    REQUIRE(GetNamesMatchingSearch(projectScopedContainers, "object123")
+                .size() == 11);
+  });
+
+  gd::ExpressionParser2 parser;
+  auto node = parser.ParseExpression("MyObject123");
+  DoBenchmark("Expression completion with index", 10, [&]() {
+    auto completions =
+        gd::ExpressionCompletionFinder::GetCompletionDescriptionsFor(
+            platform, projectScopedContainers, "number", *node, 0);
+    REQUIRE(completions.size() > 11);
+  });
+}
@@ -0,0 +1,190 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the snapshots of layouts, sharing the unchanged
+ * elements with the previous snapshots.
+ */
+#include "GDCore/Project/LayoutSnapshot.h"
+
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void FillLayout(gd::Project& project,
+                gd::Layout& layout,
+                std::size_t objectsCount,
+                std::size_t instancesCount,
+                std::size_t eventsCount) {
+  for (std::size_t i = 0; i < objectsCount; ++i) {
+    layout.GetObjects().InsertNewObject(project,
+                                        "MyExtension::Sprite",
+                                        "MyObject" + gd::String::From(i),
+                                        i);
+  }
+  for (std::size_t i = 0; i < instancesCount; ++i) {
+    auto& instance = layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MyObject" + gd::String::From(i % objectsCount));
+    instance.SetX(i);
+  }
+  for (std::size_t i = 0; i < eventsCount; ++i) {
+    auto& event =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().InsertNewEvent(
+            project, "BuiltinCommonInstructions::Standard"));
+    event.GetActions().Insert(gd::Instruction(
+        "MyExtension::DoSomething",
+        std::vector<gd::Expression>{gd::String::From(i)}));
+  }
+}
+
+gd::String GetActionParameter(const gd::Layout& layout, std::size_t index) {
+  const auto& event =
+      dynamic_cast<const gd::StandardEvent&>(layout.GetEvents().GetEvent(index));
+  return event.GetActions().Get(0).GetParameter(0).GetPlainString();
+}
+
+}  // namespace
+
+TEST_CASE("LayoutSnapshot", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  FillLayout(project, layout, 3, 10, 5);
+  layout.GetVariables().InsertNew("MyVariable", 0).SetValue(1);
+
+  SECTION("Layout is restored") {
+    unsigned int backgroundColorRed = layout.GetBackgroundColorRed();
+    gd::LayoutSnapshot snapshot = gd::LayoutSnapshot::Take(layout);
+    REQUIRE(snapshot.GetName() == "Scene");
+    REQUIRE(snapshot.GetEventsCount() == 5);
+    REQUIRE(snapshot.GetObjectsCount() == 3);
+    REQUIRE(snapshot.GetInstancesCount() == 10);
+
+    layout.GetEvents().RemoveEvent(0);
+    layout.GetObjects().RemoveObject("MyObject1");
+    layout.GetInitialInstances().InsertNewInitialInstance().SetX(100);
+    layout.GetVariables().Get("MyVariable").SetValue(2);
+    layout.SetBackgroundColor(backgroundColorRed + 1, 2, 3);
+
+    snapshot.RestoreTo(project, layout);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 5);
+    REQUIRE(GetActionParameter(layout, 0) == "0");
+    REQUIRE(layout.GetObjects().GetObjectsCount() == 3);
+    REQUIRE(layout.GetObjects().HasObjectNamed("MyObject1"));
+    REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 10);
+    REQUIRE(layout.GetVariables().Get("MyVariable").GetValue() == 1);
+    REQUIRE(layout.GetBackgroundColorRed() == backgroundColorRed);
+  }
+
+  SECTION("Unchanged elements are shared with the previous snapshot") {
+    gd::LayoutSnapshot snapshot1 = gd::LayoutSnapshot::Take(layout);
+
+    auto& modifiedEvent =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().GetEvent(1));
+    modifiedEvent.GetActions().Get(0).SetParameter(0, "42");
+    auto& modifiedInstance =
+        *std::next(layout.GetInitialInstances().GetInternalList().begin(), 3);
+    modifiedInstance.SetX(300);
+    layout.GetEvents().RemoveEvent(0);
+    auto& insertedObject = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyInsertedObject", 0);
+
+    gd::LayoutChanges changes;
+    changes.MarkEvent(modifiedEvent)
+        .MarkInstance(modifiedInstance)
+        .MarkObject(insertedObject);
+    gd::LayoutSnapshot snapshot2 =
+        gd::LayoutSnapshot::Take(layout, snapshot1, changes);
+
+    REQUIRE(snapshot2.GetEventsCount() == 4);
+    REQUIRE(&snapshot2.GetEventElement(0) != &snapshot1.GetEventElement(1));
+    REQUIRE(&snapshot2.GetEventElement(1) == &snapshot1.GetEventElement(2));
+    REQUIRE(&snapshot2.GetEventElement(3) == &snapshot1.GetEventElement(4));
+
+    REQUIRE(snapshot2.GetObjectsCount() == 4);
+    REQUIRE(&snapshot2.GetObjectElement(1) == &snapshot1.GetObjectElement(0));
+    REQUIRE(&snapshot2.GetInstanceElement(0) ==
+            &snapshot1.GetInstanceElement(0));
+    REQUIRE(&snapshot2.GetInstanceElement(3) !=
+            &snapshot1.GetInstanceElement(3));
+
+    // Each snapshot restores its own version of the layout.
+    snapshot1.RestoreTo(project, layout);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 5);
+    REQUIRE(GetActionParameter(layout, 1) == "1");
+    REQUIRE(!layout.GetObjects().HasObjectNamed("MyInsertedObject"));
+
+    snapshot2.RestoreTo(project, layout);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 4);
+    REQUIRE(GetActionParameter(layout, 0) == "42");
+    REQUIRE(layout.GetObjects().HasObjectNamed("MyInsertedObject"));
+    REQUIRE(std::next(layout.GetInitialInstances().GetInternalList().begin(), 3)
+                ->GetX() == 300);
+  }
+
+  SECTION("Elements are not shared with a snapshot taken before a restore") {
+    gd::LayoutSnapshot snapshot1 = gd::LayoutSnapshot::Take(layout);
+    auto& event =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().GetEvent(0));
+    event.GetActions().Get(0).SetParameter(0, "42");
+    gd::LayoutChanges changes;
+    changes.MarkEvent(event);
+    gd::LayoutSnapshot snapshot2 =
+        gd::LayoutSnapshot::Take(layout, snapshot1, changes);
+
+    // Restored elements can be at the addresses of the previous ones.
+    std::uint64_t elementsGeneration = layout.GetElementsGeneration();
+    snapshot1.RestoreTo(project, layout);
+    REQUIRE(layout.GetElementsGeneration() != elementsGeneration);
+    REQUIRE(GetActionParameter(layout, 0) == "0");
+
+    gd::LayoutSnapshot snapshot3 =
+        gd::LayoutSnapshot::Take(layout, snapshot2, gd::LayoutChanges());
+    REQUIRE(&snapshot3.GetEventElement(1) != &snapshot2.GetEventElement(1));
+    snapshot3.RestoreTo(project, layout);
+    REQUIRE(GetActionParameter(layout, 0) == "0");
+  }
+}
+
+TEST_CASE("LayoutSnapshot - Benchmarks", "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  FillLayout(project, layout, 200, 10000, 2000);
+
+  DoBenchmark("Layout copy", 5, [&]() {
+    gd::Layout copiedLayout = layout;
+    REQUIRE(copiedLayout.GetInitialInstances().GetInstancesCount() == 10000);
+  });
+
+  gd::LayoutSnapshot snapshot;
+  DoBenchmark("Layout full snapshot", 5, [&]() {
+    snapshot = gd::LayoutSnapshot::Take(layout);
+  });
+
+  DoBenchmark("Layout snapshot after an edit", 5, [&]() {
+    auto& event = layout.GetEvents().GetEvent(10);
+    event.SetDisabled(!event.IsDisabled());
+    snapshot = gd::LayoutSnapshot::Take(
+        layout, snapshot, gd::LayoutChanges().MarkEvent(event));
+    REQUIRE(snapshot.GetInstancesCount() == 10000);
+  });
+}
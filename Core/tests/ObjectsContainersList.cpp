@@ -7,6 +7,7 @@
  * @file Tests covering layout content helper methods.
  */
 #include "GDCore/Project/ObjectsContainersList.h"
+#include "BenchmarkTools.h"
 #include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
@@ -486,3 +487,93 @@ TEST_CASE("ObjectContainersList (GetAnimationNamesOfObject)", "[common]") {
     REQUIRE(animationNames.size() == 2);
   }
 }
+
+TEST_CASE("ObjectContainersList (cached resolution)", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+  gd::Object &object1 = layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyObject1", 0);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyObject2", 0);
+  auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+  group.AddObject("MyObject1");
+  group.AddObject("MyObject2");
+
+  auto objectsContainersList = gd::ObjectsContainersList::
+      MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+  REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+          "MyExtension::Sprite");
+  REQUIRE(!objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                            "MyBehavior"));
+  REQUIRE(objectsContainersList.HasObjectNamed("MyObject2"));
+
+  SECTION("Results are updated after changes in the containers") {
+    layout.GetObjects().InsertNewObject(
+        project, "FakeObjectWithDefaultBehavior", "MyObject3", 0);
+    layout.GetObjects().GetObjectGroups().Get("MyGroup").AddObject(
+        "MyObject3");
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") == "");
+
+    layout.GetObjects().GetObjectGroups().Get("MyGroup").RemoveObject(
+        "MyObject3");
+    for (const gd::String &objectName : {"MyObject1", "MyObject2"}) {
+      layout.GetObjects().GetObject(objectName).AddNewBehavior(
+          project, "MyExtension::MyBehavior", "MyBehavior");
+    }
+    REQUIRE(objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                             "MyBehavior"));
+    REQUIRE(objectsContainersList.GetTypeOfBehaviorInObjectOrGroup(
+                "MyGroup", "MyBehavior") == "MyExtension::MyBehavior");
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").size() == 1);
+
+    layout.GetObjects().GetObject("MyObject2").SetName("MyRenamedObject");
+    REQUIRE(!objectsContainersList.HasObjectNamed("MyObject2"));
+    REQUIRE(objectsContainersList.HasObjectNamed("MyRenamedObject"));
+  }
+
+  SECTION("Results are updated after marking a container as modified") {
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyObject1").empty());
+
+    // The object is modified through a reference obtained before the results
+    // were cached.
+    object1.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    layout.GetObjects().MarkAsModified();
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyObject1").size() ==
+            1);
+  }
+}
+
+TEST_CASE("ObjectContainersList - Benchmarks", "[.][benchmark][common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+  auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+  for (std::size_t i = 0; i < 300; ++i) {
+    gd::Object &object = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject" + gd::String::From(i), i);
+    object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    group.AddObject(object.GetName());
+  }
+
+  auto objectsContainersList = gd::ObjectsContainersList::
+      MakeNewObjectsContainersListForProjectAndLayout(project, layout);
+
+  auto resolveGroup = [&]() {
+    REQUIRE(objectsContainersList.GetTypeOfObject("MyGroup") ==
+            "MyExtension::Sprite");
+    REQUIRE(objectsContainersList.HasBehaviorInObjectOrGroup("MyGroup",
+                                                             "MyBehavior"));
+    REQUIRE(objectsContainersList.GetBehaviorsOfObject("MyGroup").size() == 1);
+  };
+
+  DoBenchmark("Group resolution after a modification", 20, [&]() {
+    layout.GetObjects().MarkAsModified();
+    resolveGroup();
+  });
+  DoBenchmark("Cached group resolution", 20, resolveGroup);
+}
@@ -0,0 +1,117 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the extensions of a platform declared the first time
+ * they are needed.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+std::shared_ptr<gd::PlatformExtension> CreateDeferredExtension(
+    const gd::String& name, std::size_t& creationsCount) {
+  creationsCount++;
+
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(
+      name, "Deferred extension", "An extension for tests", "", "");
+  extension->AddObject<gd::ObjectConfiguration>(
+      "MyObject", "Deferred object", "An object for tests", "");
+  extension->AddAction("DoSomething",
+                       "Do something",
+                       "Do something for tests",
+                       "Do something",
+                       "",
+                       "",
+                       "");
+  return extension;
+}
+
+bool HasAction(const gd::Platform& platform, const gd::String& type) {
+  return !gd::MetadataProvider::IsBadInstructionMetadata(
+      gd::MetadataProvider::GetActionMetadata(platform, type));
+}
+
+}  // namespace
+
+TEST_CASE("Platform deferred extensions", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  std::size_t declaredExtensionsCount =
+      platform.GetDeclaredPlatformExtensions().size();
+
+  std::size_t firstCreationsCount = 0;
+  std::size_t secondCreationsCount = 0;
+  platform.AddDeferredExtension(
+      "FirstDeferredExtension", {"FirstDeferredExtension"}, [&]() {
+        return CreateDeferredExtension("FirstDeferredExtension",
+                                       firstCreationsCount);
+      });
+  platform.AddDeferredExtension(
+      "SecondDeferredExtension", {"SecondDeferredExtension"}, [&]() {
+        return CreateDeferredExtension("SecondDeferredExtension",
+                                       secondCreationsCount);
+      });
+
+  SECTION("Extensions are only created when needed") {
+    REQUIRE(platform.IsExtensionLoaded("FirstDeferredExtension"));
+    REQUIRE(platform.GetDeclaredPlatformExtensions().size() ==
+            declaredExtensionsCount);
+
+    // Searching types of other extensions doesn't create them.
+    REQUIRE(HasAction(platform, "MyExtension::DoSomething"));
+    REQUIRE(firstCreationsCount == 0);
+
+    REQUIRE(HasAction(platform, "SecondDeferredExtension::DoSomething"));
+    REQUIRE(firstCreationsCount == 0);
+    REQUIRE(secondCreationsCount == 1);
+
+    auto configuration = platform.CreateObjectConfiguration(
+        "FirstDeferredExtension::MyObject");
+    REQUIRE(configuration->GetType() == "FirstDeferredExtension::MyObject");
+    REQUIRE(firstCreationsCount == 1);
+
+    REQUIRE(!gd::MetadataProvider::IsBadObjectMetadata(
+        gd::MetadataProvider::GetObjectMetadata(
+            platform, "FirstDeferredExtension::MyObject")));
+    REQUIRE(platform.GetAllPlatformExtensions().size() ==
+            declaredExtensionsCount + 2);
+    REQUIRE(firstCreationsCount == 1);
+    REQUIRE(secondCreationsCount == 1);
+  }
+
+  SECTION("Extensions are created when searched by name") {
+    REQUIRE(platform.GetExtension("SecondDeferredExtension")->GetName() ==
+            "SecondDeferredExtension");
+    REQUIRE(firstCreationsCount == 0);
+    REQUIRE(secondCreationsCount == 1);
+  }
+
+  SECTION("All extensions are created when listed") {
+    REQUIRE(platform.GetAllPlatformExtensions().size() ==
+            declaredExtensionsCount + 2);
+    REQUIRE(firstCreationsCount == 1);
+    REQUIRE(secondCreationsCount == 1);
+  }
+
+  SECTION("Deferred extensions can be removed") {
+    platform.RemoveExtension("FirstDeferredExtension");
+    REQUIRE(!platform.IsExtensionLoaded("FirstDeferredExtension"));
+    REQUIRE(!HasAction(platform, "FirstDeferredExtension::DoSomething"));
+    REQUIRE(platform.GetAllPlatformExtensions().size() ==
+            declaredExtensionsCount + 1);
+    REQUIRE(firstCreationsCount == 0);
+  }
+}
@@ -0,0 +1,146 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the pool used to allocate instructions.
+ */
+#include "GDCore/Tools/PoolAllocator.h"
+
+#include <vector>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+class InstructionsCounter : public gd::ReadOnlyArbitraryEventsWorker {
+ public:
+  InstructionsCounter() : instructionsCount(0), parametersCount(0){};
+  virtual ~InstructionsCounter(){};
+
+  std::size_t instructionsCount;
+  std::size_t parametersCount;
+
+ private:
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    instructionsCount++;
+    for (const auto& parameter : instruction.GetParameters())
+      parametersCount += parameter.GetPlainString().size();
+  }
+};
+
+}  // namespace
+
+TEST_CASE("PoolAllocator", "[common]") {
+  SECTION("Blocks are reused") {
+    std::size_t allocatedBlocksCount = gd::MemoryPool::GetAllocatedBlocksCount();
+    {
+      auto value = std::allocate_shared<double>(gd::PoolAllocator<double>(), 4);
+      REQUIRE(*value == 4);
+      REQUIRE(gd::MemoryPool::GetAllocatedBlocksCount() ==
+              allocatedBlocksCount + 1);
+    }
+    REQUIRE(gd::MemoryPool::GetAllocatedBlocksCount() == allocatedBlocksCount);
+    REQUIRE(gd::MemoryPool::GetReservedBytesCount() > 0);
+  }
+
+  SECTION("Empty chunks are given back") {
+    // Blocks of the biggest size class, which instructions don't use.
+    const std::size_t blockSize = 512;
+    std::size_t reservedBytesCount = gd::MemoryPool::GetReservedBytesCount();
+
+    std::vector<void *> blocks;
+    for (std::size_t i = 0; i < 1000; ++i)
+      blocks.push_back(gd::MemoryPool::Allocate(blockSize));
+    REQUIRE(gd::MemoryPool::GetReservedBytesCount() >=
+            reservedBytesCount + 1000 * blockSize);
+
+    // Chunks still having an allocated block are kept.
+    for (std::size_t i = 1; i < blocks.size(); ++i)
+      gd::MemoryPool::Deallocate(blocks[i], blockSize);
+    REQUIRE(gd::MemoryPool::GetReservedBytesCount() <=
+            reservedBytesCount + 2 * 64 * 1024);
+    REQUIRE(gd::MemoryPool::GetReservedBytesCount() > reservedBytesCount);
+
+    gd::MemoryPool::Deallocate(blocks[0], blockSize);
+    REQUIRE(gd::MemoryPool::GetReservedBytesCount() <=
+            reservedBytesCount + 64 * 1024);
+
+    // Blocks can still be allocated after chunks were given back.
+    void *block = gd::MemoryPool::Allocate(blockSize);
+    REQUIRE(block != nullptr);
+    gd::MemoryPool::Deallocate(block, blockSize);
+  }
+
+  SECTION("Instructions are moved or copied into lists") {
+    gd::InstructionsList instructions;
+    gd::Instruction instruction("MyExtension::DoSomething",
+                                std::vector<gd::Expression>{"1", "2"});
+    instruction.GetSubInstructions().Insert(
+        gd::Instruction("MyExtension::DoSomethingElse"));
+
+    gd::Instruction& copiedInstruction = instructions.Insert(instruction);
+    REQUIRE(copiedInstruction.GetParametersCount() == 2);
+    REQUIRE(instruction.GetParametersCount() == 2);
+
+    gd::Instruction& movedInstruction =
+        instructions.Insert(std::move(instruction), 0);
+    REQUIRE(&instructions.Get(0) == &movedInstruction);
+    REQUIRE(movedInstruction.GetType() == "MyExtension::DoSomething");
+    REQUIRE(movedInstruction.GetParameter(1).GetPlainString() == "2");
+    REQUIRE(movedInstruction.GetSubInstructions().size() == 1);
+
+    gd::InstructionsList copiedInstructions = instructions;
+    REQUIRE(copiedInstructions.size() == 2);
+    REQUIRE(&copiedInstructions.Get(1) != &instructions.Get(1));
+    REQUIRE(copiedInstructions.Get(1).GetSubInstructions().Get(0).GetType() ==
+            "MyExtension::DoSomethingElse");
+  }
+}
+
+TEST_CASE("PoolAllocator - Benchmarks", "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  for (std::size_t i = 0; i < 2000; ++i) {
+    gd::StandardEvent& event =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().InsertNewEvent(
+            project, "BuiltinCommonInstructions::Standard"));
+    for (std::size_t j = 0; j < 5; ++j) {
+      event.GetConditions().Insert(gd::Instruction(
+          "MyExtension::DoSomething", std::vector<gd::Expression>{"1 + 2"}));
+      event.GetActions().Insert(gd::Instruction(
+          "MyExtension::DoSomething", std::vector<gd::Expression>{"3 + 4"}));
+    }
+  }
+  gd::SerializerElement element;
+  layout.SerializeTo(element);
+
+  SECTION("Events load and traversal") {
+    gd::Layout loadedLayout;
+    DoBenchmark("Events load", 3, [&]() {
+      loadedLayout.UnserializeFrom(project, element);
+    });
+
+    DoBenchmark("Events traversal", 20, [&]() {
+      InstructionsCounter counter;
+      counter.Launch(loadedLayout.GetEvents());
+      REQUIRE(counter.instructionsCount == 20000);
+      REQUIRE(counter.parametersCount == 100000);
+    });
+  }
+}
@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lazy loading of the layouts of a project.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/ParallelTasks.h"
+#include "catch.hpp"
+
+TEST_CASE("Project lazy layouts loading", "[common]") {
+  gd::Platform platform;
+  gd::Project writtenProject;
+  SetupProjectWithDummyPlatform(writtenProject, platform);
+  auto &layout1 = writtenProject.InsertNewLayout("Scene1", 0);
+  layout1.GetObjects().InsertNewObject(
+      writtenProject, "MyExtension::Sprite", "MyObject1", 0);
+  auto &layout2 = writtenProject.InsertNewLayout("Scene2", 1);
+  layout2.GetObjects().InsertNewObject(
+      writtenProject, "MyExtension::Sprite", "MyObject2", 0);
+
+  gd::SerializerElement projectElement;
+  writtenProject.SerializeTo(projectElement);
+
+  gd::Project project;
+  project.AddPlatform(platform);
+  project.SetLazyLayoutsLoading(true);
+  project.UnserializeFrom(projectElement);
+
+  SECTION("Layouts are loaded when accessed") {
+    REQUIRE(project.GetLayoutsCount() == 2);
+    REQUIRE(project.HasLayoutNamed("Scene1"));
+    REQUIRE(project.GetLayoutPosition("Scene2") == 1);
+    REQUIRE(!project.IsLayoutLoaded("Scene1"));
+    REQUIRE(!project.IsLayoutLoaded("Scene2"));
+
+    auto &layout = project.GetLayout("Scene2");
+    REQUIRE(project.IsLayoutLoaded("Scene2"));
+    REQUIRE(!project.IsLayoutLoaded("Scene1"));
+    REQUIRE(layout.GetName() == "Scene2");
+    REQUIRE(layout.GetObjects().HasObjectNamed("MyObject2"));
+
+    REQUIRE(project.GetLayout(0).GetObjects().HasObjectNamed("MyObject1"));
+    REQUIRE(project.IsLayoutLoaded("Scene1"));
+  }
+
+  SECTION("Elements of layouts not loaded are shared, not copied") {
+    auto &layoutsElement = projectElement.GetChild("layouts");
+    layoutsElement.ConsiderAsArrayOf("layout");
+    auto layoutElement = layoutsElement.GetSharedChild(0);
+    // Owned by the project element, the project and this test.
+    REQUIRE(layoutElement.use_count() == 3);
+
+    project.GetLayout(0);
+    REQUIRE(layoutElement.use_count() == 2);
+  }
+
+  SECTION("Layouts can be loaded from several threads") {
+    const gd::Project &constProject = project;
+    std::vector<int> hasObjects(16, false);
+    std::vector<std::function<void()>> tasks;
+    for (std::size_t i = 0; i < hasObjects.size(); ++i) {
+      tasks.push_back([&constProject, &hasObjects, i]() {
+        const gd::String objectName = i % 2 ? "MyObject2" : "MyObject1";
+        hasObjects[i] =
+            constProject.GetLayout(i % 2).GetObjects().HasObjectNamed(
+                objectName);
+      });
+    }
+    gd::ParallelTasks::Run(tasks, 4);
+
+    for (int hasObject : hasObjects) REQUIRE(hasObject);
+    REQUIRE(project.IsLayoutLoaded("Scene1"));
+    REQUIRE(project.IsLayoutLoaded("Scene2"));
+  }
+
+  SECTION("Layouts not loaded are serialized unchanged") {
+    project.GetLayout("Scene1").GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyNewObject", 1);
+
+    gd::SerializerElement element;
+    project.SerializeTo(element);
+    REQUIRE(!project.IsLayoutLoaded("Scene2"));
+
+    gd::Project readProject;
+    readProject.AddPlatform(platform);
+    readProject.UnserializeFrom(element);
+    REQUIRE(readProject.GetLayout("Scene1").GetObjects().HasObjectNamed(
+        "MyNewObject"));
+    REQUIRE(readProject.GetLayout("Scene2").GetObjects().HasObjectNamed(
+        "MyObject2"));
+  }
+
+  SECTION("Layouts not loaded are kept by copies and removals") {
+    gd::Project copiedProject = project;
+    REQUIRE(!copiedProject.IsLayoutLoaded("Scene1"));
+    REQUIRE(copiedProject.GetLayout("Scene1").GetObjects().HasObjectNamed(
+        "MyObject1"));
+    REQUIRE(!project.IsLayoutLoaded("Scene1"));
+
+    project.RemoveLayout("Scene1");
+    REQUIRE(project.GetLayoutsCount() == 1);
+    project.LoadAllLayouts();
+    REQUIRE(project.IsLayoutLoaded("Scene2"));
+    REQUIRE(project.GetLayout(0).GetObjects().HasObjectNamed("MyObject2"));
+  }
+}
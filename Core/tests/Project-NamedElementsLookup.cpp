@@ -0,0 +1,238 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lookup by name of the elements of a project.
+ */
+#include <functional>
+#include <vector>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Tools/ParallelTasks.h"
+#include "catch.hpp"
+
+TEST_CASE("Project named elements lookup", "[common]") {
+  SECTION("Layouts") {
+    gd::Project project;
+    project.InsertNewLayout("Scene1", 0);
+    project.InsertNewLayout("Scene3", 1);
+    project.InsertNewLayout("Scene2", 1);
+    REQUIRE(project.GetLayoutPosition("Scene1") == 0);
+    REQUIRE(project.GetLayoutPosition("Scene2") == 1);
+    REQUIRE(project.GetLayoutPosition("Scene3") == 2);
+    REQUIRE(!project.HasLayoutNamed("Scene4"));
+
+    project.MoveLayout(0, 2);
+    REQUIRE(project.GetLayoutPosition("Scene2") == 0);
+    REQUIRE(project.GetLayoutPosition("Scene3") == 1);
+    REQUIRE(project.GetLayoutPosition("Scene1") == 2);
+
+    project.SwapLayouts(0, 2);
+    REQUIRE(project.GetLayout("Scene1").GetName() == "Scene1");
+    REQUIRE(project.GetLayoutPosition("Scene1") == 0);
+    REQUIRE(project.GetLayoutPosition("Scene2") == 2);
+
+    project.RemoveLayout("Scene3");
+    REQUIRE(project.GetLayoutsCount() == 2);
+    REQUIRE(!project.HasLayoutNamed("Scene3"));
+    REQUIRE(project.GetLayoutPosition("Scene2") == 1);
+
+    // Layouts can be renamed directly.
+    project.GetLayout("Scene2").SetName("RenamedScene");
+    REQUIRE(!project.HasLayoutNamed("Scene2"));
+    REQUIRE(project.HasLayoutNamed("RenamedScene"));
+    REQUIRE(project.GetLayoutPosition("RenamedScene") == 1);
+
+    gd::Project copiedProject = project;
+    REQUIRE(copiedProject.GetLayoutPosition("Scene1") == 0);
+    REQUIRE(copiedProject.GetLayoutPosition("RenamedScene") == 1);
+    REQUIRE(&copiedProject.GetLayout("Scene1") == &copiedProject.GetLayout(0));
+
+    // Renaming a copy of a layout doesn't change the index of the project.
+    gd::Layout copiedLayout = project.GetLayout("Scene1");
+    copiedLayout.SetName("RenamedCopy");
+    REQUIRE(!project.HasLayoutNamed("RenamedCopy"));
+    REQUIRE(project.GetLayoutPosition("Scene1") == 0);
+
+    // Nor does a layout of a copied project.
+    copiedProject.GetLayout("Scene1").SetName("RenamedInCopy");
+    REQUIRE(copiedProject.HasLayoutNamed("RenamedInCopy"));
+    REQUIRE(!project.HasLayoutNamed("RenamedInCopy"));
+    REQUIRE(project.GetLayoutPosition("Scene1") == 0);
+  }
+
+  SECTION("Renamed elements are searched from several threads") {
+    gd::Project project;
+    for (std::size_t i = 0; i < 100; ++i)
+      project.InsertNewLayout("Scene" + gd::String::From(i), i);
+    for (std::size_t i = 0; i < 100; ++i)
+      project.GetLayout(i).SetName("RenamedScene" + gd::String::From(i));
+
+    std::vector<int> found(100, 0);
+    std::vector<std::function<void()>> tasks;
+    for (std::size_t i = 0; i < 100; ++i) {
+      tasks.push_back([&project, &found, i]() {
+        found[i] = project.GetLayoutPosition("RenamedScene" +
+                                             gd::String::From(i)) == i &&
+                   !project.HasLayoutNamed("Scene" + gd::String::From(i));
+      });
+    }
+    gd::ParallelTasks::Run(tasks, 4);
+    for (std::size_t i = 0; i < 100; ++i) REQUIRE(found[i] == 1);
+  }
+
+  SECTION("External events and external layouts") {
+    gd::Project project;
+    project.InsertNewExternalEvents("Events1", 0);
+    project.InsertNewExternalEvents("Events2", 1);
+    project.InsertNewExternalLayout("ExternalLayout1", 0);
+    project.InsertNewExternalLayout("ExternalLayout2", 0);
+
+    REQUIRE(project.GetExternalEventsPosition("Events2") == 1);
+    REQUIRE(project.GetExternalLayoutPosition("ExternalLayout1") == 1);
+
+    project.SwapExternalEvents(0, 1);
+    project.MoveExternalLayout(1, 0);
+    REQUIRE(project.GetExternalEventsPosition("Events2") == 0);
+    REQUIRE(project.GetExternalLayoutPosition("ExternalLayout1") == 0);
+
+    project.RemoveExternalEvents("Events2");
+    project.RemoveExternalLayout("ExternalLayout1");
+    REQUIRE(!project.HasExternalEventsNamed("Events2"));
+    REQUIRE(project.GetExternalEventsPosition("Events1") == 0);
+    REQUIRE(!project.HasExternalLayoutNamed("ExternalLayout1"));
+    REQUIRE(project.GetExternalLayout("ExternalLayout2").GetName() ==
+            "ExternalLayout2");
+
+    project.GetExternalEvents("Events1").SetName("RenamedEvents");
+    project.GetExternalLayout("ExternalLayout2").SetName("RenamedLayout");
+    REQUIRE(!project.HasExternalEventsNamed("Events1"));
+    REQUIRE(project.GetExternalEventsPosition("RenamedEvents") == 0);
+    REQUIRE(!project.HasExternalLayoutNamed("ExternalLayout2"));
+    REQUIRE(project.GetExternalLayoutPosition("RenamedLayout") == 0);
+  }
+
+  SECTION("Extensions and events-based behaviors") {
+    gd::Project project;
+    auto &extension1 = project.InsertNewEventsFunctionsExtension("Extension1", 0);
+    extension1.GetEventsBasedBehaviors().InsertNew("MyBehavior", 0);
+    project.InsertNewEventsFunctionsExtension("Extension2", 1);
+
+    REQUIRE(project.HasEventsBasedBehavior("Extension1::MyBehavior"));
+    REQUIRE(!project.HasEventsBasedBehavior("Extension2::MyBehavior"));
+
+    project.MoveEventsFunctionsExtension(0, 1);
+    REQUIRE(project.GetEventsFunctionsExtensionPosition("Extension1") == 1);
+    REQUIRE(&project.GetEventsBasedBehavior("Extension1::MyBehavior") ==
+            &extension1.GetEventsBasedBehaviors().Get(0));
+
+    // Extensions and behaviors can be renamed directly.
+    extension1.SetName("RenamedExtension");
+    extension1.GetEventsBasedBehaviors().Get("MyBehavior").SetName(
+        "RenamedBehavior");
+    REQUIRE(!project.HasEventsBasedBehavior("Extension1::MyBehavior"));
+    REQUIRE(
+        project.HasEventsBasedBehavior("RenamedExtension::RenamedBehavior"));
+
+    project.RemoveEventsFunctionsExtension("Extension2");
+    REQUIRE(project.GetEventsFunctionsExtensionPosition("RenamedExtension") ==
+            0);
+    project.ClearEventsFunctionsExtensions();
+    REQUIRE(!project.HasEventsFunctionsExtensionNamed("RenamedExtension"));
+  }
+
+  SECTION("SerializableWithNameList") {
+    gd::EventsFunctionsExtension extension;
+    auto &behaviors = extension.GetEventsBasedBehaviors();
+    behaviors.InsertNew("Behavior1", 0);
+    behaviors.InsertNew("Behavior3", 1);
+    behaviors.InsertNew("Behavior2", 1);
+    REQUIRE(behaviors.GetPosition(behaviors.Get("Behavior1")) == 0);
+    REQUIRE(behaviors.GetPosition(behaviors.Get("Behavior2")) == 1);
+    REQUIRE(behaviors.GetPosition(behaviors.Get("Behavior3")) == 2);
+
+    behaviors.Move(2, 0);
+    REQUIRE(behaviors.GetPosition(behaviors.Get("Behavior3")) == 0);
+    REQUIRE(behaviors.GetPosition(behaviors.Get("Behavior2")) == 2);
+
+    behaviors.Remove("Behavior1");
+    REQUIRE(!behaviors.Has("Behavior1"));
+    REQUIRE(behaviors.GetPosition(behaviors.Get("Behavior2")) == 1);
+
+    behaviors.Get(1).SetName("RenamedBehavior");
+    REQUIRE(!behaviors.Has("Behavior2"));
+    REQUIRE(behaviors.Get("RenamedBehavior").GetName() == "RenamedBehavior");
+
+    gd::EventsFunctionsExtension copiedExtension = extension;
+    REQUIRE(copiedExtension.GetEventsBasedBehaviors().Has("RenamedBehavior"));
+    REQUIRE(&copiedExtension.GetEventsBasedBehaviors().Get("Behavior3") ==
+            &copiedExtension.GetEventsBasedBehaviors().Get(0));
+
+    behaviors.Clear();
+    REQUIRE(!behaviors.Has("Behavior3"));
+  }
+}
+
+TEST_CASE("Project named elements lookup - Benchmarks",
+          "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  for (std::size_t i = 0; i < 500; ++i) {
+    auto &extension = project.InsertNewEventsFunctionsExtension(
+        "Extension" + gd::String::From(i),
+        project.GetEventsFunctionsExtensionsCount());
+    for (std::size_t j = 0; j < 5; ++j) {
+      extension.GetEventsBasedBehaviors().InsertNew(
+          "Behavior" + gd::String::From(j), j);
+    }
+  }
+  for (std::size_t i = 0; i < 200; ++i) {
+    project.InsertNewLayout("Scene" + gd::String::From(i),
+                            project.GetLayoutsCount());
+  }
+
+  std::vector<gd::String> behaviorTypes;
+  std::vector<gd::String> layoutNames;
+  for (std::size_t i = 0; i < 500; i += 7) {
+    behaviorTypes.push_back("Extension" + gd::String::From(i) + "::Behavior" +
+                            gd::String::From(i % 5));
+  }
+  for (std::size_t i = 0; i < 200; i += 3) {
+    layoutNames.push_back("Scene" + gd::String::From(i));
+  }
+
+  SECTION("Events-based behaviors lookup") {
+    DoBenchmark("Events-based behaviors lookup", 100, [&]() {
+      std::size_t foundCount = 0;
+      for (const auto &behaviorType : behaviorTypes) {
+        if (project.HasEventsBasedBehavior(behaviorType) &&
+            !project.GetEventsBasedBehavior(behaviorType).GetName().empty())
+          foundCount++;
+      }
+      REQUIRE(foundCount == behaviorTypes.size());
+    });
+  }
+
+  SECTION("Layouts lookup") {
+    DoBenchmark("Layouts lookup", 100, [&]() {
+      std::size_t foundCount = 0;
+      for (const auto &layoutName : layoutNames) {
+        if (project.HasLayoutNamed(layoutName) &&
+            project.GetLayout(layoutName).GetName() == layoutName)
+          foundCount++;
+      }
+      REQUIRE(foundCount == layoutNames.size());
+    });
+  }
+}
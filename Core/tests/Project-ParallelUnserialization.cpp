@@ -0,0 +1,92 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the unserialization of a project on several threads.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void InsertEvents(gd::EventsList &events, std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    gd::Instruction action;
+    action.SetType("MyExtension::DoSomething");
+    action.SetParametersCount(1);
+    action.SetParameter(0, gd::Expression(gd::String::From(i) + " + 1"));
+    event.GetActions().Insert(action);
+    events.InsertEvent(event);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Project parallel unserialization", "[common]") {
+  gd::Platform platform;
+  gd::Project writtenProject;
+  SetupProjectWithDummyPlatform(writtenProject, platform);
+  for (std::size_t i = 0; i < 20; ++i) {
+    auto &layout = writtenProject.InsertNewLayout(
+        "Scene" + gd::String::From(i), writtenProject.GetLayoutsCount());
+    for (std::size_t j = 0; j < 10; ++j) {
+      auto &object = layout.GetObjects().InsertNewObject(
+          writtenProject,
+          "MyExtension::Sprite",
+          "MyObject" + gd::String::From(j),
+          j);
+      object.AddNewBehavior(
+          writtenProject, "MyExtension::MyBehavior", "MyBehavior");
+    }
+    InsertEvents(layout.GetEvents(), 10);
+
+    auto &externalEvents = writtenProject.InsertNewExternalEvents(
+        "External" + gd::String::From(i),
+        writtenProject.GetExternalEventsCount());
+    InsertEvents(externalEvents.GetEvents(), 5);
+  }
+
+  gd::SerializerElement projectElement;
+  writtenProject.SerializeTo(projectElement);
+
+  // Compatibility flags are changed when unserializing, so the project
+  // unserialized on several threads is compared to one unserialized on a
+  // single thread.
+  gd::Project expectedProject;
+  expectedProject.AddPlatform(platform);
+  expectedProject.UnserializeFrom(projectElement);
+  gd::SerializerElement expectedElement;
+  expectedProject.SerializeTo(expectedElement);
+  gd::String expectedJson = gd::Serializer::ToJSON(expectedElement);
+
+  gd::Project project;
+  project.AddPlatform(platform);
+  project.SetUnserializationThreadsCount(4);
+  project.UnserializeFrom(projectElement);
+
+  REQUIRE(project.GetLayoutsCount() == 20);
+  REQUIRE(project.GetLayout(7).GetName() == "Scene7");
+  REQUIRE(project.GetLayout(7).GetObjects().GetObjectsCount() == 10);
+  REQUIRE(project.GetLayout(7).GetEvents().GetEventsCount() == 10);
+  REQUIRE(project.GetLayout(7).GetEvents().GetEvent(3).GetType() ==
+          "BuiltinCommonInstructions::Standard");
+  REQUIRE(project.GetExternalEventsCount() == 20);
+  REQUIRE(project.GetExternalEvents(19).GetName() == "External19");
+  REQUIRE(project.GetExternalEvents(19).GetEvents().GetEventsCount() == 5);
+
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+  REQUIRE(gd::Serializer::ToJSON(element) == expectedJson);
+}
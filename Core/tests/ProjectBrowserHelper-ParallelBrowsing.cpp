@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the browsing of the events of a project on several
+ * threads.
+ */
+#include <algorithm>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/InstructionsCountEvaluator.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Tools/ParallelTasks.h"
+#include "catch.hpp"
+
+namespace {
+
+class InstructionsTypesCollector : public gd::ReadOnlyArbitraryEventsWorker {
+ public:
+  InstructionsTypesCollector(){};
+  virtual ~InstructionsTypesCollector(){};
+
+  std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker> CloneForParallelBrowsing()
+      const override {
+    return std::unique_ptr<gd::ReadOnlyArbitraryEventsWorker>(
+        new InstructionsTypesCollector());
+  }
+
+  void MergeParallelResults(gd::ReadOnlyArbitraryEventsWorker& worker) override {
+    auto& collector = static_cast<InstructionsTypesCollector&>(worker);
+    types.insert(types.end(), collector.types.begin(), collector.types.end());
+  }
+
+  std::vector<gd::String> types;
+
+ private:
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    types.push_back(instruction.GetType());
+  }
+};
+
+void AddEvents(gd::EventsList& events,
+               const gd::String& instructionType,
+               std::size_t eventsCount) {
+  for (std::size_t i = 0; i < eventsCount; ++i) {
+    gd::StandardEvent event;
+    event.GetConditions().Insert(gd::Instruction(
+        instructionType, std::vector<gd::Expression>{"1 + 2"}));
+    event.GetActions().Insert(gd::Instruction(
+        instructionType, std::vector<gd::Expression>{"3 + 4"}));
+    events.InsertEvent(event);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("ProjectBrowserHelper - Parallel browsing", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    auto& layout = project.InsertNewLayout("Scene" + gd::String::From(i), i);
+    AddEvents(layout.GetEvents(), "Scene" + gd::String::From(i), 3);
+  }
+  auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+  AddEvents(externalEvents.GetEvents(), "External", 2);
+  auto& extension = project.InsertNewEventsFunctionsExtension("Extension", 0);
+  auto& eventsFunction =
+      extension.InsertNewEventsFunction("Function", 0);
+  AddEvents(eventsFunction.GetEvents(), "Function", 1);
+
+  InstructionsTypesCollector sequentialCollector;
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, sequentialCollector);
+  REQUIRE(sequentialCollector.types.size() == 2 * (10 * 3 + 2 + 1));
+
+  SECTION("Results are merged in the order of the events") {
+    for (std::size_t threadsCount : {1, 2, 3, 8, 64}) {
+      InstructionsTypesCollector collector;
+      gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+          project, collector, threadsCount);
+      REQUIRE(collector.types == sequentialCollector.types);
+    }
+  }
+
+  SECTION("Extensions can be excluded") {
+    InstructionsTypesCollector collector;
+    gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensionsInParallel(
+        project, collector, 4);
+    REQUIRE(collector.types.size() == 2 * (10 * 3 + 2));
+    REQUIRE(collector.types.back() == "External");
+    REQUIRE(gd::InstructionsCountEvaluator::ScanProject(project) ==
+            2 * (10 * 3 + 2));
+  }
+}
+
+TEST_CASE("ProjectBrowserHelper - Parallel browsing - Benchmarks",
+          "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  for (std::size_t i = 0; i < 64; ++i) {
+    auto& layout = project.InsertNewLayout("Scene" + gd::String::From(i), i);
+    AddEvents(layout.GetEvents(), "MyExtension::DoSomething", 1000);
+  }
+
+  std::size_t maxThreadsCount =
+      std::max<std::size_t>(2, gd::ParallelTasks::GetHardwareThreadsCount());
+  for (std::size_t threadsCount = 1;; threadsCount *= 2) {
+    threadsCount = std::min(threadsCount, maxThreadsCount);
+    DoBenchmark("Project events browsing with " +
+                    gd::String::From(threadsCount) + " thread(s)",
+                5,
+                [&]() {
+                  InstructionsTypesCollector collector;
+                  gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+                      project, collector, threadsCount);
+                  REQUIRE(collector.types.size() == 64 * 1000 * 2);
+                });
+    if (threadsCount == maxThreadsCount) break;
+  }
+}
@@ -0,0 +1,265 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the graph of the dependencies of a project.
+ */
+#include "GDCore/IDE/ProjectDependencyGraph.h"
+
+#include <algorithm>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+void InsertAction(gd::EventsList &events, const gd::String &type,
+                  const gd::String &parameter = "") {
+  gd::StandardEvent standardEvent;
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, parameter);
+  standardEvent.GetActions().Insert(instruction);
+  events.InsertEvent(standardEvent);
+}
+
+void InsertLink(gd::EventsList &events, const gd::String &target) {
+  gd::LinkEvent linkEvent;
+  linkEvent.SetTarget(target);
+  events.InsertEvent(linkEvent);
+}
+
+gd::ProjectDependencyNode Layout(const gd::String &name) {
+  return gd::ProjectDependencyNode(gd::ProjectDependencyNode::LayoutNode,
+                                   name);
+}
+
+gd::ProjectDependencyNode ExternalEvents(const gd::String &name) {
+  return gd::ProjectDependencyNode(
+      gd::ProjectDependencyNode::ExternalEventsNode, name);
+}
+
+gd::ProjectDependencyNode Extension(const gd::String &name) {
+  return gd::ProjectDependencyNode(
+      gd::ProjectDependencyNode::EventsFunctionsExtensionNode, name);
+}
+
+gd::ProjectDependencyNode Behavior(const gd::String &type) {
+  return gd::ProjectDependencyNode(
+      gd::ProjectDependencyNode::EventsBasedBehaviorNode, type);
+}
+
+gd::ProjectDependencyNode Object(const gd::String &type) {
+  return gd::ProjectDependencyNode(
+      gd::ProjectDependencyNode::EventsBasedObjectNode, type);
+}
+
+gd::ProjectDependencyNode Resource(const gd::String &name) {
+  return gd::ProjectDependencyNode(gd::ProjectDependencyNode::ResourceNode,
+                                   name);
+}
+
+bool Contains(const std::vector<gd::ProjectDependencyNode> &nodes,
+              const gd::ProjectDependencyNode &node) {
+  return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+}
+
+std::size_t PositionOf(const std::vector<gd::ProjectDependencyNode> &nodes,
+                       const gd::ProjectDependencyNode &node) {
+  return std::find(nodes.begin(), nodes.end(), node) - nodes.begin();
+}
+
+}  // namespace
+
+TEST_CASE("ProjectDependencyGraph", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  project.GetResourcesManager().AddResource("res1", "path/to/file1.png",
+                                            "image");
+
+  // An extension with a function, a behavior and an object, used by another
+  // extension.
+  auto &extension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  extension.InsertNewEventsFunction("MyFunction", 0);
+  extension.GetEventsBasedBehaviors().InsertNew("MyBehavior", 0);
+  extension.GetEventsBasedObjects().InsertNew("MyObject", 0);
+
+  auto &otherExtension =
+      project.InsertNewEventsFunctionsExtension("OtherExtension", 1);
+  auto &otherFunction = otherExtension.InsertNewEventsFunction("OtherFunction", 0);
+  InsertAction(otherFunction.GetEvents(), "MyEventsExtension::MyFunction");
+
+  // A scene using the object and the behavior, a resource and linking to
+  // external events using the other extension.
+  auto &scene1 = project.InsertNewLayout("Scene1", 0);
+  auto &object = scene1.GetObjects().InsertNewObject(
+      project, "MyEventsExtension::MyObject", "MyCustomObject", 0);
+  object.AddNewBehavior(project, "MyEventsExtension::MyBehavior",
+                        "MyBehavior");
+  InsertLink(scene1.GetEvents(), "MyExternalEvents");
+  InsertAction(scene1.GetEvents(), "MyExtension::DoSomethingWithResources",
+               "res1");
+
+  auto &externalEvents =
+      project.InsertNewExternalEvents("MyExternalEvents", 0);
+  InsertAction(externalEvents.GetEvents(), "OtherExtension::OtherFunction");
+
+  // Two scenes linking to each other and an external layout.
+  auto &scene2 = project.InsertNewLayout("Scene2", 1);
+  auto &scene3 = project.InsertNewLayout("Scene3", 2);
+  InsertLink(scene2.GetEvents(), "Scene3");
+  InsertLink(scene3.GetEvents(), "Scene2");
+  auto &externalLayout = project.InsertNewExternalLayout("MyExternalLayout", 0);
+  externalLayout.SetAssociatedLayout("Scene2");
+
+  gd::ProjectDependencyGraph graph;
+  graph.AnalyzeWholeProject(project);
+
+  SECTION("Find the dependencies of each part of the project") {
+    auto &scene1Dependencies = graph.GetDependencies(Layout("Scene1"));
+    REQUIRE(scene1Dependencies.size() == 4);
+    REQUIRE(scene1Dependencies.count(ExternalEvents("MyExternalEvents")) == 1);
+    REQUIRE(scene1Dependencies.count(
+                Object("MyEventsExtension::MyObject")) == 1);
+    REQUIRE(scene1Dependencies.count(
+                Behavior("MyEventsExtension::MyBehavior")) == 1);
+    REQUIRE(scene1Dependencies.count(Resource("res1")) == 1);
+
+    REQUIRE(graph.GetDependencies(ExternalEvents("MyExternalEvents")) ==
+            std::set<gd::ProjectDependencyNode>{Extension("OtherExtension")});
+    REQUIRE(graph.GetDependencies(Extension("OtherExtension")) ==
+            std::set<gd::ProjectDependencyNode>{
+                Extension("MyEventsExtension")});
+    REQUIRE(graph.GetDependencies(Behavior("MyEventsExtension::MyBehavior")) ==
+            std::set<gd::ProjectDependencyNode>{
+                Extension("MyEventsExtension")});
+    REQUIRE(graph.GetDependencies(Extension("MyEventsExtension")).empty());
+    REQUIRE(graph.GetDependencies(
+                gd::ProjectDependencyNode(
+                    gd::ProjectDependencyNode::ExternalLayoutNode,
+                    "MyExternalLayout")) ==
+            std::set<gd::ProjectDependencyNode>{Layout("Scene2")});
+
+    REQUIRE(graph.GetDependents(Extension("MyEventsExtension")).size() == 3);
+    REQUIRE(graph.GetDependents(Resource("res1")) ==
+            std::set<gd::ProjectDependencyNode>{Layout("Scene1")});
+  }
+
+  SECTION("Sort the nodes after their dependencies") {
+    auto nodes = graph.GetTopologicalOrder();
+    REQUIRE(nodes.size() == 10);
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+      if (nodes[i] == Layout("Scene2") || nodes[i] == Layout("Scene3") ||
+          nodes[i].GetType() == gd::ProjectDependencyNode::ExternalLayoutNode)
+        continue;
+
+      for (const auto &dependency : graph.GetDependencies(nodes[i])) {
+        REQUIRE(PositionOf(nodes, dependency) < i);
+      }
+    }
+
+    // Nodes of a cycle (and nodes depending on them) are at the end.
+    REQUIRE(PositionOf(nodes, Layout("Scene2")) >= 7);
+    REQUIRE(PositionOf(nodes, Layout("Scene3")) >= 7);
+  }
+
+  SECTION("Find the nodes affected by an extension change") {
+    std::size_t version = graph.GetVersion();
+    REQUIRE(graph.GetDirtyNodesSince(version).empty());
+
+    graph.UpdateEventsFunctionsExtension(project, extension);
+
+    auto dirtyNodes = graph.GetDirtyNodesSince(version);
+    REQUIRE(dirtyNodes.size() == 6);
+    REQUIRE(Contains(dirtyNodes, Extension("MyEventsExtension")));
+    REQUIRE(Contains(dirtyNodes, Behavior("MyEventsExtension::MyBehavior")));
+    REQUIRE(Contains(dirtyNodes, Object("MyEventsExtension::MyObject")));
+    REQUIRE(Contains(dirtyNodes, Extension("OtherExtension")));
+    REQUIRE(Contains(dirtyNodes, ExternalEvents("MyExternalEvents")));
+    REQUIRE(Contains(dirtyNodes, Layout("Scene1")));
+    REQUIRE(PositionOf(dirtyNodes, Extension("OtherExtension")) <
+            PositionOf(dirtyNodes, ExternalEvents("MyExternalEvents")));
+    REQUIRE(PositionOf(dirtyNodes, ExternalEvents("MyExternalEvents")) <
+            PositionOf(dirtyNodes, Layout("Scene1")));
+
+    REQUIRE(graph.GetDirtyNamesSince(gd::ProjectDependencyNode::LayoutNode,
+                                     version) ==
+            std::vector<gd::String>{"Scene1"});
+  }
+
+  SECTION("Find the nodes affected by a resource or a scene change") {
+    std::size_t version = graph.GetVersion();
+    graph.MarkAsModified(Resource("res1"));
+    REQUIRE(graph.GetDirtyNamesSince(gd::ProjectDependencyNode::LayoutNode,
+                                     version) ==
+            std::vector<gd::String>{"Scene1"});
+
+    version = graph.GetVersion();
+    graph.UpdateLayout(project, scene3);
+    auto dirtyNodes = graph.GetDirtyNodesSince(version);
+    REQUIRE(dirtyNodes.size() == 3);
+    REQUIRE(Contains(dirtyNodes, Layout("Scene2")));
+    REQUIRE(Contains(dirtyNodes, Layout("Scene3")));
+    REQUIRE(Contains(dirtyNodes,
+                     gd::ProjectDependencyNode(
+                         gd::ProjectDependencyNode::ExternalLayoutNode,
+                         "MyExternalLayout")));
+  }
+
+  SECTION("Update the dependencies of a modified part") {
+    std::size_t version = graph.GetVersion();
+    scene1.GetEvents().RemoveEvent(0);
+    object.RemoveBehavior("MyBehavior");
+    graph.UpdateLayout(project, scene1);
+
+    REQUIRE(graph.GetDependencies(Layout("Scene1")).size() == 2);
+    REQUIRE(graph.GetDependents(ExternalEvents("MyExternalEvents")).empty());
+    REQUIRE(graph.GetDependents(Behavior("MyEventsExtension::MyBehavior"))
+                .empty());
+    REQUIRE(graph.GetDirtyNodesSince(version) ==
+            std::vector<gd::ProjectDependencyNode>{Layout("Scene1")});
+  }
+
+  SECTION("Remove parts of the project") {
+    std::size_t version = graph.GetVersion();
+    project.RemoveExternalEvents("MyExternalEvents");
+    graph.RemoveExternalEvents("MyExternalEvents");
+
+    // The scene still links to the external events.
+    REQUIRE(graph.HasNode(ExternalEvents("MyExternalEvents")));
+    REQUIRE(graph.GetDependencies(ExternalEvents("MyExternalEvents")).empty());
+    REQUIRE(graph.GetDirtyNamesSince(gd::ProjectDependencyNode::LayoutNode,
+                                     version) ==
+            std::vector<gd::String>{"Scene1"});
+
+    version = graph.GetVersion();
+    extension.GetEventsBasedBehaviors().Remove("MyBehavior");
+    graph.UpdateEventsFunctionsExtension(project, extension);
+    REQUIRE(graph.GetDependencies(Behavior("MyEventsExtension::MyBehavior"))
+                .empty());
+    REQUIRE(Contains(graph.GetDirtyNodesSince(version), Layout("Scene1")));
+
+    project.RemoveEventsFunctionsExtension("OtherExtension");
+    graph.RemoveEventsFunctionsExtension("OtherExtension");
+    REQUIRE(!graph.HasNode(Extension("OtherExtension")));
+    REQUIRE(graph.GetDependents(Extension("MyEventsExtension")).size() == 1);
+  }
+}
@@ -0,0 +1,139 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the compiled schema of the properties of custom
+ * behaviors and objects.
+ */
+#include "GDCore/Project/PropertiesSchema.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/CustomConfigurationHelper.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/PropertiesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void SetupProperties(gd::PropertiesContainer &properties) {
+  properties.InsertNew("MyString", 0).SetType("String").SetValue("Hello");
+  properties.InsertNew("MyNumber", 1).SetType("Number").SetValue("12.5");
+  properties.InsertNew("MyBoolean", 2).SetType("Boolean").SetValue("true");
+  properties.InsertNew("MyChoice", 3).SetType("Choice").SetValue("B");
+}
+
+}  // namespace
+
+TEST_CASE("PropertiesSchema", "[common]") {
+  SECTION("Slots") {
+    gd::PropertiesContainer properties(gd::EventsFunctionsContainer::Behavior);
+    SetupProperties(properties);
+
+    const auto &schema = properties.GetSchema();
+    REQUIRE(schema.GetSlotsCount() == 4);
+    REQUIRE(schema.GetSlot("MyNumber") == 1);
+    REQUIRE(schema.GetSlot("MyUnknownProperty") == gd::String::npos);
+    REQUIRE(schema.GetSlotName(2) == "MyBoolean");
+    REQUIRE(schema.GetSlotValueType(0) == gd::PropertiesSchema::StringValue);
+    REQUIRE(schema.GetSlotValueType(1) == gd::PropertiesSchema::NumberValue);
+    REQUIRE(schema.GetSlotValueType(2) == gd::PropertiesSchema::BooleanValue);
+    REQUIRE(schema.GetSlotValueType(3) == gd::PropertiesSchema::StringValue);
+    REQUIRE(schema.GetSlotDefaultValue(1) == "12.5");
+    REQUIRE(&schema.GetSlotDescriptor(3) == &properties.Get("MyChoice"));
+  }
+
+  SECTION("Schema is compiled again when properties are changed") {
+    gd::PropertiesContainer properties(gd::EventsFunctionsContainer::Behavior);
+    SetupProperties(properties);
+    gd::PropertiesSchema previousSchema = properties.GetSchema();
+    REQUIRE(previousSchema.IsUpToDate(properties));
+
+    properties.Get("MyNumber").SetType("Boolean");
+    REQUIRE(!previousSchema.IsUpToDate(properties));
+    REQUIRE(properties.GetSchema().GetSlotValueType(1) ==
+            gd::PropertiesSchema::BooleanValue);
+
+    properties.Get("MyString").SetName("MyRenamedString");
+    REQUIRE(properties.GetSchema().GetSlot("MyString") == gd::String::npos);
+    REQUIRE(properties.GetSchema().GetSlot("MyRenamedString") == 0);
+
+    properties.Move(3, 0);
+    REQUIRE(properties.GetSchema().GetSlot("MyChoice") == 0);
+
+    properties.Remove("MyChoice");
+    REQUIRE(properties.GetSchema().GetSlotsCount() == 3);
+    REQUIRE(properties.GetSchema().GetSlot("MyChoice") == gd::String::npos);
+
+    gd::PropertiesContainer copiedProperties = properties;
+    REQUIRE(&copiedProperties.GetSchema().GetSlotDescriptor(0) ==
+            &copiedProperties.Get(0));
+  }
+
+  SECTION("Values") {
+    gd::PropertiesContainer properties(gd::EventsFunctionsContainer::Behavior);
+    SetupProperties(properties);
+    const auto &schema = properties.GetSchema();
+
+    gd::SerializerElement content;
+    content.AddChild("MyNumber").SetDoubleValue(42);
+    content.AddChild("MyUnknownProperty").SetStringValue("Ignored");
+
+    auto values =
+        gd::CustomConfigurationHelper::GetProperties(properties, content);
+    REQUIRE(values.size() == schema.GetSlotsCount());
+    REQUIRE(values.at("MyString").GetValue() == "Hello");
+    REQUIRE(values.at("MyNumber").GetValue() == "42");
+    REQUIRE(values.at("MyBoolean").GetValue() == "true");
+    REQUIRE(values.count("MyUnknownProperty") == 0);
+
+    REQUIRE(gd::CustomConfigurationHelper::UpdateProperty(
+        properties, content, "MyBoolean", "0"));
+    REQUIRE(gd::CustomConfigurationHelper::UpdateProperty(
+        properties, content, "MyChoice", "C"));
+    REQUIRE(content.GetChild("MyBoolean").GetBoolValue() == false);
+    REQUIRE(content.GetChild("MyChoice").GetStringValue() == "C");
+    REQUIRE(!content.HasChild("MyString"));
+
+    values = gd::CustomConfigurationHelper::GetProperties(properties, content);
+    REQUIRE(values.at("MyBoolean").GetValue() == "false");
+    REQUIRE(values.at("MyChoice").GetValue() == "C");
+  }
+
+  SECTION("Custom behavior properties") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    auto &eventsBasedBehavior =
+        extension.GetEventsBasedBehaviors().InsertNew("MyBehavior", 0);
+    SetupProperties(eventsBasedBehavior.GetPropertyDescriptors());
+
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    auto &object = layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject", 0);
+    auto *behavior = object.AddNewBehavior(
+        project, "MyEventsExtension::MyBehavior", "MyBehavior");
+    REQUIRE(behavior != nullptr);
+
+    REQUIRE(behavior->UpdateProperty("MyNumber", "3"));
+    REQUIRE(behavior->UpdateProperty("MyBoolean", "0"));
+    REQUIRE(!behavior->UpdateProperty("MyUnknownProperty", "1"));
+
+    auto behaviorProperties = behavior->GetProperties();
+    REQUIRE(behaviorProperties.size() == 4);
+    REQUIRE(behaviorProperties.at("MyString").GetValue() == "Hello");
+    REQUIRE(behaviorProperties.at("MyNumber").GetValue() == "3");
+    REQUIRE(behaviorProperties.at("MyBoolean").GetValue() == "false");
+    REQUIRE(behaviorProperties.at("MyChoice").GetType() == "Choice");
+  }
+}
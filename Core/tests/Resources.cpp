@@ -32,4 +32,93 @@ TEST_CASE("Resources", "[common][resources]") {
     image.SetFile("Lots\\\\Of\\\\\\..\\Backslashs");
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
+  SECTION("Resources lookup in the manager") {
+    gd::ResourcesManager resourcesManager;
+    resourcesManager.AddResource("Resource1", "res/file1.png", "image");
+    resourcesManager.AddResource("Resource2", "res/file2.png", "image");
+    resourcesManager.AddResource("Resource3", "res/file3.png", "audio");
+    REQUIRE(resourcesManager.AddResource("Resource2", "res/other.png",
+                                         "image") == false);
+
+    REQUIRE(resourcesManager.HasResource("Resource1"));
+    REQUIRE(resourcesManager.HasResource("Resource3"));
+    REQUIRE(!resourcesManager.HasResource("Resource4"));
+    REQUIRE(resourcesManager.GetResource("Resource2").GetFile() ==
+            "res/file2.png");
+    REQUIRE(resourcesManager.GetResourcePosition("Resource3") == 2);
+
+    // Renaming
+    resourcesManager.RenameResource("Resource2", "RenamedResource2");
+    REQUIRE(!resourcesManager.HasResource("Resource2"));
+    REQUIRE(resourcesManager.HasResource("RenamedResource2"));
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedResource2") == 1);
+
+    // Moving
+    resourcesManager.MoveResource(0, 2);
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedResource2") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource3") == 1);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 2);
+    REQUIRE(resourcesManager.MoveResourceUpInList("Resource1"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 1);
+    REQUIRE(!resourcesManager.MoveResourceUpInList("RenamedResource2"));
+    REQUIRE(!resourcesManager.MoveResourceDownInList("Resource3"));
+
+    // Removing
+    resourcesManager.RemoveResource("RenamedResource2");
+    REQUIRE(!resourcesManager.HasResource("RenamedResource2"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 0);
+    REQUIRE(resourcesManager.GetResource("Resource3").GetFile() ==
+            "res/file3.png");
+
+    // Renaming directly the resource is still handled.
+    resourcesManager.GetResource("Resource3").SetName("Resource3b");
+    REQUIRE(resourcesManager.HasResource("Resource3b"));
+    REQUIRE(!resourcesManager.HasResource("Resource3"));
+
+    // Copies have their own index.
+    gd::ResourcesManager copiedResourcesManager = resourcesManager;
+    copiedResourcesManager.RenameResource("Resource1", "CopiedResource1");
+    REQUIRE(copiedResourcesManager.HasResource("CopiedResource1"));
+    REQUIRE(resourcesManager.HasResource("Resource1"));
+    copiedResourcesManager.GetResource("Resource3b").SetName("Resource3c");
+    REQUIRE(copiedResourcesManager.HasResource("Resource3c"));
+    REQUIRE(resourcesManager.HasResource("Resource3b"));
+    REQUIRE(!resourcesManager.HasResource("Resource3c"));
+
+    // Resources with the same name: the first one is found.
+    resourcesManager.GetResource("Resource3b").SetName("Resource1");
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 0);
+    REQUIRE(!resourcesManager.HasResource("Resource3b"));
+    resourcesManager.GetResource("Resource1").SetName("Resource1b");
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1b") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1") == 1);
+
+    // Removed resources are no longer linked to the manager.
+    auto removedResource = resourcesManager.GetResourceSPtr("Resource1");
+    resourcesManager.RemoveResource("Resource1");
+    removedResource->SetName("Resource1b");
+    REQUIRE(resourcesManager.GetResourcePosition("Resource1b") == 0);
+    REQUIRE(resourcesManager.GetAllResourceNames().size() == 1);
+  }
+  SECTION("Resources lookup by file in the manager") {
+    gd::ResourcesManager resourcesManager;
+    resourcesManager.AddResource("Resource1", "res/file1.png", "image");
+    resourcesManager.AddResource("Resource2", "res/file2.png", "image");
+
+    REQUIRE(resourcesManager.GetResourceNameWithFile("res/file2.png") ==
+            "Resource2");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("res/file3.png") == "");
+
+    // Changing directly the file of a resource is handled.
+    resourcesManager.GetResource("Resource2").SetFile("res/file3.png");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("res/file2.png") == "");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("res/file3.png") ==
+            "Resource2");
+
+    std::vector<gd::String> filesNotInResources =
+        resourcesManager.FindFilesNotInResources(
+            {"res/file1.png", "res\\file2.png", "res\\file3.png"});
+    REQUIRE(filesNotInResources.size() == 1);
+    REQUIRE(filesNotInResources[0] == "res\\file2.png");
+  }
 }
@@ -0,0 +1,82 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the packing of files into bundles.
+ */
+#include "GDCore/IDE/Project/ResourcesBundle.h"
+
+#include "catch.hpp"
+
+TEST_CASE("ResourcesBundle", "[common][resources]") {
+  gd::ResourcesBundle bundle;
+  bundle.AddFile("image.png", std::string("\x89PNG\0\x01\xff", 7));
+  bundle.AddFile("empty.json", "");
+  bundle.AddFile(u8"Écran/musique.ogg", "OggS content");
+
+  SECTION("Can pack and unpack files") {
+    std::string packedBundle = bundle.Pack();
+
+    gd::ResourcesBundle unpackedBundle;
+    REQUIRE(unpackedBundle.Unpack(packedBundle));
+    REQUIRE(unpackedBundle.GetFilesCount() == 3);
+    REQUIRE(unpackedBundle.GetAllFileNames() == bundle.GetAllFileNames());
+    REQUIRE(unpackedBundle.GetFileContent("image.png") ==
+            std::string("\x89PNG\0\x01\xff", 7));
+    REQUIRE(unpackedBundle.HasFile("empty.json"));
+    REQUIRE(unpackedBundle.GetFileContent("empty.json") == "");
+    REQUIRE(unpackedBundle.GetFileContent(u8"Écran/musique.ogg") ==
+            "OggS content");
+    REQUIRE(!unpackedBundle.HasFile("unknown.png"));
+
+    // Packing again gives exactly the same bundle.
+    REQUIRE(unpackedBundle.Pack() == packedBundle);
+  }
+
+  SECTION("Can read the index from the beginning of a bundle") {
+    std::string packedBundle = bundle.Pack();
+    std::size_t contentSize = 7 + 0 + 12;
+    std::string bundleBeginning =
+        packedBundle.substr(0, packedBundle.size() - contentSize);
+
+    std::vector<gd::ResourcesBundle::Entry> entries;
+    REQUIRE(gd::ResourcesBundle::ReadIndex(bundleBeginning, entries));
+    REQUIRE(entries.size() == 3);
+    REQUIRE(entries[0].name == "image.png");
+    REQUIRE(entries[0].offset == bundleBeginning.size());
+    REQUIRE(entries[0].size == 7);
+    REQUIRE(entries[1].name == "empty.json");
+    REQUIRE(entries[1].size == 0);
+    REQUIRE(entries[2].name == u8"Écran/musique.ogg");
+    REQUIRE(entries[2].offset == bundleBeginning.size() + 7);
+    REQUIRE(packedBundle.substr(entries[2].offset, entries[2].size) ==
+            "OggS content");
+
+    // The index can't be read if it's not complete.
+    REQUIRE(!gd::ResourcesBundle::ReadIndex(
+        bundleBeginning.substr(0, bundleBeginning.size() - 1), entries));
+  }
+
+  SECTION("Replaces the content of a file added twice") {
+    bundle.AddFile("image.png", "new content");
+    REQUIRE(bundle.GetFilesCount() == 3);
+    REQUIRE(bundle.GetFileContent("image.png") == "new content");
+  }
+
+  SECTION("Refuses invalid or truncated bundles") {
+    gd::ResourcesBundle unpackedBundle;
+    REQUIRE(!unpackedBundle.Unpack(""));
+    REQUIRE(!unpackedBundle.Unpack("Not a bundle at all"));
+
+    std::string packedBundle = bundle.Pack();
+    REQUIRE(!unpackedBundle.Unpack(
+        packedBundle.substr(0, packedBundle.size() - 1)));
+    REQUIRE(unpackedBundle.GetFilesCount() == 0);
+
+    gd::ResourcesBundle emptyBundle;
+    REQUIRE(unpackedBundle.Unpack(emptyBundle.Pack()));
+    REQUIRE(unpackedBundle.GetFilesCount() == 0);
+  }
+}
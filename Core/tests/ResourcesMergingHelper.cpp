@@ -10,6 +10,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
@@ -63,6 +64,26 @@ class MockFileSystem : public gd::AbstractFileSystem {
   virtual ~MockFileSystem(){};
 };
 
+class MockFileSystemWithIdenticalFiles : public MockFileSystem {
+ public:
+  virtual gd::String ReadFile(const gd::String& file) {
+    readFilesCount++;
+    if (file.find("copy-of-image1") != gd::String::npos ||
+        file.find("image1") != gd::String::npos)
+      return "Content of image1";
+    return "Content of " + file;
+  }
+  virtual bool GetFileStats(const gd::String& file,
+                            std::size_t& size,
+                            std::int64_t& lastModificationTime) {
+    size = 42;
+    lastModificationTime = 123456;
+    return true;
+  }
+
+  std::size_t readFilesCount = 0;
+};
+
 TEST_CASE("ResourcesMergingHelper", "[common]") {
   SECTION("Basics") {
     gd::Project project;
@@ -115,4 +136,67 @@ TEST_CASE("ResourcesMergingHelper", "[common]") {
     REQUIRE(resourcesFilenames["MakeAbsolute(subfolder/image3.png)"] ==
             "MakeRelative(MakeAbsolute(subfolder/image3.png))");
   }
+  SECTION("Can deduplicate identical files") {
+    gd::Project project;
+    MockFileSystemWithIdenticalFiles fs;
+    gd::FilesContentHashCache cache;
+    gd::ResourcesMergingHelper resourcesMerger(project.GetResourcesManager(),
+                                               fs);
+    resourcesMerger.SetBaseDirectory("/game/base/folder/");
+    resourcesMerger.DeduplicateIdenticalFiles(true);
+    resourcesMerger.SetFilesContentHashCache(cache);
+
+    project.GetResourcesManager().AddResource("Image1", "image1.png", "image");
+    project.GetResourcesManager().AddResource("Image2", "image2.png", "image");
+    project.GetResourcesManager().AddResource(
+        "Image1Copy", "subfolder/copy-of-image1.png", "image");
+
+    gd::ResourceExposer::ExposeWholeProjectResources(project, resourcesMerger);
+
+    auto resourcesFilenames =
+        resourcesMerger.GetAllResourcesOldAndNewFilename();
+    REQUIRE(resourcesFilenames["MakeAbsolute(image1.png)"] ==
+            "FileNameFrom(MakeAbsolute(image1.png))");
+    REQUIRE(resourcesFilenames["MakeAbsolute(image2.png)"] ==
+            "FileNameFrom(MakeAbsolute(image2.png))");
+    REQUIRE(resourcesFilenames["MakeAbsolute(subfolder/copy-of-image1.png)"] ==
+            "FileNameFrom(MakeAbsolute(image1.png))");
+
+    // Resources are updated to use the single copy of the file.
+    REQUIRE(project.GetResourcesManager().GetResource("Image1Copy").GetFile() ==
+            "FileNameFrom(MakeAbsolute(image1.png))");
+    REQUIRE(project.GetResourcesManager().GetResource("Image1").GetFile() ==
+            "FileNameFrom(MakeAbsolute(image1.png))");
+
+    // Unchanged files are not read again thanks to the cache.
+    REQUIRE(fs.readFilesCount == 3);
+    REQUIRE(cache.GetCachedFilesCount() == 3);
+    gd::Project otherProject;
+    otherProject.GetResourcesManager().AddResource(
+        "Image1", "image1.png", "image");
+    gd::ResourcesMergingHelper otherResourcesMerger(
+        otherProject.GetResourcesManager(), fs);
+    otherResourcesMerger.DeduplicateIdenticalFiles(true);
+    otherResourcesMerger.SetFilesContentHashCache(cache);
+    gd::ResourceExposer::ExposeWholeProjectResources(otherProject,
+                                                     otherResourcesMerger);
+    REQUIRE(fs.readFilesCount == 3);
+  }
+  SECTION("Can share the hashes of files across exports") {
+    gd::Project project;
+    MockFileSystemWithIdenticalFiles fs;
+    gd::FilesContentHashCache cache;
+    project.GetResourcesManager().AddResource("Image1", "image1.png", "image");
+    project.GetResourcesManager().AddResource(
+        "Image1Copy", "subfolder/copy-of-image1.png", "image");
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export/", false, false, false, true, &cache);
+    REQUIRE(fs.readFilesCount == 2);
+    REQUIRE(cache.GetCachedFilesCount() == 2);
+
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export/", false, false, false, true, &cache);
+    REQUIRE(fs.readFilesCount == 2);
+  }
 }
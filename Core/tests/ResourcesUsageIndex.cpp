@@ -0,0 +1,160 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the index of resources usages.
+ */
+#include "GDCore/IDE/Project/ResourcesUsageIndex.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+void InsertEventUsingResources(gd::EventsList &events,
+                               const gd::String &bitmapFontName,
+                               const gd::String &imageName,
+                               const gd::String &audioName) {
+  gd::StandardEvent standardEvent;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomethingWithResources");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, bitmapFontName);
+  instruction.SetParameter(1, imageName);
+  instruction.SetParameter(2, audioName);
+  standardEvent.GetActions().Insert(instruction);
+  events.InsertEvent(standardEvent);
+}
+
+}  // namespace
+
+TEST_CASE("ResourcesUsageIndex", "[common][resources]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  project.GetResourcesManager().AddResource("res1", "path/to/file1.png",
+                                            "image");
+  project.GetResourcesManager().AddResource("res2", "path/to/file2.png",
+                                            "image");
+  project.GetResourcesManager().AddResource("res3", "path/to/file3.fnt",
+                                            "bitmapFont");
+  project.GetResourcesManager().AddResource("res4", "path/to/file4.png",
+                                            "audio");
+
+  auto &layout1 = project.InsertNewLayout("Scene1", 0);
+  auto &layout2 = project.InsertNewLayout("Scene2", 1);
+  auto &externalEvents =
+      project.InsertNewExternalEvents("MyExternalEvents", 0);
+
+  auto &object = layout1.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyObject", 0);
+  auto *behavior = object.AddNewBehavior(
+      project, "MyExtension::BehaviorWithRequiredBehaviorProperty",
+      "BehaviorWithResource");
+  behavior->UpdateProperty("resourceProperty", "res1");
+
+  InsertEventUsingResources(layout2.GetEvents(), "res3", "res1", "res4");
+  InsertEventUsingResources(externalEvents.GetEvents(), "res3", "", "");
+  project.GetLoadingScreen().SetBackgroundImageResourceName("res2");
+
+  gd::ResourcesUsageIndex index;
+  index.IndexWholeProject(project);
+
+  SECTION("Can find resources usages in the whole project") {
+    REQUIRE(index.IsResourceUsed("res1"));
+    REQUIRE(index.IsResourceUsed("res2"));
+    REQUIRE(index.IsResourceUsed("res3"));
+    REQUIRE(index.IsResourceUsed("res4"));
+    REQUIRE(!index.IsResourceUsed("res5"));
+    REQUIRE(index.GetAllUsedResourceNames().size() == 4);
+
+    auto res1LayoutNames = index.GetLayoutsUsingResource("res1");
+    REQUIRE(res1LayoutNames.size() == 2);
+    REQUIRE(res1LayoutNames[0] == "Scene1");
+    REQUIRE(res1LayoutNames[1] == "Scene2");
+    REQUIRE(index.GetLayoutsUsingResource("res4") ==
+            std::vector<gd::String>(1, "Scene2"));
+    REQUIRE(index.GetLayoutsUsingResource("res2").empty());
+    REQUIRE(index.IsResourceUsedInLayout("res3", "Scene2"));
+    REQUIRE(!index.IsResourceUsedInLayout("res3", "Scene1"));
+
+    auto scene2ResourceNames = index.GetResourcesUsedByPart(
+        gd::ResourceUser::LayoutPart, "Scene2");
+    REQUIRE(scene2ResourceNames.size() == 3);
+    REQUIRE(scene2ResourceNames[0] == "res1");
+    REQUIRE(scene2ResourceNames[1] == "res3");
+    REQUIRE(scene2ResourceNames[2] == "res4");
+    REQUIRE(index.GetResourcesUsedByPart(gd::ResourceUser::LayoutPart,
+                                         "UnknownScene")
+                .empty());
+  }
+
+  SECTION("Can tell what is using a resource") {
+    auto res1Users = index.GetResourceUsers("res1");
+    REQUIRE(res1Users.size() == 2);
+    REQUIRE(res1Users[0] ==
+            gd::ResourceUser(gd::ResourceUser::LayoutPart, "Scene1",
+                             gd::ResourceUser::ObjectBehavior, "MyObject",
+                             "BehaviorWithResource"));
+    REQUIRE(res1Users[1] == gd::ResourceUser(gd::ResourceUser::LayoutPart,
+                                             "Scene2",
+                                             gd::ResourceUser::Events));
+
+    auto res2Users = index.GetResourceUsers("res2");
+    REQUIRE(res2Users.size() == 1);
+    REQUIRE(res2Users[0].GetPartType() == gd::ResourceUser::ProjectPart);
+    REQUIRE(res2Users[0].GetUserType() == gd::ResourceUser::ProjectProperty);
+
+    auto res3Users = index.GetResourceUsers("res3");
+    REQUIRE(res3Users.size() == 2);
+    REQUIRE(res3Users[0].GetPartType() == gd::ResourceUser::LayoutPart);
+    REQUIRE(res3Users[1].GetPartType() ==
+            gd::ResourceUser::ExternalEventsPart);
+    REQUIRE(res3Users[1].GetPartName() == "MyExternalEvents");
+  }
+
+  SECTION("Can update a part of the project") {
+    layout2.GetEvents().RemoveEvent(0);
+    index.UpdateLayout(project, layout2);
+
+    REQUIRE(index.GetLayoutsUsingResource("res1") ==
+            std::vector<gd::String>(1, "Scene1"));
+    REQUIRE(!index.IsResourceUsed("res4"));
+    // Still used by the external events.
+    REQUIRE(index.IsResourceUsed("res3"));
+
+    externalEvents.GetEvents().RemoveEvent(0);
+    index.UpdateExternalEvents(project, externalEvents);
+    REQUIRE(!index.IsResourceUsed("res3"));
+
+    project.GetLoadingScreen().SetBackgroundImageResourceName("res4");
+    index.UpdateProject(project);
+    REQUIRE(!index.IsResourceUsed("res2"));
+    REQUIRE(index.IsResourceUsed("res4"));
+  }
+
+  SECTION("Can remove a part of the project") {
+    index.RemoveLayout("Scene1");
+    REQUIRE(index.GetLayoutsUsingResource("res1") ==
+            std::vector<gd::String>(1, "Scene2"));
+
+    index.RemoveLayout("Scene2");
+    REQUIRE(!index.IsResourceUsed("res1"));
+    REQUIRE(!index.IsResourceUsed("res4"));
+    REQUIRE(index.IsResourceUsed("res3"));
+
+    index.RemoveExternalEvents("MyExternalEvents");
+    REQUIRE(!index.IsResourceUsed("res3"));
+    REQUIRE(index.GetAllUsedResourceNames() ==
+            std::vector<gd::String>(1, "res2"));
+  }
+}
@@ -0,0 +1,194 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the interned strings used for types repeated in
+ * projects.
+ */
+#include "GDCore/Tools/StringAtom.h"
+
+#include <thread>
+#include <unordered_set>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/InstructionsTypeRenamer.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("StringAtom", "[common]") {
+  SECTION("Atoms of equal strings are equal") {
+    gd::StringAtom atom1(gd::String("MyExtension::DoSomething"));
+    gd::StringAtom atom2(gd::String("MyExtension::") + "DoSomething");
+    gd::StringAtom atom3(gd::String("MyExtension::DoSomethingElse"));
+
+    REQUIRE(atom1 == atom2);
+    REQUIRE(atom1.GetId() == atom2.GetId());
+    REQUIRE(&atom1.GetString() == &atom2.GetString());
+    REQUIRE(atom1 != atom3);
+    REQUIRE(atom1 == gd::String("MyExtension::DoSomething"));
+    REQUIRE(atom3.GetString() == "MyExtension::DoSomethingElse");
+
+    std::unordered_set<gd::StringAtom> atoms = {atom1, atom2, atom3};
+    REQUIRE(atoms.size() == 2);
+  }
+
+  SECTION("Empty atoms") {
+    gd::StringAtom emptyAtom;
+    REQUIRE(emptyAtom.empty());
+    REQUIRE(emptyAtom == gd::StringAtom(gd::String("")));
+    REQUIRE(emptyAtom.GetString() == "");
+  }
+
+  SECTION("Interning from several threads") {
+    std::vector<gd::StringAtom> atoms(8);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < atoms.size(); ++i) {
+      threads.emplace_back([&atoms, i]() {
+        for (std::size_t j = 0; j < 1000; ++j)
+          gd::StringAtom(gd::String("ThreadedAtom") + gd::String::From(j));
+        atoms[i] = gd::StringAtom(gd::String("ThreadedAtom999"));
+      });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& atom : atoms) REQUIRE(atom == atoms[0]);
+  }
+
+  SECTION("Instructions and instances") {
+    gd::Instruction instruction("MyExtension::DoSomething");
+    REQUIRE(instruction.GetType() == "MyExtension::DoSomething");
+    REQUIRE(instruction.GetTypeAtom() ==
+            gd::StringAtom(gd::String("MyExtension::DoSomething")));
+    instruction.SetType("MyExtension::DoSomethingElse");
+    REQUIRE(instruction.GetType() == "MyExtension::DoSomethingElse");
+
+    // Names chosen by users are not interned.
+    std::size_t internedStringsCount =
+        gd::StringAtom::GetInternedStringsCount();
+    gd::InitialInstance instance;
+    instance.SetObjectName("MyNotInternedObject");
+    instance.SetLayer("MyNotInternedLayer");
+    gd::InitialInstance copiedInstance = instance;
+    REQUIRE(copiedInstance.GetObjectName() == "MyNotInternedObject");
+    REQUIRE(copiedInstance.GetLayer() == "MyNotInternedLayer");
+    REQUIRE(gd::StringAtom::GetInternedStringsCount() == internedStringsCount);
+  }
+
+  SECTION("Existing atoms") {
+    gd::StringAtom atom(gd::String("MyExtension::MyExistingType"));
+    REQUIRE(gd::StringAtom::FindExisting("MyExtension::MyExistingType") ==
+            atom);
+
+    std::size_t internedStringsCount =
+        gd::StringAtom::GetInternedStringsCount();
+    REQUIRE(
+        gd::StringAtom::FindExisting("MyExtension::MyMissingType").empty());
+    REQUIRE(gd::StringAtom::GetInternedStringsCount() == internedStringsCount);
+  }
+
+  SECTION("Instructions type renaming") {
+    gd::Project project;
+    gd::EventsList events;
+    gd::StandardEvent event;
+    event.GetActions().Insert(gd::Instruction("MyExtension::DoSomething"));
+    event.GetActions().Insert(gd::Instruction(""));
+    events.InsertEvent(event);
+
+    gd::InstructionsTypeRenamer renamer(
+        project, "MyExtension::DoSomething", "MyExtension::DoSomethingElse");
+    renamer.Launch(events);
+    auto& actions =
+        dynamic_cast<gd::StandardEvent&>(events.GetEvent(0)).GetActions();
+    REQUIRE(actions[0].GetType() == "MyExtension::DoSomethingElse");
+    REQUIRE(actions[1].GetType() == "");
+
+    // Renaming a type that no instruction has doesn't intern it.
+    std::size_t internedStringsCount =
+        gd::StringAtom::GetInternedStringsCount();
+    gd::InstructionsTypeRenamer missingTypeRenamer(
+        project, "MyExtension::MyMissingType", "MyExtension::DoSomething");
+    missingTypeRenamer.Launch(events);
+    REQUIRE(gd::StringAtom::GetInternedStringsCount() == internedStringsCount);
+    REQUIRE(actions[0].GetType() == "MyExtension::DoSomethingElse");
+    REQUIRE(actions[1].GetType() == "");
+  }
+}
+
+TEST_CASE("StringAtom - Benchmarks", "[.][benchmark][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  // A large scene, with a few objects and layers used by many instances and
+  // a few instruction types used by many events.
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  for (std::size_t i = 0; i < 5000; ++i) {
+    auto& instance = layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MyLongObjectName" + gd::String::From(i % 20));
+    instance.SetLayer("MyLongLayerName" + gd::String::From(i % 4));
+  }
+  for (std::size_t i = 0; i < 1250; ++i) {
+    gd::StandardEvent& event =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().InsertNewEvent(
+            project, "BuiltinCommonInstructions::Standard"));
+    for (std::size_t j = 0; j < 4; ++j) {
+      event.GetActions().Insert(gd::Instruction(
+          "MyExtension::DoSomething" + gd::String::From(j % 3)));
+    }
+  }
+
+  gd::SerializerElement element;
+  layout.SerializeTo(element);
+
+  SECTION("Scene load") {
+    DoBenchmark("Scene load", 5, [&]() {
+      gd::Layout loadedLayout;
+      loadedLayout.UnserializeFrom(project, element);
+      REQUIRE(loadedLayout.GetInitialInstances().GetInstancesCount() == 5000);
+      REQUIRE(loadedLayout.GetEvents().GetEventsCount() == 1250);
+      REQUIRE(loadedLayout.GetEvents().GetEvent(0).GetType() ==
+              "BuiltinCommonInstructions::Standard");
+    });
+
+    // Types, names and layers are stored once instead of once per
+    // instruction or instance.
+    std::cout << "Strings interned by the process after the scene load: "
+              << gd::StringAtom::GetInternedStringsCount()
+              << " (for 5000 instances and 5000 instructions)" << std::endl;
+  }
+
+  SECTION("Instructions lookup by type") {
+    std::vector<gd::Instruction> instructions;
+    for (std::size_t i = 0; i < 100000; ++i) {
+      instructions.push_back(gd::Instruction(
+          "MyExtension::DoSomething" + gd::String::From(i % 3)));
+    }
+    gd::String searchedType = "MyExtension::DoSomething1";
+    gd::StringAtom searchedTypeAtom(searchedType);
+
+    DoBenchmark("Instructions lookup by type (strings)", 10, [&]() {
+      std::size_t foundCount = 0;
+      for (const auto& instruction : instructions) {
+        if (instruction.GetType() == searchedType) foundCount++;
+      }
+      REQUIRE(foundCount == 33333);
+    });
+    DoBenchmark("Instructions lookup by type (atoms)", 10, [&]() {
+      std::size_t foundCount = 0;
+      for (const auto& instruction : instructions) {
+        if (instruction.GetTypeAtom() == searchedTypeAtom) foundCount++;
+      }
+      REQUIRE(foundCount == 33333);
+    });
+  }
+}
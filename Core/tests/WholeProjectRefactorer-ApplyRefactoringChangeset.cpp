@@ -0,0 +1,292 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the refactoring of several changes at once.
+ */
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/RefactoringChangeset.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+void InsertAction(gd::Project &project,
+                  gd::EventsList &events,
+                  const gd::String &type,
+                  const std::vector<gd::String> &parameters) {
+  gd::StandardEvent &event = dynamic_cast<gd::StandardEvent &>(
+      events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+
+  gd::Instruction action;
+  action.SetType(type);
+  action.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    action.SetParameter(i, gd::Expression(parameters[i]));
+  event.GetActions().Insert(action);
+}
+
+void InsertActions(gd::Project &project, gd::EventsList &events) {
+  InsertAction(project,
+               events,
+               "MyExtension::DoSomething",
+               {"Player.Health + Counter + "
+                "MyExtension::MouseX(\"Background\", 0)"});
+  InsertAction(
+      project, events, "SetNumberVariable", {"Label", "=", "123"});
+  InsertAction(project,
+               events,
+               "MyExtension::SetCameraCenterX",
+               {"", "", "", "\"Background\""});
+  InsertAction(
+      project, events, "MyExtension::DoSomething", {"Player.Score + 1"});
+}
+
+/**
+ * \brief Create the same project with a scene (with its external events and
+ * layout) where variables, objects and layers are used and an other scene
+ * where elements have the same names.
+ */
+void SetupProject(gd::Project &project, gd::Platform &platform) {
+  SetupProjectWithDummyPlatform(project, platform);
+
+  for (const gd::String &sceneName : {"Scene", "OtherScene"}) {
+    auto &scene = project.InsertNewLayout(sceneName, 0);
+    scene.GetVariables().InsertNew("Counter").SetValue(123);
+    scene.GetVariables().InsertNew("Label").SetValue(123);
+    scene.InsertNewLayer("Background", 0);
+
+    auto &object = scene.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "Player", 0);
+    object.GetVariables().InsertNew("Health").SetValue(100);
+    object.GetVariables().InsertNew("Score").SetValue(0);
+
+    auto &instance = scene.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("Player");
+    instance.SetLayer("Background");
+
+    InsertActions(project, scene.GetEvents());
+
+    auto &externalEvents =
+        project.InsertNewExternalEvents(sceneName + "Events", 0);
+    externalEvents.SetAssociatedLayout(sceneName);
+    InsertActions(project, externalEvents.GetEvents());
+
+    auto &externalLayout =
+        project.InsertNewExternalLayout(sceneName + "Layout", 0);
+    externalLayout.SetAssociatedLayout(sceneName);
+    auto &externalInstance =
+        externalLayout.GetInitialInstances().InsertNewInitialInstance();
+    externalInstance.SetObjectName("Player");
+    externalInstance.SetLayer("Background");
+  }
+}
+
+gd::String SerializeEvents(const gd::EventsList &events) {
+  gd::SerializerElement element;
+  events.SerializeTo(element);
+  return gd::Serializer::ToJSON(element);
+}
+
+}  // namespace
+
+TEST_CASE("WholeProjectRefactorer::ApplyRefactoringChangeset", "[common]") {
+  SECTION("Same result as refactoring each change") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProject(project, platform);
+    gd::Project expectedProject;
+    SetupProject(expectedProject, platform);
+
+    gd::RefactoringChangeset refactoringChangeset;
+    for (gd::Project *currentProject : {&project, &expectedProject}) {
+      auto &scene = currentProject->GetLayout("Scene");
+      auto &sceneVariables = scene.GetVariables();
+      auto &objectVariables = scene.GetObjects().GetObject("Player").GetVariables();
+
+      sceneVariables.ResetPersistentUuid();
+      gd::SerializerElement originalSerializedSceneVariables;
+      sceneVariables.SerializeTo(originalSerializedSceneVariables);
+      objectVariables.ResetPersistentUuid();
+      gd::SerializerElement originalSerializedObjectVariables;
+      objectVariables.SerializeTo(originalSerializedObjectVariables);
+
+      sceneVariables.Rename("Counter", "RenamedCounter");
+      sceneVariables.Get("Label").SetString("Hello");
+      objectVariables.Rename("Health", "Life");
+      objectVariables.Remove("Score");
+      auto sceneChangeset =
+          gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+              originalSerializedSceneVariables, sceneVariables);
+      auto objectChangeset =
+          gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+              originalSerializedObjectVariables, objectVariables);
+
+      if (currentProject == &project) {
+        refactoringChangeset
+            .AddVariablesContainerChanges(sceneVariables,
+                                          sceneChangeset,
+                                          originalSerializedSceneVariables)
+            .AddVariablesContainerChanges(objectVariables,
+                                          objectChangeset,
+                                          originalSerializedObjectVariables)
+            .AddObjectOrGroupRenamedInScene(scene, "Player", "Hero", false)
+            .AddLayerRenamedInScene(scene, "Background", "Foreground");
+        gd::WholeProjectRefactorer::ApplyRefactoringChangeset(
+            project, refactoringChangeset);
+      } else {
+        gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
+            *currentProject,
+            sceneVariables,
+            sceneChangeset,
+            originalSerializedSceneVariables);
+        gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
+            *currentProject,
+            objectVariables,
+            objectChangeset,
+            originalSerializedObjectVariables);
+        gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+            *currentProject, scene, "Player", "Hero", false);
+        gd::WholeProjectRefactorer::RenameLayerInScene(
+            *currentProject, scene, "Background", "Foreground");
+      }
+    }
+
+    // Check the changes were done.
+    auto &scene = project.GetLayout("Scene");
+    auto &actions =
+        dynamic_cast<gd::StandardEvent &>(scene.GetEvents().GetEvent(0))
+            .GetActions();
+    REQUIRE(actions[0].GetParameter(0).GetPlainString() ==
+            "Hero.Life + RenamedCounter + "
+            "MyExtension::MouseX(\"Foreground\", 0)");
+    REQUIRE(dynamic_cast<gd::StandardEvent &>(scene.GetEvents().GetEvent(1))
+                .GetActions()[0]
+                .GetType() == "SetStringVariable");
+    REQUIRE(dynamic_cast<gd::StandardEvent &>(scene.GetEvents().GetEvent(3))
+                .GetActions()
+                .IsEmpty());
+    REQUIRE(scene.GetInitialInstances().HasInstancesOfObject("Hero"));
+    REQUIRE(scene.GetInitialInstances().GetLayerInstancesCount("Foreground") ==
+            1);
+    REQUIRE(project.GetExternalLayout("SceneLayout")
+                .GetInitialInstances()
+                .GetLayerInstancesCount("Foreground") == 1);
+
+    // Check the result is the same as refactoring each change.
+    for (const gd::String &sceneName : {"Scene", "OtherScene"}) {
+      REQUIRE(SerializeEvents(project.GetLayout(sceneName).GetEvents()) ==
+              SerializeEvents(expectedProject.GetLayout(sceneName).GetEvents()));
+      REQUIRE(
+          SerializeEvents(
+              project.GetExternalEvents(sceneName + "Events").GetEvents()) ==
+          SerializeEvents(expectedProject.GetExternalEvents(sceneName + "Events")
+                              .GetEvents()));
+      REQUIRE(project.GetExternalLayout(sceneName + "Layout")
+                  .GetInitialInstances()
+                  .HasInstancesOfObject("Hero") ==
+              expectedProject.GetExternalLayout(sceneName + "Layout")
+                  .GetInitialInstances()
+                  .HasInstancesOfObject("Hero"));
+    }
+    REQUIRE(SerializeEvents(project.GetLayout("OtherScene").GetEvents()) ==
+            SerializeEvents(project.GetExternalEvents("OtherSceneEvents")
+                                .GetEvents()));
+  }
+
+  SECTION("Empty changeset") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProject(project, platform);
+    gd::String serializedEvents =
+        SerializeEvents(project.GetLayout("Scene").GetEvents());
+
+    gd::RefactoringChangeset refactoringChangeset;
+    refactoringChangeset.AddLayerRenamedInScene(
+        project.GetLayout("Scene"), "Background", "Background");
+    REQUIRE(refactoringChangeset.IsEmpty());
+
+    gd::WholeProjectRefactorer::ApplyRefactoringChangeset(
+        project, refactoringChangeset);
+    REQUIRE(SerializeEvents(project.GetLayout("Scene").GetEvents()) ==
+            serializedEvents);
+  }
+}
+
+TEST_CASE("WholeProjectRefactorer::ApplyRefactoringChangeset - Benchmarks",
+          "[.][benchmark][common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  // 200 objects with a renamed variable, used in 1000 events.
+  auto &scene = project.InsertNewLayout("Scene", 0);
+  std::vector<gd::VariablesChangeset> changesets;
+  std::vector<gd::SerializerElement> originalSerializedVariables(200);
+  for (std::size_t i = 0; i < 200; ++i) {
+    auto &object = scene.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyObject" + gd::String::From(i), i);
+    auto &variables = object.GetVariables();
+    variables.InsertNew("MyVariable").SetValue(1);
+    variables.ResetPersistentUuid();
+    variables.SerializeTo(originalSerializedVariables[i]);
+    variables.Rename("MyVariable", "MyRenamedVariable");
+    changesets.push_back(
+        gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+            originalSerializedVariables[i], variables));
+  }
+  for (std::size_t i = 0; i < 1000; ++i) {
+    InsertAction(project,
+                 scene.GetEvents(),
+                 "MyExtension::DoSomething",
+                 {"MyObject" + gd::String::From(i % 200) +
+                  ".MyVariable + 1"});
+  }
+  gd::String serializedEvents = SerializeEvents(scene.GetEvents());
+
+  gd::String refactoredEvents;
+  DoBenchmark("Refactoring of each variables container", 1, [&]() {
+    for (std::size_t i = 0; i < 200; ++i) {
+      gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
+          project,
+          scene.GetObjects().GetObject(i).GetVariables(),
+          changesets[i],
+          originalSerializedVariables[i]);
+    }
+    refactoredEvents = SerializeEvents(scene.GetEvents());
+  });
+
+  scene.GetEvents().UnserializeFrom(
+      project, gd::Serializer::FromJSON(serializedEvents));
+  DoBenchmark("Refactoring of a changeset", 1, [&]() {
+    gd::RefactoringChangeset refactoringChangeset;
+    for (std::size_t i = 0; i < 200; ++i) {
+      refactoringChangeset.AddVariablesContainerChanges(
+          scene.GetObjects().GetObject(i).GetVariables(),
+          changesets[i],
+          originalSerializedVariables[i]);
+    }
+    gd::WholeProjectRefactorer::ApplyRefactoringChangeset(
+        project, refactoringChangeset);
+    REQUIRE(SerializeEvents(scene.GetEvents()) == refactoredEvents);
+  });
+  REQUIRE(refactoredEvents != serializedEvents);
+}
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include "BenchmarkTools.h"
 #include "DummyPlatform.h"
 #include "GDCore/Events/Builtin/ForEachChildVariableEvent.h"
 #include "GDCore/Events/Builtin/LinkEvent.h"
@@ -33,6 +34,7 @@
 #include "catch.hpp"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/ParallelTasks.h"
 
 
 TEST_CASE("WholeProjectRefactorer::ApplyRefactoringForVariablesContainer",
@@ -3094,3 +3096,167 @@ TEST_CASE("WholeProjectRefactorer::ApplyRefactoringForVariablesContainer",
             "OutsideObject.MyGroupVariable");
   }
 }
+
+namespace {
+
+void InsertActionWithParameters(gd::Project &project, gd::EventsList &events,
+                                const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::StandardEvent &event = dynamic_cast<gd::StandardEvent &>(
+      events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+
+  gd::Instruction action;
+  action.SetType(type);
+  action.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    action.SetParameter(i, gd::Expression(parameters[i]));
+  event.GetActions().Insert(action);
+}
+
+void InsertActionsUsingGlobalVariables(gd::Project &project,
+                                       gd::EventsList &events) {
+  InsertActionWithParameters(project, events, "MyExtension::DoSomething",
+                             {"MyGlobalVariable + 1"});
+  InsertActionWithParameters(project, events, "SetNumberVariable",
+                             {"MyGlobalVariable", "=", "123"});
+  InsertActionWithParameters(project, events, "MyExtension::DoSomething",
+                             {"MyRemovedGlobalVariable + 1"});
+}
+
+/**
+ * Create a project with global variables used in the events of its scenes,
+ * external events and extensions.
+ */
+void SetupProjectUsingGlobalVariables(gd::Project &project,
+                                      gd::Platform &platform,
+                                      std::size_t scenesCount,
+                                      std::size_t eventsCount) {
+  SetupProjectWithDummyPlatform(project, platform);
+  project.GetVariables().InsertNew("MyGlobalVariable", 0).SetValue(123);
+  project.GetVariables().InsertNew("MyRemovedGlobalVariable", 0).SetValue(123);
+
+  for (std::size_t i = 0; i < scenesCount; ++i) {
+    const gd::String sceneName = "Scene" + gd::String::From(i);
+    auto &scene = project.InsertNewLayout(sceneName, i);
+    auto &externalEvents =
+        project.InsertNewExternalEvents(sceneName + "Events", i);
+    externalEvents.SetAssociatedLayout(sceneName);
+    for (std::size_t j = 0; j < eventsCount; ++j) {
+      InsertActionsUsingGlobalVariables(project, scene.GetEvents());
+      InsertActionsUsingGlobalVariables(project, externalEvents.GetEvents());
+    }
+
+    auto &extension = project.InsertNewEventsFunctionsExtension(
+        "Extension" + gd::String::From(i), i);
+    auto &function = extension.InsertNewEventsFunction("MyFunction", 0);
+    InsertActionsUsingGlobalVariables(project, function.GetEvents());
+  }
+}
+
+gd::String SerializeProjectEvents(const gd::Project &project) {
+  gd::SerializerElement element;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+    project.GetLayout(i).GetEvents().SerializeTo(element.AddChild("events"));
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i)
+    project.GetExternalEvents(i).GetEvents().SerializeTo(
+        element.AddChild("events"));
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    project.GetEventsFunctionsExtension(i)
+        .GetEventsFunction(0)
+        .GetEvents()
+        .SerializeTo(element.AddChild("events"));
+  }
+  return gd::Serializer::ToJSON(element);
+}
+
+/**
+ * Rename, remove and change the type of global variables, then launch the
+ * refactoring, on the given number of threads if more than one.
+ */
+void RefactorGlobalVariables(gd::Project &project, std::size_t threadsCount) {
+  auto &variables = project.GetVariables();
+  variables.ResetPersistentUuid();
+  gd::SerializerElement originalSerializedVariables;
+  variables.SerializeTo(originalSerializedVariables);
+
+  variables.Rename("MyGlobalVariable", "MyRenamedGlobalVariable");
+  variables.Get("MyRenamedGlobalVariable").SetString("Hello");
+  variables.Remove("MyRemovedGlobalVariable");
+  auto changeset =
+      gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+          originalSerializedVariables, variables);
+
+  if (threadsCount > 1) {
+    gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainerInParallel(
+        project, variables, changeset, originalSerializedVariables,
+        threadsCount);
+  } else {
+    gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
+        project, variables, changeset, originalSerializedVariables);
+  }
+}
+
+} // namespace
+
+TEST_CASE("WholeProjectRefactorer::"
+          "ApplyRefactoringForVariablesContainerInParallel",
+          "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectUsingGlobalVariables(project, platform, 5, 3);
+  gd::Project expectedProject;
+  SetupProjectUsingGlobalVariables(expectedProject, platform, 5, 3);
+
+  RefactorGlobalVariables(project, 4);
+  RefactorGlobalVariables(expectedProject, 1);
+
+  REQUIRE(dynamic_cast<gd::StandardEvent &>(
+              project.GetLayout(4).GetEvents().GetEvent(0))
+              .GetActions()[0]
+              .GetParameter(0)
+              .GetPlainString() == "MyRenamedGlobalVariable + 1");
+  // Global variables are not in the scope of extensions.
+  REQUIRE(dynamic_cast<gd::StandardEvent &>(
+              project.GetEventsFunctionsExtension(4)
+                  .GetEventsFunction(0)
+                  .GetEvents()
+                  .GetEvent(0))
+              .GetActions()[0]
+              .GetParameter(0)
+              .GetPlainString() == "MyGlobalVariable + 1");
+  REQUIRE(dynamic_cast<gd::StandardEvent &>(
+              project.GetExternalEvents(2).GetEvents().GetEvent(1))
+              .GetActions()[0]
+              .GetType() == "SetStringVariable");
+  REQUIRE(dynamic_cast<gd::StandardEvent &>(
+              project.GetLayout(3).GetEvents().GetEvent(2))
+              .GetActions()
+              .IsEmpty());
+  REQUIRE(project.GetVariables().Has("MyRenamedGlobalVariable"));
+  REQUIRE(SerializeProjectEvents(project) ==
+          SerializeProjectEvents(expectedProject));
+}
+
+TEST_CASE("WholeProjectRefactorer::"
+          "ApplyRefactoringForVariablesContainerInParallel - Benchmarks",
+          "[.][benchmark][common]") {
+  // 40 scenes with 600 events in the scene and its external events.
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectUsingGlobalVariables(project, platform, 40, 100);
+  gd::Project expectedProject;
+  SetupProjectUsingGlobalVariables(expectedProject, platform, 40, 100);
+
+  DoBenchmark("Variables refactoring", 1,
+              [&]() { RefactorGlobalVariables(expectedProject, 1); });
+
+  std::size_t threadsCount =
+      std::max<std::size_t>(gd::ParallelTasks::GetHardwareThreadsCount(), 2);
+  DoBenchmark("Variables refactoring on " + gd::String::From(threadsCount) +
+                  " threads",
+              1, [&]() { RefactorGlobalVariables(project, threadsCount); });
+
+  REQUIRE(SerializeProjectEvents(project) ==
+          SerializeProjectEvents(expectedProject));
+}
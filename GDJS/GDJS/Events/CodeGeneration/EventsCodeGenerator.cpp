@@ -49,12 +49,12 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
 
   // Generate whole events code
-  // Preprocessing then code generation can make changes to the events, so we
-  // need to do the work on a copy of the events.
-  gd::EventsList generatedEvents = events;
-  codeGenerator.PreprocessEventList(generatedEvents);
-  gd::String wholeEventsCode =
-      codeGenerator.GenerateEventsListCode(generatedEvents, context);
+  // Preprocessing doesn't modify the events: the lists it changes are copied
+  // and stored by the code generator, which uses them instead of the original
+  // ones. Code generation itself only reads the events.
+  codeGenerator.PreprocessEventListWithoutCopy(events);
+  gd::String wholeEventsCode = codeGenerator.GenerateEventsListCode(
+      const_cast<gd::EventsList&>(events), context);
 
   // Extra declarations needed by events
   gd::String globalDeclarations;
@@ -107,6 +107,9 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  // Events included several times by links are generated in a single function
+  // (for each objects scope).
+  codeGenerator.SetLinkedEventsSharing(true);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator,
@@ -109,8 +109,14 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
       .SetCodeGenerator([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
                            gd::EventsCodeGenerationContext &context) {
-        return "/*Link should not have any generated code. You probably "
-               "wrongly used a link in events without a layout.*/";
+        if (codeGenerator.IsLinkedEventsSharingEnabled()) {
+          gd::LinkEvent &event = dynamic_cast<gd::LinkEvent &>(event_);
+          return codeGenerator.GenerateLinkedEventsCode(event, context);
+        }
+
+        return gd::String(
+            "/*Link should not have any generated code. You probably "
+            "wrongly used a link in events without a layout.*/");
       })
       .SetPreprocessing([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
@@ -118,6 +124,9 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                            unsigned int indexOfTheEventInThisList) {
         if (!codeGenerator.HasProjectAndLayout())
           return;
+        // Linked events are generated by the link itself.
+        if (codeGenerator.IsLinkedEventsSharingEnabled())
+          return;
 
         gd::LinkEvent &event = dynamic_cast<gd::LinkEvent &>(event_);
         event.ReplaceLinkByLinkedEvents(codeGenerator.GetProject(), eventList,
@@ -344,8 +353,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
   GetAllConditions()["BuiltinCommonInstructions::Once"].SetCustomCodeGenerator(
       [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
+        // The instruction is either a copy made by the preprocessing, or the
+        // instruction of the project itself.
+        auto originalInstruction = instruction.GetOriginalInstruction().lock();
         size_t uniqueId = codeGenerator.GenerateSingleUsageUniqueIdFor(
-            instruction.GetOriginalInstruction().lock().get());
+            originalInstruction ? originalInstruction.get() : &instruction);
         gd::String outputCode = codeGenerator.GenerateUpperScopeBooleanFullName(
                                     "isConditionTrue", context) +
                                 " = ";
@@ -42,6 +42,7 @@
 namespace gdjs {
 
 JsPlatform *JsPlatform::singleton = NULL;
+bool JsPlatform::lazyExtensionsDeclaration = false;
 
 // When compiling with emscripten, extensions exposes specific functions to
 // create them.
@@ -71,131 +72,184 @@ void JsPlatform::ReloadBuiltinExtensions() {
   // Adding built-in extensions.
   std::cout << "* Loading builtin extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new BaseObjectExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SpriteExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AsyncExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonConversionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new VariablesExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new MouseExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new KeyboardExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SceneExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new TimeExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new MathematicalToolsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new CameraExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AudioExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new FileExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new NetworkExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new WindowExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new StringInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AdvancedExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ExternalLayoutsExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new AnimatableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new EffectExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new FlippableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ResizableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ScalableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new OpacityExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new TextContainerExtension));
-  std::cout.flush();
+  // Built-in extensions also declare instructions and expressions without a
+  // namespace.
+  AddBuiltinExtension("BuiltinObject", {"", "BuiltinObject"}, []() {
+    return std::make_shared<BaseObjectExtension>();
+  });
+  AddBuiltinExtension("Sprite", {"", "Sprite"}, []() {
+    return std::make_shared<SpriteExtension>();
+  });
+  AddBuiltinExtension(
+      "BuiltinCommonInstructions", {"", "BuiltinCommonInstructions"}, []() {
+        return std::make_shared<CommonInstructionsExtension>();
+      });
+  AddBuiltinExtension("BuiltinAsync", {"", "BuiltinAsync"}, []() {
+    return std::make_shared<AsyncExtension>();
+  });
+  AddBuiltinExtension(
+      "BuiltinCommonConversions", {"", "BuiltinCommonConversions"}, []() {
+        return std::make_shared<CommonConversionsExtension>();
+      });
+  AddBuiltinExtension("BuiltinVariables", {"", "BuiltinVariables"}, []() {
+    return std::make_shared<VariablesExtension>();
+  });
+  AddBuiltinExtension("BuiltinMouse", {"", "BuiltinMouse"}, []() {
+    return std::make_shared<MouseExtension>();
+  });
+  AddBuiltinExtension("BuiltinKeyboard", {"", "BuiltinKeyboard"}, []() {
+    return std::make_shared<KeyboardExtension>();
+  });
+  AddBuiltinExtension("BuiltinScene", {"", "BuiltinScene"}, []() {
+    return std::make_shared<SceneExtension>();
+  });
+  AddBuiltinExtension("BuiltinTime", {"", "BuiltinTime"}, []() {
+    return std::make_shared<TimeExtension>();
+  });
+  AddBuiltinExtension(
+      "BuiltinMathematicalTools", {"", "BuiltinMathematicalTools"}, []() {
+        return std::make_shared<MathematicalToolsExtension>();
+      });
+  AddBuiltinExtension("BuiltinCamera", {"", "BuiltinCamera"}, []() {
+    return std::make_shared<CameraExtension>();
+  });
+  AddBuiltinExtension("BuiltinAudio", {"", "BuiltinAudio"}, []() {
+    return std::make_shared<AudioExtension>();
+  });
+  AddBuiltinExtension("BuiltinFile", {"", "BuiltinFile"}, []() {
+    return std::make_shared<FileExtension>();
+  });
+  AddBuiltinExtension("BuiltinNetwork", {"", "BuiltinNetwork"}, []() {
+    return std::make_shared<NetworkExtension>();
+  });
+  AddBuiltinExtension("BuiltinWindow", {"", "BuiltinWindow"}, []() {
+    return std::make_shared<WindowExtension>();
+  });
+  AddBuiltinExtension(
+      "BuiltinStringInstructions", {"", "BuiltinStringInstructions"}, []() {
+        return std::make_shared<StringInstructionsExtension>();
+      });
+  AddBuiltinExtension("BuiltinAdvanced", {"", "BuiltinAdvanced"}, []() {
+    return std::make_shared<AdvancedExtension>();
+  });
+  AddBuiltinExtension(
+      "BuiltinExternalLayouts", {"", "BuiltinExternalLayouts"}, []() {
+        return std::make_shared<ExternalLayoutsExtension>();
+      });
+  AddBuiltinExtension(
+      "AnimatableCapability", {"", "AnimatableCapability"}, []() {
+        return std::make_shared<AnimatableExtension>();
+      });
+  AddBuiltinExtension("EffectCapability", {"", "EffectCapability"}, []() {
+    return std::make_shared<EffectExtension>();
+  });
+  AddBuiltinExtension("FlippableCapability", {"", "FlippableCapability"}, []() {
+    return std::make_shared<FlippableExtension>();
+  });
+  AddBuiltinExtension("ResizableCapability", {"", "ResizableCapability"}, []() {
+    return std::make_shared<ResizableExtension>();
+  });
+  AddBuiltinExtension("ScalableCapability", {"", "ScalableCapability"}, []() {
+    return std::make_shared<ScalableExtension>();
+  });
+  AddBuiltinExtension("OpacityCapability", {"", "OpacityCapability"}, []() {
+    return std::make_shared<OpacityExtension>();
+  });
+  AddBuiltinExtension(
+      "TextContainerCapability", {"", "TextContainerCapability"}, []() {
+        return std::make_shared<TextContainerExtension>();
+      });
   std::cout << "done." << std::endl;
 
-#if defined(EMSCRIPTEN) // When compiling with emscripten, hardcode extensions
-                        // to load.
+#if defined(EMSCRIPTEN)  // When compiling with emscripten, hardcode extensions
+                         // to load.
   std::cout << "* Loading other extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPlatformBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDestroyOutsideBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTiledSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDraggableBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTopDownMovementBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSTextObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSParticleSystemExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPanelSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSAnchorBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPrimitiveDrawingExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTextEntryObjectExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSInventoryExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSLinkedObjectsExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSSystemInfoExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPathfindingBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPhysicsBehaviorExtension()));
-  std::cout.flush();
+  AddBuiltinExtension("PlatformBehavior", {"PlatformBehavior"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPlatformBehaviorExtension());
+  });
+  AddBuiltinExtension(
+      "DestroyOutsideBehavior", {"DestroyOutsideBehavior"}, []() {
+        return std::shared_ptr<gd::PlatformExtension>(
+            CreateGDJSDestroyOutsideBehaviorExtension());
+      });
+  AddBuiltinExtension("TiledSpriteObject", {"TiledSpriteObject"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTiledSpriteObjectExtension());
+  });
+  AddBuiltinExtension("DraggableBehavior", {"DraggableBehavior"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSDraggableBehaviorExtension());
+  });
+  AddBuiltinExtension(
+      "TopDownMovementBehavior", {"TopDownMovementBehavior"}, []() {
+        return std::shared_ptr<gd::PlatformExtension>(
+            CreateGDJSTopDownMovementBehaviorExtension());
+      });
+  AddBuiltinExtension("TextObject", {"TextObject"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextObjectExtension());
+  });
+  AddBuiltinExtension("ParticleSystem", {"ParticleSystem"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSParticleSystemExtension());
+  });
+  AddBuiltinExtension("PanelSpriteObject", {"PanelSpriteObject"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPanelSpriteObjectExtension());
+  });
+  AddBuiltinExtension("AnchorBehavior", {"AnchorBehavior"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSAnchorBehaviorExtension());
+  });
+  AddBuiltinExtension("PrimitiveDrawing", {"PrimitiveDrawing"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPrimitiveDrawingExtension());
+  });
+  AddBuiltinExtension("TextEntryObject", {"TextEntryObject"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSTextEntryObjectExtension());
+  });
+  AddBuiltinExtension("Inventory", {"Inventory"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSInventoryExtension());
+  });
+  AddBuiltinExtension("LinkedObjects", {"LinkedObjects"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSLinkedObjectsExtension());
+  });
+  AddBuiltinExtension("SystemInfo", {"SystemInfo"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSSystemInfoExtension());
+  });
+  AddBuiltinExtension("Shopify", {"Shopify"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSShopifyExtension());
+  });
+  AddBuiltinExtension("PathfindingBehavior", {"PathfindingBehavior"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPathfindingBehaviorExtension());
+  });
+  AddBuiltinExtension("PhysicsBehavior", {"PhysicsBehavior"}, []() {
+    return std::shared_ptr<gd::PlatformExtension>(
+        CreateGDJSPhysicsBehaviorExtension());
+  });
 #endif
   std::cout << "done." << std::endl;
 };
 
+void JsPlatform::AddBuiltinExtension(
+    const gd::String &name,
+    const std::vector<gd::String> &typesNamespaces,
+    std::function<std::shared_ptr<gd::PlatformExtension>()> createExtension) {
+  if (lazyExtensionsDeclaration)
+    AddDeferredExtension(name, typesNamespaces, createExtension);
+  else
+    AddExtension(createExtension());
+  std::cout.flush();
+}
+
 void JsPlatform::AddNewExtension(const gd::PlatformExtension &extension) {
   AddExtension(std::shared_ptr<gd::PlatformExtension>(
       new gd::PlatformExtension(extension)));
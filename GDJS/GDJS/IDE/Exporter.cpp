@@ -24,6 +24,7 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Tools/Gzip.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
@@ -86,7 +87,11 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
 
     // Export the resources (before generating events as some resources
     // filenames may be updated)
-    helper.ExportResources(fs, exportedProject, exportDir);
+    helper.ExportResources(fs,
+                           exportedProject,
+                           exportDir,
+                           options.deduplicateResourcesFiles,
+                           options.filesContentHashCache);
 
     // Compatibility with GD <= 5.0-beta56
     // Stay compatible with text objects declaring their font as just a filename
@@ -150,19 +155,45 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
           gd::SceneResourcesFinder::FindSceneResources(exportedProject, layout);
     }
 
+    if (options.packResourcesInBundles) {
+      helper.ExportResourcesBundles(fs,
+                                    exportedProject,
+                                    exportDir,
+                                    projectUsedResources,
+                                    scenesUsedResources);
+    }
+
     // Strip the project (*after* generating events as the events may use
     // stripped things like objects groups...)...
     gd::ProjectStripper::StripProjectForExport(exportedProject);
 
     //...and export it
     gd::SerializerElement noRuntimeGameOptions;
-    helper.ExportProjectData(fs,
-                             exportedProject,
-                             codeOutputDir + "/data.js",
-                             noRuntimeGameOptions,
-                             projectUsedResources,
-                             scenesUsedResources);
-    includesFiles.push_back(codeOutputDir + "/data.js");
+    if (options.minifyProjectData) {
+      helper.ExportMinifiedProjectData(fs,
+                                       exportedProject,
+                                       codeOutputDir,
+                                       noRuntimeGameOptions,
+                                       projectUsedResources,
+                                       scenesUsedResources,
+                                       includesFiles,
+                                       options.precompressProjectData);
+    } else {
+      helper.ExportProjectData(fs,
+                               exportedProject,
+                               codeOutputDir + "/data.js",
+                               noRuntimeGameOptions,
+                               projectUsedResources,
+                               scenesUsedResources);
+      includesFiles.push_back(codeOutputDir + "/data.js");
+
+      if (options.precompressProjectData) {
+        gd::String compressedData;
+        compressedData.Raw() =
+            gd::Gzip::Compress(fs.ReadFile(codeOutputDir + "/data.js").Raw());
+        fs.WriteToFile(codeOutputDir + "/data.js.gz", compressedData);
+      }
+    }
 
     helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
     helper.ExportIncludesAndLibs(resourcesFiles, exportDir, false);
@@ -10,6 +10,7 @@
 #endif
 #include <algorithm>
 #include <array>
+#include <cctype>
 #include <fstream>
 #include <functional>
 #include <sstream>
@@ -28,6 +29,7 @@
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
 #include "GDCore/IDE/ExportedDependencyResolver.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/Project/ResourcesBundle.h"
 #include "GDCore/IDE/Project/SceneResourcesFinder.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/SceneNameMangler.h"
@@ -40,6 +42,7 @@
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Tools/Gzip.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
@@ -71,6 +74,115 @@ static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
     container.push_back(str);
 }
 
+/**
+ * \brief Return a JavaScript expression evaluating to the given JSON, where
+ * the string values repeated enough times are declared once as variables.
+ */
+static gd::String InternRepeatedStrings(const gd::String &json) {
+  const std::string &input = json.Raw();
+
+  // Find the string values (not the keys) and count their occurrences.
+  std::vector<std::pair<std::size_t, std::size_t>> stringValues;
+  std::unordered_map<std::string, std::size_t> occurrences;
+  for (std::size_t position = 0; position < input.size(); ++position) {
+    if (input[position] != '"') continue;
+
+    std::size_t end = position + 1;
+    while (end < input.size() && input[end] != '"') {
+      if (input[end] == '\\') end++;
+      end++;
+    }
+    if (end >= input.size()) break;
+
+    std::size_t next = end + 1;
+    while (next < input.size() &&
+           std::isspace(static_cast<unsigned char>(input[next])))
+      next++;
+    if (next >= input.size() || input[next] != ':') {
+      stringValues.push_back(std::make_pair(position, end + 1 - position));
+      occurrences[input.substr(position, end + 1 - position)]++;
+    }
+    position = end;
+  }
+
+  // Give the shortest names to the strings taking the most space.
+  std::vector<std::pair<std::string, std::size_t>> candidates(
+      occurrences.begin(), occurrences.end());
+  std::sort(candidates.begin(),
+            candidates.end(),
+            [](const std::pair<std::string, std::size_t> &a,
+               const std::pair<std::string, std::size_t> &b) {
+              std::size_t aSize = a.first.size() * a.second;
+              std::size_t bSize = b.first.size() * b.second;
+              return aSize != bSize ? aSize > bSize : a.first < b.first;
+            });
+
+  static const std::set<std::string> reservedWords = {
+      "do",    "if",     "in",    "for",   "let",   "new",   "try",
+      "var",   "case",   "else",  "enum",  "eval",  "null",  "this",
+      "true",  "void",   "with",  "await", "break", "catch", "class",
+      "const", "false",  "super", "throw", "while", "yield", "delete",
+      "export", "import", "public", "return", "static", "switch", "typeof",
+      "default", "extends", "finally", "package", "private", "continue",
+      "debugger", "function", "arguments", "interface", "protected",
+      "implements", "instanceof", "undefined", "NaN", "Infinity"};
+  static const std::string firstCharacters =
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_$";
+  static const std::string otherCharacters = firstCharacters + "0123456789";
+  std::size_t nameIndex = 0;
+  auto nextName = [&]() {
+    std::string name;
+    do {
+      std::size_t index = nameIndex++;
+      name = firstCharacters[index % firstCharacters.size()];
+      index /= firstCharacters.size();
+      while (index > 0) {
+        index--;
+        name += otherCharacters[index % otherCharacters.size()];
+        index /= otherCharacters.size();
+      }
+    } while (reservedWords.find(name) != reservedWords.end());
+    return name;
+  };
+
+  std::unordered_map<std::string, std::string> names;
+  std::string declarations;
+  for (const auto &candidate : candidates) {
+    if (candidate.second < 2) continue;
+
+    std::size_t savedNameIndex = nameIndex;
+    std::string name = nextName();
+    std::size_t declarationSize = name.size() + candidate.first.size() + 2;
+    if (candidate.second * candidate.first.size() <=
+        candidate.second * name.size() + declarationSize) {
+      nameIndex = savedNameIndex;
+      continue;
+    }
+
+    declarations += (declarations.empty() ? "var " : ",") + name + "=" +
+                    candidate.first;
+    names[candidate.first] = name;
+  }
+  if (names.empty()) return json;
+
+  std::string output = "(function(){" + declarations + ";return ";
+  std::size_t copiedPosition = 0;
+  for (const auto &stringValue : stringValues) {
+    auto it = names.find(input.substr(stringValue.first, stringValue.second));
+    if (it == names.end()) continue;
+
+    output.append(input, copiedPosition, stringValue.first - copiedPosition);
+    output.append(it->second);
+    copiedPosition = stringValue.first + stringValue.second;
+  }
+  output.append(input, copiedPosition, std::string::npos);
+  output += ";})()";
+
+  gd::String result;
+  result.Raw() = output;
+  return result;
+}
+
 static gd::String CleanProjectName(gd::String projectName) {
   gd::String partiallyCleanedProjectName = projectName;
 
@@ -354,6 +466,61 @@ gd::String ExporterHelper::ExportProjectData(
   return "";
 }
 
+gd::String ExporterHelper::ExportMinifiedProjectData(
+    gd::AbstractFileSystem &fs,
+    gd::Project &project,
+    gd::String codeOutputDir,
+    const gd::SerializerElement &runtimeGameOptions,
+    std::set<gd::String> &projectUsedResources,
+    std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources,
+    std::vector<gd::String> &includesFiles,
+    bool precompress) {
+  fs.MkDir(codeOutputDir);
+
+  auto writeFile = [&](const gd::String &filename,
+                       const gd::String &content) -> bool {
+    if (!fs.WriteToFile(filename, content)) return false;
+    includesFiles.push_back(filename);
+    if (!precompress) return true;
+
+    gd::String compressedContent;
+    compressedContent.Raw() = gd::Gzip::Compress(content.Raw());
+    return fs.WriteToFile(filename + ".gz", compressedContent);
+  };
+
+  gd::SerializerElement rootElement;
+  project.SerializeTo(rootElement);
+  SerializeUsedResources(
+      rootElement, projectUsedResources, scenesUsedResources);
+
+  // Scenes are stored in their own files, loaded after the project.
+  gd::SerializerElement layoutsElement = rootElement.GetChild("layouts");
+  rootElement.RemoveChild("layouts");
+  rootElement.AddChild("layouts").ConsiderAsArrayOf("layout");
+
+  gd::String filename = codeOutputDir + "/data.js";
+  gd::String projectData =
+      InternRepeatedStrings(gd::Serializer::ToJSON(rootElement));
+  if (!writeFile(filename,
+                 "gdjs.projectData = " + projectData + ";\n" +
+                     "gdjs.runtimeGameOptions = " +
+                     gd::Serializer::ToJSON(runtimeGameOptions) + ";\n"))
+    return "Unable to write " + filename;
+
+  layoutsElement.ConsiderAsArrayOf("layout");
+  for (std::size_t i = 0; i < layoutsElement.GetChildrenCount(); ++i) {
+    filename = codeOutputDir + "/data-scene-" + gd::String::From(i) + ".js";
+    if (!writeFile(filename,
+                   "gdjs.projectData.layouts.push(" +
+                       InternRepeatedStrings(
+                           gd::Serializer::ToJSON(layoutsElement.GetChild(i))) +
+                       ");\n"))
+      return "Unable to write " + filename;
+  }
+
+  return "";
+}
+
 void ExporterHelper::SerializeUsedResources(
     gd::SerializerElement &rootElement,
     std::set<gd::String> &projectUsedResources,
@@ -1056,6 +1223,12 @@ bool ExporterHelper::ExportIncludesAndLibs(
       // folder and fall in this case:
       if (fs.FileExists(include)) {
         fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
+
+        gd::String compressedInclude = include + ".gz";
+        if (fs.FileExists(compressedInclude)) {
+          fs.CopyFile(compressedInclude,
+                      exportDir + "/" + fs.FileNameFrom(compressedInclude));
+        }
       } else {
         std::cout << "Could not find include file " << include << std::endl;
       }
@@ -1065,11 +1238,107 @@ bool ExporterHelper::ExportIncludesAndLibs(
   return true;
 }
 
-void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
-                                     gd::Project &project,
-                                     gd::String exportDir) {
-  gd::ProjectResourcesCopier::CopyAllResourcesTo(
-      project, fs, exportDir, true, false, false);
+void ExporterHelper::ExportResources(
+    gd::AbstractFileSystem &fs,
+    gd::Project &project,
+    gd::String exportDir,
+    bool deduplicateIdenticalFiles,
+    gd::FilesContentHashCache *filesContentHashCache) {
+  gd::ProjectResourcesCopier::CopyAllResourcesTo(project,
+                                                 fs,
+                                                 exportDir,
+                                                 true,
+                                                 false,
+                                                 false,
+                                                 deduplicateIdenticalFiles,
+                                                 filesContentHashCache);
+}
+
+void ExporterHelper::ExportResourcesBundles(
+    gd::AbstractFileSystem &fs,
+    gd::Project &project,
+    gd::String exportDir,
+    const std::set<gd::String> &projectUsedResources,
+    const std::unordered_map<gd::String, std::set<gd::String>>
+        &scenesUsedResources) {
+  // Count the scenes using each resource to find the ones to share.
+  std::map<gd::String, std::size_t> scenesCountByResource;
+  for (const auto &sceneUsedResources : scenesUsedResources) {
+    for (const gd::String &resourceName : sceneUsedResources.second)
+      scenesCountByResource[resourceName]++;
+  }
+  auto isShared = [&](const gd::String &resourceName) {
+    return projectUsedResources.find(resourceName) !=
+               projectUsedResources.end() ||
+           scenesCountByResource[resourceName] > 1;
+  };
+
+  gd::ResourcesManager &resourcesManager = project.GetResourcesManager();
+  auto addResourceToBundle = [&](const gd::String &resourceName,
+                                 gd::ResourcesBundle &bundle) {
+    if (!resourcesManager.HasResource(resourceName)) return;
+
+    const gd::String &file =
+        resourcesManager.GetResource(resourceName).GetFile();
+    if (file.empty() || file.find("://") != gd::String::npos) return;
+
+    gd::String exportedFile = exportDir + "/" + file;
+    if (!fs.FileExists(exportedFile)) return;
+
+    bundle.AddFile(resourceName, fs.ReadFile(exportedFile).Raw());
+  };
+
+  gd::String bundlesDir = exportDir + "/bundles";
+  fs.MkDir(bundlesDir);
+  gd::SerializerElement bundlesElement;
+  bundlesElement.ConsiderAsArrayOf("bundle");
+  auto writeBundle = [&](const gd::ResourcesBundle &bundle,
+                         const gd::String &filename,
+                         const gd::String &sceneName) {
+    gd::String packedBundle;
+    packedBundle.Raw() = bundle.Pack();
+    fs.WriteToFile(bundlesDir + "/" + filename, packedBundle);
+
+    gd::SerializerElement &bundleElement = bundlesElement.AddChild("bundle");
+    bundleElement.SetAttribute("file", "bundles/" + filename);
+    bundleElement.SetAttribute("sceneName", sceneName);
+    gd::SerializerElement &resourcesElement =
+        bundleElement.AddChild("resources");
+    resourcesElement.ConsiderAsArray();
+    for (const gd::String &resourceName : bundle.GetAllFileNames())
+      resourcesElement.AddChild("").SetStringValue(resourceName);
+  };
+
+  gd::ResourcesBundle sharedBundle;
+  for (const gd::String &resourceName : projectUsedResources)
+    addResourceToBundle(resourceName, sharedBundle);
+
+  std::vector<gd::ResourcesBundle> scenesBundles(project.GetLayoutsCount());
+  for (std::size_t layoutIndex = 0; layoutIndex < project.GetLayoutsCount();
+       layoutIndex++) {
+    auto it =
+        scenesUsedResources.find(project.GetLayout(layoutIndex).GetName());
+    if (it == scenesUsedResources.end()) continue;
+
+    for (const gd::String &resourceName : it->second) {
+      addResourceToBundle(resourceName,
+                          isShared(resourceName) ? sharedBundle
+                                                 : scenesBundles[layoutIndex]);
+    }
+  }
+
+  writeBundle(sharedBundle, "shared.gdbundle", "");
+  for (std::size_t layoutIndex = 0; layoutIndex < scenesBundles.size();
+       layoutIndex++) {
+    if (scenesBundles[layoutIndex].GetFilesCount() == 0) continue;
+
+    writeBundle(scenesBundles[layoutIndex],
+                "scene-" + gd::String::From(layoutIndex) + ".gdbundle",
+                project.GetLayout(layoutIndex).GetName());
+  }
+
+  fs.WriteToFile(bundlesDir + "/bundles.json",
+                 gd::Serializer::ToJSON(bundlesElement));
 }
 
 void ExporterHelper::AddDeprecatedFontFilesToFontResources(
@@ -19,6 +19,7 @@ class Layout;
 class ExternalLayout;
 class SerializerElement;
 class AbstractFileSystem;
+class FilesContentHashCache;
 class ResourcesManager;
 class WholeProjectDiagnosticReport;
 class CaptureOptions;
@@ -316,7 +317,12 @@ struct ExportOptions {
         exportPath(exportPath_),
         target(""),
         fallbackAuthorId(""),
-        fallbackAuthorUsername("") {};
+        fallbackAuthorUsername(""),
+        deduplicateResourcesFiles(false),
+        filesContentHashCache(nullptr),
+        packResourcesInBundles(false),
+        minifyProjectData(false),
+        precompressProjectData(false) {};
 
   /**
    * \brief Set the fallback author info (if info not present in project
@@ -340,11 +346,72 @@ struct ExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if resources files with the same content must be exported
+   * only once (resources are then updated to all use the same file).
+   */
+  ExportOptions &SetDeduplicateResourcesFiles(bool enable) {
+    deduplicateResourcesFiles = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set the cache storing the hashes of the resources files content,
+   * used when files are deduplicated. Using the same cache for all the exports
+   * avoids reading again the files that did not change.
+   *
+   * \note The cache must outlive the export.
+   */
+  ExportOptions &SetFilesContentHashCache(gd::FilesContentHashCache &cache) {
+    filesContentHashCache = &cache;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the resources files must also be packed into bundles: one
+   * for the resources shared by the whole game and one for each scene.
+   *
+   * \see ExporterHelper::ExportResourcesBundles
+   */
+  ExportOptions &SetPackResourcesInBundles(bool enable) {
+    packResourcesInBundles = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the project data must be minified: repeated strings are
+   * stored only once and each scene is stored in its own file.
+   *
+   * \see ExporterHelper::ExportMinifiedProjectData
+   */
+  ExportOptions &SetMinifyProjectData(bool enable) {
+    minifyProjectData = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if a gzip compressed copy of the files of the project data
+   * must be exported next to them (`data.js.gz`...), so that web servers
+   * can serve them directly.
+   *
+   * \warning The file system used for the export must be able to write
+   * binary files.
+   */
+  ExportOptions &SetPrecompressProjectData(bool enable) {
+    precompressProjectData = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String target;
   gd::String fallbackAuthorUsername;
   gd::String fallbackAuthorId;
+  bool deduplicateResourcesFiles;
+  gd::FilesContentHashCache *filesContentHashCache;
+  bool packResourcesInBundles;
+  bool minifyProjectData;
+  bool precompressProjectData;
 };
 
 /**
@@ -382,6 +449,38 @@ class ExporterHelper {
       std::unordered_map<gd::String, std::set<gd::String>>
           &layersUsedResources);
 
+  /**
+   * \brief Export a project to minified JavaScript files, in the given
+   * directory.
+   *
+   * `data.js` contains the project without the content of its scenes, which
+   * is stored in a `data-scene-<index of the scene>.js` file for each scene.
+   * Strings repeated in a file (object types, behavior types, names...) are
+   * declared once in a variable.
+   *
+   * \param fs The abstract file system to use to write the files
+   * \param project The project to be exported.
+   * \param codeOutputDir The directory where the files must be written.
+   * \param runtimeGameOptions The content of the extra configuration to store
+   * in gdjs.runtimeGameOptions.
+   * \param includesFiles The files written will be added to this list, in the
+   * order they must be loaded.
+   * \param precompress If true, a gzip compressed copy of each file is written
+   * next to it.
+   * \return Empty string if everything is ok, description of the error
+   * otherwise.
+   */
+  static gd::String ExportMinifiedProjectData(
+      gd::AbstractFileSystem &fs,
+      gd::Project &project,
+      gd::String codeOutputDir,
+      const gd::SerializerElement &runtimeGameOptions,
+      std::set<gd::String> &projectUsedResources,
+      std::unordered_map<gd::String, std::set<gd::String>>
+          &layersUsedResources,
+      std::vector<gd::String> &includesFiles,
+      bool precompress = false);
+
   /**
    * \brief Copy all the resources of the project to to the export directory,
    * updating the resources filenames.
@@ -391,10 +490,39 @@ class ExporterHelper {
    * \param exportDir The directory where the preview must be created.
    * \param progressDlg Optional wxProgressDialog which will be updated with the
    * progress.
+   * \param deduplicateIdenticalFiles If true, files with the same content are
+   * exported only once.
+   * \param filesContentHashCache Optional cache of the hashes of the files
+   * content, used when files are deduplicated.
    */
-  static void ExportResources(gd::AbstractFileSystem &fs,
-                              gd::Project &project,
-                              gd::String exportDir);
+  static void ExportResources(
+      gd::AbstractFileSystem &fs,
+      gd::Project &project,
+      gd::String exportDir,
+      bool deduplicateIdenticalFiles = false,
+      gd::FilesContentHashCache *filesContentHashCache = nullptr);
+
+  /**
+   * \brief Pack the exported resources files into bundles, in the `bundles`
+   * folder of the export directory.
+   *
+   * Resources used by the project or by several scenes are packed in
+   * `bundles/shared.gdbundle`. Resources used by a single scene are packed in
+   * `bundles/scene-<index of the scene>.gdbundle`. A `bundles/bundles.json`
+   * file lists the bundles with the scene and the resources of each one.
+   *
+   * \note Resources must have been exported before, as their files are read
+   * from the export directory. Resources with a URL are not packed.
+   *
+   * \see gd::ResourcesBundle
+   */
+  static void ExportResourcesBundles(
+      gd::AbstractFileSystem &fs,
+      gd::Project &project,
+      gd::String exportDir,
+      const std::set<gd::String> &projectUsedResources,
+      const std::unordered_map<gd::String, std::set<gd::String>>
+          &scenesUsedResources);
 
   /**
    * \brief Add libraries files to the list of includes.
@@ -417,7 +545,8 @@ class ExporterHelper {
   /**
    * \brief Copy all the specified files to the
    * export directory. Relative files are copied from "<GDJS root>/Runtime"
-   * directory.
+   * directory. Absolute files are copied with their gzip compressed copy
+   * (`.gz`), if any.
    *
    * \param includesFiles A vector with filenames to be copied.
    * \param exportDir The directory where the files must be copied.
@@ -33,6 +33,7 @@
 #include <GDCore/IDE/Events/EventsPositionFinder.h>
 #include <GDCore/IDE/Events/EventsRefactorer.h>
 #include <GDCore/IDE/Events/EventsRemover.h>
+#include <GDCore/IDE/Events/EventsSearchIndex.h>
 #include <GDCore/IDE/Events/EventsTypesLister.h>
 #include <GDCore/IDE/Events/EventsVariablesFinder.h>
 #include <GDCore/IDE/Events/ExpressionCompletionFinder.h>
@@ -49,7 +50,9 @@
 #include <GDCore/IDE/Project/ArbitraryResourceWorker.h>
 #include <GDCore/IDE/Project/ArbitraryObjectsWorker.h>
 #include <GDCore/IDE/Project/ObjectsUsingResourceCollector.h>
+#include <GDCore/IDE/Project/ResourcesUsageIndex.h>
 #include <GDCore/IDE/Project/ProjectResourcesAdder.h>
+#include <GDCore/IDE/Project/FilesContentHashCache.h>
 #include <GDCore/IDE/Project/ProjectResourcesCopier.h>
 #include <GDCore/IDE/Project/ResourcesInUseHelper.h>
 #include <GDCore/IDE/Project/ResourcesMergingHelper.h>
@@ -57,6 +60,7 @@
 #include <GDCore/IDE/Project/EventsBasedObjectDependencyFinder.h>
 #include <GDCore/IDE/ProjectBrowserHelper.h>
 #include <GDCore/IDE/PropertyFunctionGenerator.h>
+#include <GDCore/IDE/RefactoringChangeset.h>
 #include <GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h>
 #include <GDCore/IDE/VariableInstructionSwitcher.h>
 #include <GDCore/IDE/WholeProjectRefactorer.h>
@@ -75,6 +79,7 @@
 #include <GDCore/Project/LayersContainer.h>
 #include <GDCore/Project/MeasurementBaseUnit.h>
 #include <GDCore/Project/MeasurementUnitElement.h>
+#include <GDCore/Project/IdentifiersSearchIndex.h>
 #include <GDCore/Project/NamedPropertyDescriptor.h>
 #include <GDCore/Project/Object.h>
 #include <GDCore/Project/ObjectFolderOrObject.h>
@@ -355,6 +360,50 @@ class AbstractFileSystemJS : public AbstractFileSystem {
     return directories;
   }
 
+  virtual bool GetFileStats(const gd::String &file,
+                            std::size_t &size,
+                            std::int64_t &lastModificationTime) {
+    // Optional: if not implemented (or if it returns null), the hashes of
+    // the files content are never reused.
+    double sizeValue = 0;
+    double lastModificationTimeValue = 0;
+    bool hasStats = (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('getFileStats')) return false;
+          var stats = self.getFileStats(UTF8ToString($1));
+          if (!stats) return false;
+
+          HEAPF64[$2 >> 3] = stats.size;
+          HEAPF64[$3 >> 3] = stats.lastModificationTime;
+          return true;
+        },
+        (int)this,
+        file.c_str(),
+        &sizeValue,
+        &lastModificationTimeValue);
+    if (!hasStats) return false;
+
+    size = (std::size_t)sizeValue;
+    lastModificationTime = (std::int64_t)lastModificationTimeValue;
+    return true;
+  }
+
+  virtual gd::String GetFileContentHash(const gd::String &file) {
+    // Optional: files read from JavaScript are decoded as text, so hashing
+    // them here would not be reliable for binary files. If not implemented,
+    // files are never considered as identical.
+    return (const char *)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('getFileContentHash'))
+            return ensureString('');
+          return ensureString(self.getFileContentHash(UTF8ToString($1)));
+        },
+        (int)this,
+        file.c_str());
+  }
+
   AbstractFileSystemJS(){};
   virtual ~AbstractFileSystemJS(){};
 };
@@ -493,6 +542,11 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define WRAPPED_SetInt(v) SetValue(v)
 #define WRAPPED_SetDouble(v) SetValue(v)
 #define WRAPPED_SetChild(name, child) GetChild(name) = child
+#define WRAPPED_ReparseExpression(                                 \
+    previousNode, previousExpression, editPosition, removedLength, \
+    insertedText)                                                  \
+  ReparseExpression(std::move(previousNode), previousExpression,   \
+                    editPosition, removedLength, insertedText)
 
 // Wrappers to avoid dealing with shared_ptr in the methods interface:
 #define WRAPPED_AddBehavior(name,                      \
@@ -547,6 +601,8 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_GetPrimitiveValueType GetPrimitiveValueType
 #define STATIC_ConvertPropertyTypeToValueType ConvertPropertyTypeToValueType
 #define STATIC_Get Get
+#define STATIC_SetLazyExtensionsDeclaration SetLazyExtensionsDeclaration
+#define STATIC_IsLazyExtensionsDeclarationEnabled IsLazyExtensionsDeclarationEnabled
 #define STATIC_GetAllUseless GetAllUseless
 #define STATIC_RemoveAllUseless RemoveAllUseless
 #define STATIC_MakeNewObjectsContainersListForProjectAndLayout \
@@ -603,6 +659,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_RenameObjectInEvents RenameObjectInEvents
 #define STATIC_RemoveObjectInEvents RemoveObjectInEvents
 #define STATIC_ReplaceStringInEvents ReplaceStringInEvents
+#define STATIC_ReplaceStringInEventsWithIndex ReplaceStringInEvents
 #define STATIC_ExposeProjectEvents ExposeProjectEvents
 #define STATIC_ExposeProjectObjects ExposeProjectObjects
 #define STATIC_ExposeWholeProjectResources ExposeWholeProjectResources
@@ -699,6 +756,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
   IsObjectFunctionOnlyCallingItself
 
 #define STATIC_SearchInEvents SearchInEvents
+#define STATIC_SearchInEventsWithIndex SearchInEvents
 #define STATIC_UnfoldWhenContaining UnfoldWhenContaining
 #define STATIC_FoldAll FoldAll
 #define STATIC_UnfoldToLevel UnfoldToLevel
@@ -715,6 +773,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
   ApplyRefactoringForVariablesContainer
 #define STATIC_ApplyRefactoringForGroupVariablesContainer \
   ApplyRefactoringForGroupVariablesContainer
+#define STATIC_ApplyRefactoringChangeset ApplyRefactoringChangeset
 #define STATIC_ComputeChangesetForVariablesContainer \
   ComputeChangesetForVariablesContainer
 #define STATIC_MergeVariableContainers MergeVariableContainers
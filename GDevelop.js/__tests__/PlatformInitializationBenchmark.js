@@ -0,0 +1,47 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+
+describe.skip('gd.JsPlatform initialization benchmarks', function () {
+  // Each initialization needs a new instance of libGD.js, as the platform is
+  // a singleton. Instances are created beforehand to only measure the
+  // creation of the platform.
+  const benchmarksCount = 3;
+  const iterationsCount = 2;
+  const instancesCount = benchmarksCount * iterationsCount;
+  let eagerInstances = [];
+  let lazyInstances = [];
+  beforeAll(async () => {
+    for (let i = 0; i < instancesCount; i++) {
+      eagerInstances.push(await initializeGDevelopJs());
+      lazyInstances.push(await initializeGDevelopJs());
+    }
+  });
+
+  it('Benchmark platform creation', function () {
+    const eagerHeapGrowths = [];
+    const lazyHeapGrowths = [];
+    const initializePlatform = (gd, heapGrowths) => {
+      const heapSizeBefore = gd.HEAP8.length;
+      gd.JsPlatform.get();
+      heapGrowths.push(gd.HEAP8.length - heapSizeBefore);
+    };
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount,
+      iterationsCount,
+    })
+      .add('eager extensions declaration', () => {
+        const gd = eagerInstances.pop();
+        initializePlatform(gd, eagerHeapGrowths);
+      })
+      .add('lazy extensions declaration', () => {
+        const gd = lazyInstances.pop();
+        gd.JsPlatform.setLazyExtensionsDeclaration(true);
+        initializePlatform(gd, lazyHeapGrowths);
+      });
+
+    console.log(benchmarkSuite.run());
+    console.log('Heap growths (eager):', eagerHeapGrowths);
+    console.log('Heap growths (lazy):', lazyHeapGrowths);
+  });
+});
@@ -265,6 +265,8 @@ export class Platform extends EmscriptenObject {
 
 export class JsPlatform extends EmscriptenObject {
   static get(): JsPlatform;
+  static setLazyExtensionsDeclaration(enable: boolean): void;
+  static isLazyExtensionsDeclarationEnabled(): boolean;
   addNewExtension(extension: PlatformExtension): void;
   getName(): string;
   getFullName(): string;
@@ -566,6 +568,10 @@ export class Project extends EmscriptenObject {
   getLayoutsCount(): number;
   insertNewLayout(name: string, position: number): Layout;
   removeLayout(name: string): void;
+  setLazyLayoutsLoading(enable: boolean): void;
+  isLazyLayoutsLoadingEnabled(): boolean;
+  isLayoutLoaded(name: string): boolean;
+  loadAllLayouts(): void;
   setFirstLayout(name: string): void;
   getFirstLayout(): string;
   getLayoutPosition(name: string): number;
@@ -629,6 +635,17 @@ export class ObjectsContainersList extends EmscriptenObject {
   getObjectsContainersCount(): number;
 }
 
+export class IdentifiersSearchIndex extends EmscriptenObject {
+  constructor();
+  indexObjectsContainer(objectsContainer: ObjectsContainer): void;
+  indexVariablesContainer(variablesContainer: VariablesContainer): void;
+  removeObjectsContainer(objectsContainer: ObjectsContainer): void;
+  removeVariablesContainer(variablesContainer: VariablesContainer): void;
+  clear(): void;
+  hasObjectsContainer(objectsContainer: ObjectsContainer): boolean;
+  hasVariablesContainer(variablesContainer: VariablesContainer): boolean;
+}
+
 export class ProjectScopedContainers extends EmscriptenObject {
   static makeNewProjectScopedContainersForProjectAndLayout(project: Project, layout: Layout): ProjectScopedContainers;
   static makeNewProjectScopedContainersForProject(project: Project): ProjectScopedContainers;
@@ -640,6 +657,7 @@ export class ProjectScopedContainers extends EmscriptenObject {
   static makeNewProjectScopedContainersWithLocalVariables(projectScopedContainers: ProjectScopedContainers, event: BaseEvent): ProjectScopedContainers;
   addPropertiesContainer(propertiesContainer: PropertiesContainer): ProjectScopedContainers;
   addParameters(parameters: ParameterMetadataContainer): ProjectScopedContainers;
+  setIdentifiersSearchIndex(index: IdentifiersSearchIndex): ProjectScopedContainers;
   getObjectsContainersList(): ObjectsContainersList;
   getVariablesContainersList(): VariablesContainersList;
 }
@@ -1863,10 +1881,20 @@ export class VectorEventsSearchResult extends EmscriptenObject {
   clear(): void;
 }
 
+export class EventsSearchIndex extends EmscriptenObject {
+  constructor(platform: Platform);
+  indexEvents(events: EventsList): void;
+  updateEvent(events: EventsList, positionInList: number): void;
+  removeEvent(event: BaseEvent): void;
+  getIndexedEventsCount(): number;
+}
+
 export class EventsRefactorer extends EmscriptenObject {
   static renameObjectInEvents(platform: Platform, projectScopedContainers: ProjectScopedContainers, events: EventsList, targetedObjectsContainer: ObjectsContainer, oldName: string, newName: string): void;
   static replaceStringInEvents(project: ObjectsContainer, layout: ObjectsContainer, events: EventsList, toReplace: string, newString: string, matchCase: boolean, inConditions: boolean, inActions: boolean, inEventStrings: boolean): VectorEventsSearchResult;
   static searchInEvents(platform: Platform, events: EventsList, search: string, matchCase: boolean, inConditions: boolean, inActions: boolean, inEventStrings: boolean, inEventSentences: boolean): VectorEventsSearchResult;
+  static replaceStringInEventsWithIndex(project: ObjectsContainer, layout: ObjectsContainer, events: EventsList, index: EventsSearchIndex, toReplace: string, newString: string, matchCase: boolean, inConditions: boolean, inActions: boolean, inEventStrings: boolean): VectorEventsSearchResult;
+  static searchInEventsWithIndex(platform: Platform, events: EventsList, index: EventsSearchIndex, search: string, matchCase: boolean, inConditions: boolean, inActions: boolean, inEventStrings: boolean, inEventSentences: boolean): VectorEventsSearchResult;
 }
 
 export class UnfilledRequiredBehaviorPropertyProblem extends EmscriptenObject {
@@ -1896,10 +1924,20 @@ export class VariablesChangeset extends EmscriptenObject {
   clearRemovedVariables(): VariablesChangeset;
 }
 
+export class RefactoringChangeset extends EmscriptenObject {
+  constructor();
+  addVariablesContainerChanges(variablesContainer: VariablesContainer, changeset: VariablesChangeset, originalSerializedVariables: SerializerElement): RefactoringChangeset;
+  addObjectOrGroupRenamedInScene(scene: Layout, oldName: string, newName: string, isObjectGroup: boolean): RefactoringChangeset;
+  addLayerRenamedInScene(scene: Layout, oldName: string, newName: string): RefactoringChangeset;
+  isEmpty(): boolean;
+  clear(): void;
+}
+
 export class WholeProjectRefactorer extends EmscriptenObject {
   static computeChangesetForVariablesContainer(oldSerializedVariablesContainer: SerializerElement, newVariablesContainer: VariablesContainer): VariablesChangeset;
   static applyRefactoringForVariablesContainer(project: Project, newVariablesContainer: VariablesContainer, changeset: VariablesChangeset, originalSerializedVariables: SerializerElement): void;
   static applyRefactoringForGroupVariablesContainer(project: Project, globalObjectsContainer: ObjectsContainer, objectsContainer: ObjectsContainer, groupVariablesContainer: VariablesContainer, objectGroup: ObjectGroup, changeset: VariablesChangeset, originalSerializedVariables: SerializerElement): void;
+  static applyRefactoringChangeset(project: Project, changeset: RefactoringChangeset): void;
   static renameEventsFunctionsExtension(project: Project, eventsFunctionsExtension: EventsFunctionsExtension, oldName: string, newName: string): void;
   static updateExtensionNameInEventsBasedBehavior(project: Project, eventsFunctionsExtension: EventsFunctionsExtension, eventsBasedBehavior: EventsBasedBehavior, sourceExtensionName: string): void;
   static updateExtensionNameInEventsBasedObject(project: Project, eventsFunctionsExtension: EventsFunctionsExtension, eventsBasedObject: EventsBasedObject, sourceExtensionName: string): void;
@@ -2121,6 +2159,7 @@ export class UniquePtrExpressionNode extends EmscriptenObject {
 export class ExpressionParser2 extends EmscriptenObject {
   constructor();
   parseExpression(expression: string): UniquePtrExpressionNode;
+  reparseExpression(previousNode: UniquePtrExpressionNode, previousExpression: string, editPosition: number, removedLength: number, insertedText: string): UniquePtrExpressionNode;
 }
 
 export class EventsFunction extends EmscriptenObject {
@@ -2423,6 +2462,12 @@ export class ResourcesRenamer extends ArbitraryResourceWorker {
   constructor(resourcesManager: ResourcesManager, oldToNewNames: MapStringString);
 }
 
+export class FilesContentHashCache extends EmscriptenObject {
+  constructor();
+  clear(): void;
+  getCachedFilesCount(): number;
+}
+
 export class ProjectResourcesCopier extends EmscriptenObject {
   static copyAllResourcesTo(project: Project, fs: AbstractFileSystem, destinationDirectory: string, updateOriginalProject: boolean, preserveAbsoluteFilenames: boolean, preserveDirectoryStructure: boolean): boolean;
 }
@@ -2443,6 +2488,23 @@ export class ResourcesInUseHelper extends ArbitraryResourceWorker {
   getAll(resourceType: string): SetString;
 }
 
+export class ResourcesUsageIndex extends EmscriptenObject {
+  constructor();
+  indexWholeProject(project: Project): void;
+  updateProject(project: Project): void;
+  updateLayout(project: Project, layout: Layout): void;
+  updateExternalEvents(project: Project, externalEvents: ExternalEvents): void;
+  updateEventsFunctionsExtension(project: Project, eventsFunctionsExtension: EventsFunctionsExtension): void;
+  removeLayout(layoutName: string): void;
+  removeExternalEvents(externalEventsName: string): void;
+  removeEventsFunctionsExtension(extensionName: string): void;
+  clear(): void;
+  isResourceUsed(resourceName: string): boolean;
+  isResourceUsedInLayout(resourceName: string, layoutName: string): boolean;
+  getLayoutsUsingResource(resourceName: string): VectorString;
+  getAllUsedResourceNames(): VectorString;
+}
+
 export class EditorSettings extends EmscriptenObject {
   constructor();
   serializeTo(element: SerializerElement): void;
@@ -2865,6 +2927,11 @@ export class PreviewExportOptions extends EmscriptenObject {
 export class ExportOptions extends EmscriptenObject {
   constructor(project: Project, outputPath: string);
   setFallbackAuthor(id: string, username: string): ExportOptions;
+  setDeduplicateResourcesFiles(enable: boolean): ExportOptions;
+  setFilesContentHashCache(cache: FilesContentHashCache): ExportOptions;
+  setPackResourcesInBundles(enable: boolean): ExportOptions;
+  setMinifyProjectData(enable: boolean): ExportOptions;
+  setPrecompressProjectData(enable: boolean): ExportOptions;
   setTarget(target: string): ExportOptions;
 }
 
@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsSearchIndex {
+  constructor(platform: gdPlatform): void;
+  indexEvents(events: gdEventsList): void;
+  updateEvent(events: gdEventsList, positionInList: number): void;
+  removeEvent(event: gdBaseEvent): void;
+  getIndexedEventsCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -2,6 +2,11 @@
 declare class gdExportOptions {
   constructor(project: gdProject, outputPath: string): void;
   setFallbackAuthor(id: string, username: string): gdExportOptions;
+  setDeduplicateResourcesFiles(enable: boolean): gdExportOptions;
+  setFilesContentHashCache(cache: gdFilesContentHashCache): gdExportOptions;
+  setPackResourcesInBundles(enable: boolean): gdExportOptions;
+  setMinifyProjectData(enable: boolean): gdExportOptions;
+  setPrecompressProjectData(enable: boolean): gdExportOptions;
   setTarget(target: string): gdExportOptions;
   delete(): void;
   ptr: number;
@@ -2,6 +2,7 @@
 declare class gdExpressionParser2 {
   constructor(): void;
   parseExpression(expression: string): gdUniquePtrExpressionNode;
+  reparseExpression(previousNode: gdUniquePtrExpressionNode, previousExpression: string, editPosition: number, removedLength: number, insertedText: string): gdUniquePtrExpressionNode;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -0,0 +1,8 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdFilesContentHashCache {
+  constructor(): void;
+  clear(): void;
+  getCachedFilesCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
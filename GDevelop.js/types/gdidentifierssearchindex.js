@@ -0,0 +1,13 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdIdentifiersSearchIndex {
+  constructor(): void;
+  indexObjectsContainer(objectsContainer: gdObjectsContainer): void;
+  indexVariablesContainer(variablesContainer: gdVariablesContainer): void;
+  removeObjectsContainer(objectsContainer: gdObjectsContainer): void;
+  removeVariablesContainer(variablesContainer: gdVariablesContainer): void;
+  clear(): void;
+  hasObjectsContainer(objectsContainer: gdObjectsContainer): boolean;
+  hasVariablesContainer(variablesContainer: gdVariablesContainer): boolean;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -1,6 +1,8 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdJsPlatform extends gdPlatform {
   static get(): gdJsPlatform;
+  static setLazyExtensionsDeclaration(enable: boolean): void;
+  static isLazyExtensionsDeclarationEnabled(): boolean;
   addNewExtension(extension: gdPlatformExtension): void;
   getName(): string;
   getFullName(): string;
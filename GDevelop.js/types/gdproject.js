@@ -68,6 +68,10 @@ declare class gdProject {
   getLayoutsCount(): number;
   insertNewLayout(name: string, position: number): gdLayout;
   removeLayout(name: string): void;
+  setLazyLayoutsLoading(enable: boolean): void;
+  isLazyLayoutsLoadingEnabled(): boolean;
+  isLayoutLoaded(name: string): boolean;
+  loadAllLayouts(): void;
   setFirstLayout(name: string): void;
   getFirstLayout(): string;
   getLayoutPosition(name: string): number;
@@ -10,6 +10,7 @@ declare class gdProjectScopedContainers {
   static makeNewProjectScopedContainersWithLocalVariables(projectScopedContainers: gdProjectScopedContainers, event: gdBaseEvent): gdProjectScopedContainers;
   addPropertiesContainer(propertiesContainer: gdPropertiesContainer): gdProjectScopedContainers;
   addParameters(parameters: gdParameterMetadataContainer): gdProjectScopedContainers;
+  setIdentifiersSearchIndex(index: gdIdentifiersSearchIndex): gdProjectScopedContainers;
   getObjectsContainersList(): gdObjectsContainersList;
   getVariablesContainersList(): gdVariablesContainersList;
   delete(): void;
@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdRefactoringChangeset {
+  constructor(): void;
+  addVariablesContainerChanges(variablesContainer: gdVariablesContainer, changeset: gdVariablesChangeset, originalSerializedVariables: gdSerializerElement): gdRefactoringChangeset;
+  addObjectOrGroupRenamedInScene(scene: gdLayout, oldName: string, newName: string, isObjectGroup: boolean): gdRefactoringChangeset;
+  addLayerRenamedInScene(scene: gdLayout, oldName: string, newName: string): gdRefactoringChangeset;
+  isEmpty(): boolean;
+  clear(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
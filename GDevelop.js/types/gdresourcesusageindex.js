@@ -0,0 +1,19 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdResourcesUsageIndex {
+  constructor(): void;
+  indexWholeProject(project: gdProject): void;
+  updateProject(project: gdProject): void;
+  updateLayout(project: gdProject, layout: gdLayout): void;
+  updateExternalEvents(project: gdProject, externalEvents: gdExternalEvents): void;
+  updateEventsFunctionsExtension(project: gdProject, eventsFunctionsExtension: gdEventsFunctionsExtension): void;
+  removeLayout(layoutName: string): void;
+  removeExternalEvents(externalEventsName: string): void;
+  removeEventsFunctionsExtension(extensionName: string): void;
+  clear(): void;
+  isResourceUsed(resourceName: string): boolean;
+  isResourceUsedInLayout(resourceName: string, layoutName: string): boolean;
+  getLayoutsUsingResource(resourceName: string): gdVectorString;
+  getAllUsedResourceNames(): gdVectorString;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -83,6 +83,7 @@ declare class libGDevelop {
   Project: Class<gdProject>;
   ObjectsContainersList_VariableExistence: Class<ObjectsContainersList_VariableExistence>;
   ObjectsContainersList: Class<gdObjectsContainersList>;
+  IdentifiersSearchIndex: Class<gdIdentifiersSearchIndex>;
   ProjectScopedContainers: Class<gdProjectScopedContainers>;
   ExtensionProperties: Class<gdExtensionProperties>;
   Behavior: Class<gdBehavior>;
@@ -174,12 +175,14 @@ declare class libGDevelop {
   EventsListUnfolder: Class<gdEventsListUnfolder>;
   EventsSearchResult: Class<gdEventsSearchResult>;
   VectorEventsSearchResult: Class<gdVectorEventsSearchResult>;
+  EventsSearchIndex: Class<gdEventsSearchIndex>;
   EventsRefactorer: Class<gdEventsRefactorer>;
   UnfilledRequiredBehaviorPropertyProblem: Class<gdUnfilledRequiredBehaviorPropertyProblem>;
   VectorUnfilledRequiredBehaviorPropertyProblem: Class<gdVectorUnfilledRequiredBehaviorPropertyProblem>;
   ProjectBrowserHelper: Class<gdProjectBrowserHelper>;
   ResourceExposer: Class<gdResourceExposer>;
   VariablesChangeset: Class<gdVariablesChangeset>;
+  RefactoringChangeset: Class<gdRefactoringChangeset>;
   WholeProjectRefactorer: Class<gdWholeProjectRefactorer>;
   EventsBasedObjectDependencyFinder: Class<gdEventsBasedObjectDependencyFinder>;
   PropertyFunctionGenerator: Class<gdPropertyFunctionGenerator>;
@@ -235,9 +238,11 @@ declare class libGDevelop {
   ArbitraryResourceWorkerJS: Class<gdArbitraryResourceWorkerJS>;
   ResourcesMergingHelper: Class<gdResourcesMergingHelper>;
   ResourcesRenamer: Class<gdResourcesRenamer>;
+  FilesContentHashCache: Class<gdFilesContentHashCache>;
   ProjectResourcesCopier: Class<gdProjectResourcesCopier>;
   ObjectsUsingResourceCollector: Class<gdObjectsUsingResourceCollector>;
   ResourcesInUseHelper: Class<gdResourcesInUseHelper>;
+  ResourcesUsageIndex: Class<gdResourcesUsageIndex>;
   EditorSettings: Class<gdEditorSettings>;
   Point: Class<gdPoint>;
   VectorPoint: Class<gdVectorPoint>;
@@ -1,5 +1,6 @@
 // @flow
 import path from 'path-browserify';
+import { getTextSha512TruncatedTo256 } from '../../Utils/FileHasher';
 const gd: libGDevelop = global.gd;
 
 export type BlobFileDescriptor = {|
@@ -227,4 +228,13 @@ export default class BrowserFileSystem {
       !!this._filesToDownload[normalizedFilePath]
     );
   };
+
+  getFileContentHash = (filePath: string): string => {
+    // Only in-memory files can be hashed: files to be downloaded from URLs
+    // are never considered as identical (but the same URL is only copied once).
+    const normalizedFilePath = pathPosix.normalize(filePath);
+    if (!this._textFiles[normalizedFilePath]) return '';
+
+    return getTextSha512TruncatedTo256(this._textFiles[normalizedFilePath]);
+  };
 }
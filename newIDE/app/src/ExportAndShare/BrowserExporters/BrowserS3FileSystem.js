@@ -1,6 +1,7 @@
 // @flow
 import path from 'path-browserify';
 import { uploadObjects } from '../../Utils/GDevelopServices/Preview';
+import { getTextSha512TruncatedTo256 } from '../../Utils/FileHasher';
 const gd: libGDevelop = global.gd;
 
 export type TextFileDescriptor = {|
@@ -178,4 +179,13 @@ export default class BrowserS3FileSystem {
     // Assume all files asked for exists.
     return true;
   };
+
+  getFileContentHash = (filePath: string): string => {
+    // Only the files with a known content can be hashed.
+    if (!this._indexedFilesContent[filePath]) return '';
+
+    return getTextSha512TruncatedTo256(
+      this._indexedFilesContent[filePath].text
+    );
+  };
 }
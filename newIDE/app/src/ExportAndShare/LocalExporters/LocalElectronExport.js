@@ -20,6 +20,7 @@ import {
   ExportFlow,
 } from '../GenericExporters/ElectronExport';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 const electron = optionalRequire('electron');
 const shell = electron ? electron.shell : null;
 
@@ -121,6 +122,8 @@ export const localElectronExportPipeline: ExportPipeline<
       context.project,
       context.exportState.outputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     exportOptions.setTarget('electron');
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
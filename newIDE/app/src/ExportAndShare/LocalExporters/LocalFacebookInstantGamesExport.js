@@ -21,6 +21,7 @@ import {
   ExportFlow,
 } from '../GenericExporters/FacebookInstantGamesExport';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 
 const path = optionalRequire('path');
 const electron = optionalRequire('electron');
@@ -144,6 +145,8 @@ export const localFacebookInstantGamesExportPipeline: ExportPipeline<
       context.project,
       temporaryOutputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     exportOptions.setTarget('facebookInstantGames');
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
@@ -5,6 +5,7 @@ import { isURL } from '../../ResourcesList/ResourceUtils';
 const fs = optionalRequire('fs-extra');
 const path = optionalRequire('path');
 const os = optionalRequire('os');
+const crypto = optionalRequire('crypto');
 
 const gd: libGDevelop = global.gd;
 
@@ -216,6 +217,39 @@ class LocalFileSystem {
       return false;
     }
   };
+  getFileStats = (
+    filePath: string
+  ): ?{| size: number, lastModificationTime: number |} => {
+    // URLs are not read, so their content can't be known.
+    if (isURL(filePath)) return null;
+
+    try {
+      const stat = fs.statSync(filePath);
+      if (!stat.isFile()) return null;
+
+      return {
+        size: stat.size,
+        lastModificationTime: Math.floor(stat.mtimeMs),
+      };
+    } catch (e) {
+      return null;
+    }
+  };
+  getFileContentHash = (filePath: string): string => {
+    if (isURL(filePath)) return '';
+
+    try {
+      // Hash the raw content of the file, as readFile would decode binary
+      // files as text.
+      return crypto
+        .createHash('sha256')
+        .update(fs.readFileSync(filePath))
+        .digest('hex');
+    } catch (e) {
+      console.error('getFileContentHash(' + filePath + ') failed: ' + e);
+      return '';
+    }
+  };
 }
 
 export default LocalFileSystem;
@@ -0,0 +1,16 @@
+// @flow
+const gd: libGDevelop = global.gd;
+
+let filesContentHashCache: ?gdFilesContentHashCache = null;
+
+/**
+ * Return the cache of the hashes of the resources files content, shared by
+ * all the local exports so that unchanged files are not read again when
+ * identical files are deduplicated.
+ */
+export const getFilesContentHashCache = (): gdFilesContentHashCache => {
+  if (!filesContentHashCache)
+    filesContentHashCache = new gd.FilesContentHashCache();
+
+  return filesContentHashCache;
+};
@@ -21,6 +21,7 @@ import {
 } from '../GenericExporters/HTML5Export';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
 import DismissableTutorialMessage from '../../Hints/DismissableTutorialMessage';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 
 const electron = optionalRequire('electron');
 const shell = electron ? electron.shell : null;
@@ -124,6 +125,8 @@ export const localHTML5ExportPipeline: ExportPipeline<
       context.project,
       context.exportState.outputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
         fallbackAuthor.id,
@@ -23,6 +23,7 @@ import {
   ExportFlow,
 } from '../GenericExporters/OnlineCordovaExport';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 
 const path = optionalRequire('path');
 const os = optionalRequire('os');
@@ -122,6 +123,8 @@ export const localOnlineCordovaExportPipeline: ExportPipeline<
       context.project,
       temporaryOutputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     exportOptions.setTarget('cordova');
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
@@ -23,6 +23,7 @@ import {
   ExportFlow,
 } from '../GenericExporters/OnlineCordovaIosExport';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 
 const path = optionalRequire('path');
 const os = optionalRequire('os');
@@ -121,6 +122,8 @@ export const localOnlineCordovaIosExportPipeline: ExportPipeline<
       context.project,
       temporaryOutputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     exportOptions.setTarget('cordova');
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
@@ -23,6 +23,7 @@ import {
   ExportFlow,
 } from '../GenericExporters/OnlineElectronExport';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 
 const path = optionalRequire('path');
 const os = optionalRequire('os');
@@ -118,6 +119,8 @@ export const localOnlineElectronExportPipeline: ExportPipeline<
       context.project,
       temporaryOutputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     exportOptions.setTarget('electron');
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
@@ -20,6 +20,7 @@ import {
 import { ExplanationHeader } from '../GenericExporters/OnlineWebExport';
 import { downloadUrlsToLocalFiles } from '../../Utils/LocalFileDownloader';
 import OnlineWebExportFlow from '../GenericExporters/OnlineWebExport/OnlineWebExportFlow';
+import { getFilesContentHashCache } from './LocalFilesContentHashCache';
 
 const path = optionalRequire('path');
 const os = optionalRequire('os');
@@ -110,6 +111,8 @@ export const localOnlineWebExportPipeline: ExportPipeline<
       context.project,
       temporaryOutputDir
     );
+    exportOptions.setDeduplicateResourcesFiles(true);
+    exportOptions.setFilesContentHashCache(getFilesContentHashCache());
     if (fallbackAuthor) {
       exportOptions.setFallbackAuthor(
         fallbackAuthor.id,
@@ -150,7 +150,9 @@ export default class ResourcesList extends React.Component<Props, State> {
 
     this.props.onRenameResource(resource, newName, doRename => {
       if (!doRename) return;
-      resource.setName(newName);
+      project
+        .getResourcesManager()
+        .renameResource(resource.getName(), newName);
       this.forceUpdate();
     });
   };
@@ -57,3 +57,13 @@ export const getFileSha512TruncatedTo256 = async (
     fileReader.readAsArrayBuffer(file);
   });
 };
+
+/**
+ * Synchronously hash a text (used for in-memory files of the file systems
+ * used for exports).
+ */
+export const getTextSha512TruncatedTo256 = (text: string): string => {
+  const shaObj = new jsSHA('SHA-512', 'TEXT');
+  shaObj.update(text);
+  return shaObj.getHash('HEX').substr(0, 64);
+};